@@ -42,6 +42,7 @@ tests = [
     ("Ice/properties", ["once", "nomingw"]),
     ("Ice/proxy", ["core", "bt"]),
     ("Ice/operations", ["core", "bt"]),
+    ("Ice/allocations", ["core", "novalgrind"]), # The test replaces the allocation functions.
     ("Ice/exceptions", ["core", "bt"]),
     ("Ice/ami", ["core", "nocompress", "bt"]),
     ("Ice/info", ["core", "noipv6", "nocompress", "nosocks"]),
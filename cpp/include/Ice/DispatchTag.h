@@ -0,0 +1,58 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_DISPATCH_TAG_H
+#define ICE_DISPATCH_TAG_H
+
+#include <Ice/Config.h>
+
+namespace Ice
+{
+
+//
+// Describes the request dispatched by a thread. If the Ice.DispatchTag
+// property is set, the Ice run time tags its threads with the request
+// they dispatch so that samples collected by a profiler can be
+// attributed to the adapter, identity and operation of the request.
+// The strings are only valid while the request is dispatched.
+//
+struct DispatchTag
+{
+    const char* adapter;
+    const char* category;
+    const char* name;
+    const char* facet;
+    const char* operation;
+};
+
+//
+// Returns the tag of the request dispatched by the calling thread or
+// null if the thread isn't dispatching a request. This is typically
+// called by in-process sampling profilers.
+//
+ICE_API const DispatchTag* getDispatchTag();
+
+}
+
+extern "C"
+{
+
+//
+// Called by the Ice run time when a thread starts and finishes
+// dispatching a tagged request. These functions don't do anything,
+// they are provided as stable probe points for dynamic tracing tools
+// (for example uprobes with perf or eBPF) which can record the tag of
+// each thread to attribute the samples of an external profiler.
+//
+ICE_API void iceDispatchBegin(const Ice::DispatchTag*);
+ICE_API void iceDispatchEnd(const Ice::DispatchTag*);
+
+}
+
+#endif
@@ -0,0 +1,43 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_EXECUTOR_H
+#define ICE_EXECUTOR_H
+
+#include <Ice/Config.h>
+#include <Ice/CommunicatorF.h>
+#include <Ice/Dispatcher.h>
+
+#ifdef ICE_CPP11_MAPPING
+#   include <functional>
+#endif
+
+namespace Ice
+{
+
+//
+// Queues a call for execution by the client thread pool of the
+// communicator, like the AMI callbacks which can't be called from the
+// thread which completes the invocation. If the thread pool has a
+// work-stealing executor (Ice.ThreadPool.Client.WorkStealing), the call
+// is executed by the executor threads. The call is executed with the
+// dispatcher of the communicator if one is set.
+//
+// Raises CommunicatorDestroyedException if the communicator is
+// destroyed.
+//
+#ifdef ICE_CPP11_MAPPING
+ICE_API void executeInClientThreadPool(const std::shared_ptr<Communicator>&, std::function<void()>);
+#else
+ICE_API void executeInClientThreadPool(const CommunicatorPtr&, const DispatcherCallPtr&);
+#endif
+
+}
+
+#endif
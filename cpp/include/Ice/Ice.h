@@ -42,6 +42,8 @@
 #include <Ice/Locator.h>
 #include <Ice/Router.h>
 #include <Ice/DispatchInterceptor.h>
+#include <Ice/DispatchTag.h>
+#include <Ice/Executor.h>
 #include <Ice/Plugin.h>
 #include <Ice/NativePropertiesAdmin.h>
 #include <Ice/Instrumentation.h>
@@ -19,8 +19,10 @@
 #include <Ice/Object.h>
 #include <Ice/Current.h>
 #include <Ice/IncomingAsyncF.h>
+#include <IceUtil/Time.h>
 #include <Ice/ObserverHelper.h>
 #include <Ice/ResponseHandlerF.h>
+#include <Ice/ThreadCache.h>
 
 #include <deque>
 
@@ -96,17 +98,30 @@ protected:
     Ice::FormatType _format;
     Ice::OutputStream _os;
 
+    //
+    // The deadline of the request for the monotonic clock, not set if
+    // the request doesn't carry a deadline.
+    //
+    IceUtil::Time _deadline;
+
     //
     // Optimization. The request handler may not be deleted while a
     // stack-allocated Incoming still holds it.
     //
     ResponseHandler* _responseHandler;
 
+    //
+    // The deque allocates memory on construction, it's recycled by the
+    // thread cache.
+    //
 #ifdef ICE_CPP11_MAPPING
-    using DispatchInterceptorCallbacks = std::deque<std::pair<std::function<bool()>,
-                                                              std::function<bool(std::exception_ptr)>>>;
+    using DispatchInterceptorCallback = std::pair<std::function<bool()>, std::function<bool(std::exception_ptr)>>;
+    using DispatchInterceptorCallbacks = std::deque<DispatchInterceptorCallback,
+                                                    IceInternal::ThreadCacheAllocator<DispatchInterceptorCallback>>;
 #else
-    typedef std::deque<Ice::DispatchInterceptorAsyncCallbackPtr> DispatchInterceptorCallbacks;
+    typedef std::deque<Ice::DispatchInterceptorAsyncCallbackPtr,
+                       IceInternal::ThreadCacheAllocator<Ice::DispatchInterceptorAsyncCallbackPtr> >
+        DispatchInterceptorCallbacks;
 #endif
     DispatchInterceptorCallbacks _interceptorCBs;
 };
@@ -142,8 +157,23 @@ public:
         _format = format;
     }
 
+    //
+    // The time spent by the request in the queue of an overloaded
+    // object adapter, for the dispatch metrics.
+    //
+    void setQueueTime(const IceUtil::Time& queueTime)
+    {
+        _queueTime = queueTime;
+    }
+
     void invoke(const ServantManagerPtr&, Ice::InputStream*);
 
+    //
+    // Sends the given exception to the client instead of dispatching
+    // the request.
+    //
+    void reject(Ice::InputStream*, const Ice::LocalException&);
+
     // Inlined for speed optimization.
     void skipReadParams()
     {
@@ -175,8 +205,11 @@ private:
 
     friend class IncomingAsync;
 
+    void readCurrent(Ice::InputStream*);
+
     Ice::InputStream* _is;
     Ice::Byte* _inParamPos;
+    IceUtil::Time _queueTime;
 
     IncomingAsyncPtr _inAsync;
 };
@@ -16,6 +16,8 @@
 
 #include <Ice/Metrics.h>
 
+#include <IceUtil/Atomic.h>
+
 #ifdef _MSC_VER
 #  define ICE_CPP11_COMPILER_REGEXP
 #endif
@@ -33,17 +35,253 @@
 
 #include <list>
 
+namespace IceInternal
+{
+
+class OpenMetricsWriter;
+
+}
+
 namespace IceMX
 {
 
 class Updater;
 template<typename T> class MetricsHelperT;
 
+//
+// Add the counters of the second metrics object to the first one. This
+// is used to merge the per-thread shards of the metrics map entries
+// (see MetricsMapT::EntryT::executeOnShard), an overload must be
+// provided for each metrics type updated with ObserverT::forEachShard.
+//
+template<typename T> inline void
+mergeOptional(T& m, const T& shard)
+{
+    if(shard)
+    {
+        m = (m ? *m : 0) + *shard;
+    }
+}
+
+inline void
+mergeMetrics(Metrics* m, const Metrics* shard)
+{
+    m->total += shard->total;
+    m->totalLifetime += shard->totalLifetime;
+    m->failures += shard->failures;
+}
+
+inline void
+mergeMetrics(ThreadMetrics* m, const ThreadMetrics* shard)
+{
+    mergeMetrics(static_cast<Metrics*>(m), shard);
+    m->inUseForIO += shard->inUseForIO;
+    m->inUseForUser += shard->inUseForUser;
+    m->inUseForOther += shard->inUseForOther;
+}
+
+inline void
+mergeMetrics(DispatchMetrics* m, const DispatchMetrics* shard)
+{
+    mergeMetrics(static_cast<Metrics*>(m), shard);
+    m->userException += shard->userException;
+    m->size += shard->size;
+    m->replySize += shard->replySize;
+    mergeOptional(m->cpuTime, shard->cpuTime);
+    mergeOptional(m->queueTime, shard->queueTime);
+}
+
+inline void
+mergeMetrics(ChildInvocationMetrics* m, const ChildInvocationMetrics* shard)
+{
+    mergeMetrics(static_cast<Metrics*>(m), shard);
+    m->size += shard->size;
+    m->replySize += shard->replySize;
+}
+
+inline void
+mergeMetrics(InvocationMetrics* m, const InvocationMetrics* shard)
+{
+    mergeMetrics(static_cast<Metrics*>(m), shard);
+    m->retry += shard->retry;
+    m->userException += shard->userException;
+}
+
+inline void
+mergeMetrics(ConnectionMetrics* m, const ConnectionMetrics* shard)
+{
+    mergeMetrics(static_cast<Metrics*>(m), shard);
+    m->receivedBytes += shard->receivedBytes;
+    m->sentBytes += shard->sentBytes;
+}
+
+//
+// Write the metrics samples in the OpenMetrics format (see
+// MetricsMapT::exportOpenMetrics), an overload can be provided for
+// each metrics type to export its specific data members.
+//
+ICE_API void writeOpenMetrics(IceInternal::OpenMetricsWriter&, const Metrics*);
+ICE_API void writeOpenMetrics(IceInternal::OpenMetricsWriter&, const ThreadMetrics*);
+ICE_API void writeOpenMetrics(IceInternal::OpenMetricsWriter&, const DispatchMetrics*);
+ICE_API void writeOpenMetrics(IceInternal::OpenMetricsWriter&, const ChildInvocationMetrics*);
+ICE_API void writeOpenMetrics(IceInternal::OpenMetricsWriter&, const InvocationMetrics*);
+ICE_API void writeOpenMetrics(IceInternal::OpenMetricsWriter&, const ConnectionMetrics*);
+
 }
 
 namespace IceInternal
 {
 
+//
+// Log-linear (HDR-style) histogram of the lifetime of the observed
+// objects. Values below 2^SubBucketBits microseconds get their own
+// bucket, larger values are split in 2^SubBucketBits buckets per
+// power of two. Recording a value only uses atomic operations so it
+// doesn't need to hold the metrics map mutex.
+//
+class ICE_API MetricsHistogramI : private IceUtil::noncopyable
+{
+public:
+
+    MetricsHistogramI();
+
+    void record(Ice::Long);
+    void merge(const MetricsHistogramI&);
+
+    IceMX::MetricsHistogram getHistogram() const;
+
+    static Ice::Long getUpperBound(int);
+    static int getBucket(Ice::Long);
+
+    enum
+    {
+        SubBucketBits = 5,
+        SubBucketCount = 1 << SubBucketBits,
+        MaxValueBits = 38,
+        BucketCount = (MaxValueBits - SubBucketBits + 1) * SubBucketCount
+    };
+
+private:
+
+    IceUtilInternal::Atomic64 _counts[BucketCount];
+    IceUtilInternal::Atomic64 _min;
+    IceUtilInternal::Atomic64 _max;
+};
+
+//
+// Merge the given histogram into the first one, the histograms must
+// have been computed by MetricsHistogramI.
+//
+ICE_API void mergeHistograms(IceMX::MetricsHistogram&, const IceMX::MetricsHistogram&);
+
+//
+// Compute the given percentile (between 0 and 100) from the histogram
+// buckets.
+//
+ICE_API Ice::Long getHistogramPercentile(const IceMX::MetricsHistogram&, double);
+
+//
+// Returns a new identifier for the objects observed repeatedly
+// (connections, object adapters, references), see MetricsCacheKey.
+// Identifiers are never reused, unlike the address of the objects.
+//
+ICE_API Ice::Long newMetricsCacheId();
+
+//
+// The key of the metrics map entry cache, see MetricsHelperT::getCacheKey.
+// It's composed of the identifiers of the observed objects and of a few
+// strings which aren't copied, the helper must keep them alive while
+// the entry is looked up.
+//
+class MetricsCacheKey
+{
+public:
+
+    MetricsCacheKey() : count(0), flags(0)
+    {
+        ids[0] = ids[1] = 0;
+    }
+
+    void add(const std::string& value)
+    {
+        assert(count < MaxStrings);
+        strings[count++] = &value;
+    }
+
+    enum { MaxStrings = 4 };
+
+    Ice::Long ids[2];
+    const std::string* strings[MaxStrings];
+    int count;
+    int flags;
+};
+
+//
+// The entries of the metrics maps are cached per thread: the lookup
+// doesn't need any locking and the cache doesn't keep the observed
+// objects alive. The cached entries of a map are identified by the map
+// and its cache identifier, the map changes its cache identifier to
+// invalidate them. A null entry is cached for objects which don't match
+// the map filters.
+//
+#ifdef ICE_CPP11_MAPPING
+typedef std::shared_ptr<void> MetricsCacheEntryPtr;
+#else
+typedef Ice::LocalObjectPtr MetricsCacheEntryPtr;
+#endif
+
+ICE_API bool findMetricsCacheEntry(const void*, Ice::Long, const MetricsCacheKey&, MetricsCacheEntryPtr&);
+ICE_API void addMetricsCacheEntry(const void*, Ice::Long, const MetricsCacheKey&, const MetricsCacheEntryPtr&);
+
+//
+// Release the calling thread's metrics cache, this is called when a
+// thread terminates on Windows.
+//
+ICE_API void cleanupMetricsThread();
+
+//
+// Writes metrics in the OpenMetrics text exposition format. The samples
+// are grouped by metric family and the families are written in the
+// order they were first added.
+//
+class ICE_API OpenMetricsWriter : private IceUtil::noncopyable
+{
+public:
+
+    //
+    // Set the metric family prefix and the labels of the samples added
+    // with the functions below.
+    //
+    void setPrefix(const std::string&);
+    void setLabels(const std::string&, const std::string&, const std::string&);
+
+    //
+    // Add a sample to the family named after the prefix and the given
+    // name. The value is multiplied by the given scale factor (to
+    // convert microseconds to seconds for instance).
+    //
+    void counter(const std::string&, Ice::Long, double = 1.0);
+    void gauge(const std::string&, Ice::Long);
+    void histogram(const std::string&, const IceMX::MetricsHistogram&, Ice::Long, double = 1.0);
+
+    std::string str() const;
+
+private:
+
+    std::string& addFamily(std::string&, const std::string&);
+
+    std::string _prefix;
+    std::string _labels;
+    std::vector<std::string> _families;
+    std::map<std::string, std::pair<std::string, std::string> > _samples;
+};
+
+//
+// Convert a metrics map name to an OpenMetrics name ("EndpointLookup"
+// is converted to "endpoint_lookup").
+//
+ICE_API std::string toOpenMetricsName(const std::string&);
+
 class ICE_API MetricsMapI;
 ICE_DEFINE_PTR(MetricsMapIPtr, MetricsMapI);
 
@@ -63,6 +301,12 @@ public:
         RegExp(const std::string&, const std::string&);
         ~RegExp();
 
+        const std::string&
+        getAttribute() const
+        {
+            return _attribute;
+        }
+
         template<typename T> bool
         match(const IceMX::MetricsHelperT<T>& helper, bool reject)
         {
@@ -112,10 +356,38 @@ public:
     virtual IceMX::MetricsFailures getFailures(const std::string&) = 0;
     virtual IceMX::MetricsMap getMetrics() const = 0;
 
+    //
+    // Export the given metrics (retrieved with getMetrics) in the
+    // OpenMetrics format using the given family prefix, view name and
+    // parent metrics ID (for sub-maps).
+    //
+    virtual void exportOpenMetrics(OpenMetricsWriter&, const std::string&, const std::string&, const std::string&,
+                                   const IceMX::MetricsMap&) const = 0;
+
     virtual MetricsMapIPtr clone() const = 0;
 
     const Ice::PropertyDict& getProperties() const;
 
+    //
+    // Returns true if the observers of this map should measure the CPU
+    // time consumed by the observed dispatch.
+    //
+    bool isCpuTimeEnabled() const
+    {
+        return _cpuTime;
+    }
+
+    //
+    // Counters updated by observers are accumulated in per-thread
+    // shards which are merged with the entry metrics when the metrics
+    // are retrieved. This returns the shard of the calling thread:
+    // threads are assigned a shard in turn the first time they update
+    // metrics, so they only share a shard if there are more than
+    // ShardCount threads.
+    //
+    enum { ShardCount = 16 };
+    static int getShard();
+
 protected:
 
     const Ice::PropertyDict _properties;
@@ -124,6 +396,8 @@ protected:
     const int _retain;
     const std::vector<RegExpPtr> _accept;
     const std::vector<RegExpPtr> _reject;
+    const bool _histogram;
+    const bool _cpuTime;
 };
 
 class ICE_API MetricsMapFactory
@@ -171,13 +445,18 @@ public:
     public:
 
         EntryT(MetricsMapTPtr map, const TPtr& object, const typename std::list<EntryTPtr>::iterator& p) :
-            _map(map), _object(object), _detachedPos(p)
+            _map(map),
+            _object(object),
+            _current(0),
+            _removed(0),
+            _detachedPos(p),
+            _histogram(map->_histogram ? new MetricsHistogramI() : 0)
         {
         }
 
         ~EntryT()
         {
-            assert(_object->total > 0);
+            delete _histogram;
             for(typename std::map<std::string, std::pair<MetricsMapIPtr, SubMapMember> >::const_iterator p =
                     _subMaps.begin(); p != _subMaps.end(); ++p)
             {
@@ -224,16 +503,18 @@ public:
         void
         detach(Ice::Long lifetime)
         {
-            IceUtil::Mutex::Lock sync(*_map);
-            _object->totalLifetime += lifetime;
-            if(--_object->current == 0)
+            if(_histogram)
             {
-#ifdef ICE_CPP11_MAPPING
-                _map->detached(this->shared_from_this());
-#else
-                _map->detached(this);
-#endif
+                _histogram->record(lifetime); // Lock-free, no need to hold the map mutex.
             }
+
+            {
+                Shard& shard = _shards[MetricsMapI::getShard()];
+                IceUtil::Mutex::Lock sync(shard.mutex);
+                getShardObject(shard)->totalLifetime += lifetime;
+            }
+
+            release();
         }
 
         template<typename Function> void
@@ -243,6 +524,19 @@ public:
             func(_object);
         }
 
+        //
+        // Execute a function which only adds to the metrics counters. The
+        // function is applied to the calling thread shard, without locking
+        // the map mutex.
+        //
+        template<typename Function> void
+        executeOnShard(Function func)
+        {
+            Shard& shard = _shards[MetricsMapI::getShard()];
+            IceUtil::Mutex::Lock sync(shard.mutex);
+            func(getShardObject(shard));
+        }
+
         MetricsMapT*
         getMap()
         {
@@ -251,6 +545,22 @@ public:
 
     private:
 
+        struct Shard
+        {
+            IceUtil::Mutex mutex;
+            TPtr object;
+        };
+
+        const TPtr&
+        getShardObject(Shard& shard)
+        {
+            // Called with the shard mutex locked.
+            if(!shard.object)
+            {
+                shard.object = ICE_MAKE_SHARED(T);
+            }
+            return shard.object;
+        }
 
         IceMX::MetricsFailures
         getFailures() const
@@ -265,40 +575,108 @@ public:
         clone() const
         {
             TPtr metrics = ICE_DYNAMIC_CAST(T, _object->ice_clone());
+            for(int i = 0; i < MetricsMapI::ShardCount; ++i)
+            {
+                IceUtil::Mutex::Lock sync(_shards[i].mutex);
+                if(_shards[i].object)
+                {
+                    mergeMetrics(metrics.get(), _shards[i].object.get()); // Found with ADL.
+                }
+            }
+            metrics->current = _current;
             for(typename std::map<std::string, std::pair<MetricsMapIPtr, SubMapMember> >::const_iterator p =
                     _subMaps.begin(); p != _subMaps.end(); ++p)
             {
                 metrics.get()->*p->second.second = p->second.first->getMetrics();
             }
+            if(_histogram)
+            {
+                metrics->lifetimeHistogram = _histogram->getHistogram();
+            }
             return metrics;
         }
 
         bool
         isDetached() const
         {
-            return _object->current == 0;
+            return _current == 0;
         }
 
-        void
+        bool
         attach(const IceMX::MetricsHelperT<T>& helper)
         {
-            ++_object->total;
-            ++_object->current;
-            helper.initMetrics(_object);
+            //
+            // This doesn't need the map mutex: entries found in the
+            // per-thread cache are attached without locking the map. The
+            // removal of a detached entry marks the entry as removed
+            // before checking if it's attached, so either the removal
+            // sees this observer and keeps the entry, or this sees the
+            // removal and the caller looks up the entry again with the
+            // map mutex locked.
+            //
+            ++_current;
+            if(_removed.load() > 0)
+            {
+                release();
+                return false;
+            }
+            executeOnShard(AttachT(helper));
+            return true;
+        }
+
+        void
+        release()
+        {
+            //
+            // The map mutex is only needed if this was the last observer
+            // attached to the entry. The entry might be attached again
+            // concurrently so we check again once it's acquired.
+            //
+            if(--_current == 0)
+            {
+                IceUtil::Mutex::Lock sync(*_map);
+                if(_current == 0)
+                {
+#ifdef ICE_CPP11_MAPPING
+                    _map->detached(this->shared_from_this());
+#else
+                    _map->detached(this);
+#endif
+                }
+            }
         }
 
+        struct AttachT
+        {
+            AttachT(const IceMX::MetricsHelperT<T>& helper) : _helper(helper)
+            {
+            }
+
+            void operator()(const TPtr& v) const
+            {
+                ++v->total;
+                _helper.initMetrics(v);
+            }
+
+            const IceMX::MetricsHelperT<T>& _helper;
+        };
+
         friend class MetricsMapT;
         MetricsMapTPtr _map;
         TPtr _object;
+        IceUtilInternal::Atomic _current;
+        IceUtilInternal::Atomic _removed;
+        mutable Shard _shards[MetricsMapI::ShardCount];
         IceMX::StringIntDict _failures;
         std::map<std::string, std::pair<MetricsMapIPtr, SubMapMember> > _subMaps;
         typename std::list<EntryTPtr>::iterator _detachedPos;
+        MetricsHistogramI* _histogram;
     };
 
     MetricsMapT(const std::string& mapPrefix,
                 const Ice::PropertiesPtr& properties,
                 const std::map<std::string, std::pair<SubMapMember, MetricsMapFactoryPtr> >& subMaps) :
-        MetricsMapI(mapPrefix, properties), _destroyed(false)
+        MetricsMapI(mapPrefix, properties), _destroyed(false), _cacheable(-1), _cacheId(newMetricsCacheId())
     {
         std::vector<std::string> subMapNames;
         typename std::map<std::string, std::pair<SubMapMember, MetricsMapFactoryPtr> >::const_iterator p;
@@ -324,7 +702,8 @@ public:
         }
     }
 
-    MetricsMapT(const MetricsMapT& other) : MetricsMapI(other), _destroyed(false)
+    MetricsMapT(const MetricsMapT& other) :
+        MetricsMapI(other), _destroyed(false), _cacheable(-1), _cacheId(newMetricsCacheId())
     {
     }
 
@@ -342,6 +721,7 @@ public:
         _destroyed = true;
         _objects.clear(); // Break cyclic reference counts
         _detachedQueue.clear(); // Break cyclic reference counts
+        _cacheId.exchange(newMetricsCacheId()); // Invalidate the cached entries
     }
 
     virtual IceMX::MetricsMap
@@ -357,6 +737,27 @@ public:
         return objects;
     }
 
+    virtual void
+    exportOpenMetrics(OpenMetricsWriter& writer, const std::string& prefix, const std::string& view,
+                      const std::string& parent, const IceMX::MetricsMap& objects) const
+    {
+        for(IceMX::MetricsMap::const_iterator p = objects.begin(); p != objects.end(); ++p)
+        {
+            const T* metrics = dynamic_cast<const T*>(p->get());
+            assert(metrics);
+            writer.setPrefix(prefix);
+            writer.setLabels(view, parent, metrics->id);
+            writeOpenMetrics(writer, metrics); // Found with ADL.
+
+            for(typename std::map<std::string, std::pair<SubMapMember, MetricsMapIPtr> >::const_iterator q =
+                    _subMaps.begin(); q != _subMaps.end(); ++q)
+            {
+                q->second.second->exportOpenMetrics(writer, prefix + '_' + toOpenMetricsName(q->first), view,
+                                                    metrics->id, metrics->*q->second.first);
+            }
+        }
+    }
+
     virtual IceMX::MetricsFailuresSeq
     getFailures()
     {
@@ -401,6 +802,99 @@ public:
 
     EntryTPtr
     getMatching(const IceMX::MetricsHelperT<T>& helper, const EntryTPtr& previous = EntryTPtr())
+    {
+        //
+        // If the helper provides a cache key, first check if the entry
+        // matching the observed object was already computed by this
+        // thread. This avoids the evaluation of the filters and of the
+        // GroupBy attributes, and the locking of the map mutex, for
+        // objects which are observed repeatedly.
+        //
+        MetricsCacheKey cacheKey;
+        bool cached = false;
+        Ice::Long cacheId = 0;
+        if(helper.getCacheKey(cacheKey) && isCacheable(helper))
+        {
+            cached = true;
+            cacheId = _cacheId.load();
+            MetricsCacheEntryPtr entry;
+            if(findMetricsCacheEntry(this, cacheId, cacheKey, entry))
+            {
+#ifdef ICE_CPP11_MAPPING
+                EntryTPtr e = std::static_pointer_cast<EntryT>(entry);
+#else
+                EntryTPtr e = EntryTPtr(static_cast<EntryT*>(entry.get()));
+#endif
+                if(!e || previous == e || e->attach(helper))
+                {
+                    return e;
+                }
+                // The entry was concurrently removed, look it up again.
+            }
+        }
+
+        std::string key;
+        if(!match(helper, key))
+        {
+            if(cached)
+            {
+                addMetricsCacheEntry(this, cacheId, cacheKey, ICE_NULLPTR);
+            }
+            return ICE_NULLPTR;
+        }
+
+        //
+        // Lookup the metrics object.
+        //
+        Lock sync(*this);
+        if(_destroyed)
+        {
+            return ICE_NULLPTR;
+        }
+
+        typename std::map<std::string, EntryTPtr>::const_iterator p = _objects.find(key);
+        if(p == _objects.end())
+        {
+            TPtr t = ICE_MAKE_SHARED(T);
+            t->id = key;
+
+#ifdef ICE_CPP11_MAPPING
+            p = _objects.insert(typename std::map<std::string, EntryTPtr>::value_type(
+                key, std::make_shared<EntryT>(shared_from_this(), t, _detachedQueue.end()))).first;
+#else
+            p = _objects.insert(typename std::map<std::string, EntryTPtr>::value_type(
+                key, new EntryT(this, t, _detachedQueue.end()))).first;
+#endif
+
+        }
+        if(cached)
+        {
+            addMetricsCacheEntry(this, cacheId, cacheKey, p->second);
+        }
+        if(previous != p->second)
+        {
+            //
+            // The entries of the map can't be removed while the map
+            // mutex is locked.
+            //
+#ifndef NDEBUG
+            bool attached =
+#endif
+            p->second->attach(helper);
+            assert(attached);
+        }
+        return p->second;
+    }
+
+private:
+
+    virtual MetricsMapIPtr clone() const
+    {
+        return ICE_MAKE_SHARED(MetricsMapT<MetricsType>, *this);
+    }
+
+    bool
+    match(const IceMX::MetricsHelperT<T>& helper, std::string& key)
     {
         //
         // Check the accept and reject filters.
@@ -409,7 +903,7 @@ public:
         {
             if(!(*p)->match(helper, false))
             {
-                return ICE_NULLPTR;
+                return false;
             }
         }
 
@@ -417,14 +911,13 @@ public:
         {
             if((*p)->match(helper, true))
             {
-                return ICE_NULLPTR;
+                return false;
             }
         }
 
         //
         // Compute the key from the GroupBy property.
         //
-        std::string key;
         try
         {
             if(_groupByAttributes.size() == 1)
@@ -449,55 +942,57 @@ public:
         }
         catch(const std::exception&)
         {
-            return ICE_NULLPTR;
+            return false;
         }
+        return true;
+    }
 
+    bool
+    isCacheable(const IceMX::MetricsHelperT<T>& helper)
+    {
         //
-        // Lookup the metrics object.
+        // The cached entries can only be used if the filters and the
+        // GroupBy attributes don't depend on attributes which vary for
+        // the same cache key (the request context for instance). Only a
+        // single helper type provides cache keys for a given map so this
+        // is computed once.
         //
-        Lock sync(*this);
-        if(_destroyed)
-        {
-            return ICE_NULLPTR;
-        }
-
-        if(previous && previous->_object->id == key)
+        int cacheable = _cacheable.load();
+        if(cacheable < 0)
         {
-            assert(_objects[key] == previous);
-            return previous;
-        }
-
-        typename std::map<std::string, EntryTPtr>::const_iterator p = _objects.find(key);
-        if(p == _objects.end())
-        {
-            TPtr t = ICE_MAKE_SHARED(T);
-            t->id = key;
-
-#ifdef ICE_CPP11_MAPPING
-            p = _objects.insert(typename std::map<std::string, EntryTPtr>::value_type(
-                key, std::make_shared<EntryT>(shared_from_this(), t, _detachedQueue.end()))).first;
-#else
-            p = _objects.insert(typename std::map<std::string, EntryTPtr>::value_type(
-                key, new EntryT(this, t, _detachedQueue.end()))).first;
-#endif
-
+            cacheable = 1;
+            for(std::vector<std::string>::const_iterator p = _groupByAttributes.begin();
+                p != _groupByAttributes.end(); ++p)
+            {
+                if(!helper.isCacheable(*p))
+                {
+                    cacheable = 0;
+                }
+            }
+            for(std::vector<RegExpPtr>::const_iterator p = _accept.begin(); p != _accept.end(); ++p)
+            {
+                if(!helper.isCacheable((*p)->getAttribute()))
+                {
+                    cacheable = 0;
+                }
+            }
+            for(std::vector<RegExpPtr>::const_iterator p = _reject.begin(); p != _reject.end(); ++p)
+            {
+                if(!helper.isCacheable((*p)->getAttribute()))
+                {
+                    cacheable = 0;
+                }
+            }
+            _cacheable.exchange(cacheable);
         }
-        p->second->attach(helper);
-        return p->second;
-    }
-
-private:
-
-    virtual MetricsMapIPtr clone() const
-    {
-        return ICE_MAKE_SHARED(MetricsMapT<MetricsType>, *this);
+        return cacheable > 0;
     }
 
     void detached(EntryTPtr entry)
     {
         // This is called with the map mutex locked.
 
-        if(_retain == 0 || _destroyed)
+        if(_retain == 0 || _destroyed || entry->_removed.load() > 0)
         {
             return;
         }
@@ -534,11 +1029,24 @@ private:
             }
         }
 
+        //
         // If there's still no room, remove the oldest entry (at the front).
-        if(static_cast<int>(_detachedQueue.size()) == _retain)
+        // An entry attached concurrently without locking the map mutex
+        // (see EntryT::attach) is kept and only removed from the queue.
+        //
+        while(static_cast<int>(_detachedQueue.size()) == _retain)
         {
-            _objects.erase(_detachedQueue.front()->_object->id);
+            EntryTPtr oldest = _detachedQueue.front();
             _detachedQueue.pop_front();
+            oldest->_detachedPos = _detachedQueue.end();
+            oldest->_removed.exchange(1);
+            if(oldest->_current.load() > 0)
+            {
+                oldest->_removed.exchange(0);
+                continue;
+            }
+            _objects.erase(oldest->_object->id);
+            _cacheId.exchange(newMetricsCacheId()); // The cached entries might reference the removed entry.
         }
 
         // Add the entry at the back of the queue.
@@ -552,6 +1060,8 @@ private:
     bool _destroyed;
     std::map<std::string, EntryTPtr> _objects;
     std::list<EntryTPtr> _detachedQueue;
+    IceUtilInternal::Atomic _cacheable;
+    IceUtilInternal::Atomic64 _cacheId;
     std::map<std::string, std::pair<SubMapMember, MetricsMapIPtr> > _subMaps;
 };
 
@@ -692,6 +1202,8 @@ public:
 
     const Ice::LoggerPtr& getLogger() const;
 
+    std::string getOpenMetrics();
+
 private:
 
     MetricsViewIPtr getMetricsView(const std::string&);
@@ -137,6 +137,23 @@ template<typename T> struct Add
     T value;
 };
 
+//
+// Add to an optional data member, which is set to the value if it's
+// not set yet.
+//
+template<typename T> struct AddOptional
+{
+    AddOptional(T value) : value(value) { }
+
+    template<typename Y>
+    void operator()(Y& v)
+    {
+        v = (v ? *v : 0) + value;
+    }
+
+    T value;
+};
+
 template<class T, typename Y, typename F> ApplyOnMember<T, Y, F> applyOnMember(Y T::*member, F func)
 {
     return ApplyOnMember<T, Y, F>(member, func);
@@ -147,6 +164,11 @@ template<class T, typename Y, typename V> ApplyOnMember<T, Y, Add<V> > add(Y T::
     return applyOnMember(member, Add<V>(value));
 }
 
+template<class T, typename Y, typename V> ApplyOnMember<T, Y, AddOptional<V> > addOptional(Y T::*member, V value)
+{
+    return applyOnMember(member, AddOptional<V>(value));
+}
+
 template<class T, typename Y> ApplyOnMember<T, Y, Increment<Y> > inc(Y T::*member)
 {
     return applyOnMember(member, Increment<Y>());
@@ -41,6 +41,25 @@ public:
         // To be overriden in specialization to initialize state attributes
     }
 
+    //
+    // To be overriden in specialization for objects which are observed
+    // repeatedly (proxies, connections, ...). The cache key is composed
+    // of the identifiers of the observed objects and of strings which,
+    // together, determine the value of all the attributes for which
+    // isCacheable returns true. The metrics maps use it to cache the
+    // matching entry instead of evaluating the filters and GroupBy
+    // attributes again.
+    //
+    virtual bool getCacheKey(IceInternal::MetricsCacheKey&) const
+    {
+        return false;
+    }
+
+    virtual bool isCacheable(const std::string&) const
+    {
+        return false;
+    }
+
 protected:
 
     template<typename Helper> class AttributeResolverT
@@ -419,6 +438,21 @@ public:
         }
     }
 
+    //
+    // Same as forEach for functions which only add to the metrics
+    // counters (and don't read them), the function is applied to a
+    // per-thread shard of the entry which doesn't require locking the
+    // metrics map.
+    //
+    template<typename Function> void
+    forEachShard(const Function& func)
+    {
+        for(typename EntrySeqType::const_iterator p = _objects.begin(); p != _objects.end(); ++p)
+        {
+            (*p)->executeOnShard(func);
+        }
+    }
+
     void
     init(const MetricsHelperT<MetricsType>& /*helper*/, EntrySeqType& objects, ObserverT* previous = 0)
     {
@@ -456,6 +490,12 @@ public:
         return ICE_NULLPTR;
     }
 
+    const EntrySeqType&
+    getEntries() const
+    {
+        return _objects;
+    }
+
     template<typename ObserverImpl, typename ObserverMetricsType> ICE_INTERNAL_HANDLE<ObserverImpl>
     getObserver(const std::string& mapName, const MetricsHelperT<ObserverMetricsType>& helper)
     {
@@ -518,14 +558,14 @@ public:
     ObserverImplPtrType
     getObserver(const MetricsHelperT<MetricsType>& helper)
     {
-        IceUtil::Mutex::Lock sync(*this);
-        if(!_metrics)
+        MetricsMapsPtr maps = getMaps();
+        if(!maps)
         {
             return ICE_NULLPTR;
         }
 
         typename ObserverImplType::EntrySeqType metricsObjects;
-        for(typename MetricsMapSeqType::const_iterator p = _maps.begin(); p != _maps.end(); ++p)
+        for(typename MetricsMapSeqType::const_iterator p = maps->maps.begin(); p != maps->maps.end(); ++p)
         {
             typename ObserverImplType::EntryPtrType entry = (*p)->getMatching(helper);
             if(entry)
@@ -557,14 +597,15 @@ public:
         {
             return getObserver(helper);
         }
-        IceUtil::Mutex::Lock sync(*this);
-        if(!_metrics)
+
+        MetricsMapsPtr maps = getMaps();
+        if(!maps)
         {
             return ICE_NULLPTR;
         }
 
         typename ObserverImplType::EntrySeqType metricsObjects;
-        for(typename MetricsMapSeqType::const_iterator p = _maps.begin(); p != _maps.end(); ++p)
+        for(typename MetricsMapSeqType::const_iterator p = maps->maps.begin(); p != maps->maps.end(); ++p)
         {
             typename ObserverImplType::EntryPtrType entry = (*p)->getMatching(helper, old->getEntry(p->get()));
             if(entry)
@@ -606,17 +647,18 @@ public:
             }
 
             std::vector<IceInternal::MetricsMapIPtr> maps = _metrics->getMaps(_name);
-            _maps.clear();
+            MetricsMapsPtr newMaps = new MetricsMaps();
             for(std::vector<IceInternal::MetricsMapIPtr>::const_iterator p = maps.begin(); p != maps.end(); ++p)
             {
 #ifdef ICE_CPP11_MAPPING
-                _maps.push_back(::std::dynamic_pointer_cast<IceInternal::MetricsMapT<MetricsType>>(*p));
+                newMaps->maps.push_back(::std::dynamic_pointer_cast<IceInternal::MetricsMapT<MetricsType>>(*p));
 #else
-                _maps.push_back(IceUtil::Handle<IceInternal::MetricsMapT<MetricsType> >::dynamicCast(*p));
+                newMaps->maps.push_back(IceUtil::Handle<IceInternal::MetricsMapT<MetricsType> >::dynamicCast(*p));
 #endif
-                assert(_maps.back());
+                assert(newMaps->maps.back());
             }
-            _enabled.exchange(_maps.empty() ? 0 : 1);
+            _maps = newMaps;
+            _enabled.exchange(maps.empty() ? 0 : 1);
             updater = _updater;
         }
 
@@ -636,14 +678,34 @@ public:
     {
         IceUtil::Mutex::Lock sync(*this);
         _metrics = 0;
-        _maps.clear();
+        _maps = 0;
     }
 
 private:
 
+    //
+    // The maps are replaced rather than updated when the configuration
+    // changes: observers are created with the maps obtained from
+    // getMaps() without holding the factory mutex while the maps are
+    // looked up.
+    //
+    class MetricsMaps : public IceUtil::Shared
+    {
+    public:
+
+        MetricsMapSeqType maps;
+    };
+    typedef IceUtil::Handle<MetricsMaps> MetricsMapsPtr;
+
+    MetricsMapsPtr getMaps()
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        return _maps;
+    }
+
     IceInternal::MetricsAdminIPtr _metrics;
     const std::string _name;
-    MetricsMapSeqType _maps;
+    MetricsMapsPtr _maps;
     //
     // TODO: Replace by std::atomic<bool> when it becomes widely
     // available.
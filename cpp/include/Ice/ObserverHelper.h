@@ -125,6 +125,16 @@ public:
             _observer->reply(size);
         }
     }
+
+    void queued(Ice::Long time)
+    {
+        Ice::Instrumentation::DispatchQueueObserver* observer =
+            dynamic_cast<Ice::Instrumentation::DispatchQueueObserver*>(_observer.get());
+        if(observer)
+        {
+            observer->queued(time);
+        }
+    }
 };
 
 class ICE_API InvocationObserver : public ObserverHelperT<Ice::Instrumentation::InvocationObserver>
@@ -22,6 +22,8 @@
 #include <Ice/InputStream.h>
 #include <Ice/ObserverHelper.h>
 #include <Ice/LocalException.h>
+#include <Ice/ThreadCache.h>
+#include <Ice/RequestBody.h>
 #include <IceUtil/UniquePtr.h>
 
 #ifndef ICE_CPP11_MAPPING
@@ -66,6 +68,19 @@ class ICE_API OutgoingAsyncBase : virtual public OutgoingAsyncCompletionCallback
 {
 public:
 
+    //
+    // Invocation objects are recycled by the thread cache.
+    //
+    static void* operator new(size_t size)
+    {
+        return ThreadCache::allocate(size);
+    }
+
+    static void operator delete(void* p, size_t size)
+    {
+        ThreadCache::deallocate(p, size);
+    }
+
     virtual bool sent();
     virtual bool exception(const Ice::Exception&);
     virtual bool response();
@@ -111,7 +126,8 @@ public:
 
     void attachRemoteObserver(const Ice::ConnectionInfoPtr& c, const Ice::EndpointPtr& endpt, Ice::Int requestId)
     {
-        const Ice::Int size = static_cast<Ice::Int>(_os.b.size() - headerSize - 4);
+        const Ice::Int size = static_cast<Ice::Int>(_os.b.size() - headerSize - 4 +
+                                                    (_requestBody ? _requestBody->size() : 0));
         _childObserver.attach(getObserver().getRemoteObserver(c, endpt, requestId, size));
     }
 
@@ -126,6 +142,25 @@ public:
         return &_os;
     }
 
+    //
+    // The shared request body sent after the request stream, if any.
+    // The request handlers which can't send it separately call
+    // writeRequestBody() to copy it at the end of the request stream.
+    //
+    const RequestBodyPtr& getRequestBody() const
+    {
+        return _requestBody;
+    }
+
+    void writeRequestBody()
+    {
+        if(_requestBody)
+        {
+            _os.writeBlob(_requestBody->begin(), _requestBody->size());
+            _requestBody = 0;
+        }
+    }
+
     Ice::InputStream* getIs()
     {
         return &_is;
@@ -176,6 +211,7 @@ protected:
     ObserverHelperT<Ice::Instrumentation::ChildInvocationObserver> _childObserver;
 
     Ice::OutputStream _os;
+    RequestBodyPtr _requestBody;
     Ice::InputStream _is;
 
     CancellationHandlerPtr _cancellationHandler;
@@ -214,6 +250,11 @@ public:
     {
         return std::static_pointer_cast<ProxyOutgoingAsyncBase>(OutgoingAsyncBase::shared_from_this());
     }
+
+    const Ice::ObjectPrxPtr& getProxy() const
+    {
+        return _proxy;
+    }
 #else
     virtual Ice::ObjectPrx getProxy() const;
     virtual Ice::CommunicatorPtr getCommunicator() const;
@@ -234,9 +275,12 @@ protected:
     const Ice::ObjectPrxPtr _proxy;
     RequestHandlerPtr _handler;
     Ice::OperationMode _mode;
+    InvocationHedgePtr _hedge;
 
 private:
 
+    friend class InvocationHedge;
+
     int _cnt;
     bool _sent;
 };
@@ -251,6 +295,7 @@ public:
     OutgoingAsync(const Ice::ObjectPrxPtr&, bool);
 
     void prepare(const std::string&, Ice::OperationMode, const Ice::Context&);
+    void prepare(const RequestBodyPtr&);
 
     virtual bool sent();
     virtual bool response();
@@ -419,11 +464,36 @@ protected:
     std::function<void(bool)> _response;
 };
 
+//
+// Standard promises allocate their shared state from the thread cache.
+//
+template<typename Promise>
+struct PromiseFactory
+{
+    static Promise create()
+    {
+        return Promise();
+    }
+};
+
+template<typename T>
+struct PromiseFactory<std::promise<T>>
+{
+    static std::promise<T> create()
+    {
+        return std::promise<T>(std::allocator_arg, ThreadCacheAllocator<char>());
+    }
+};
+
 template<typename Promise>
 class PromiseInvoke : virtual public OutgoingAsyncCompletionCallback
 {
 public:
 
+    PromiseInvoke() : _promise(PromiseFactory<Promise>::create())
+    {
+    }
+
     auto
     getFuture() -> decltype(std::declval<Promise>().get_future())
     {
@@ -608,7 +608,9 @@ protected:
     auto makePromiseOutgoing(bool sync, Obj obj, Fn fn, Args&&... args)
         -> decltype(std::declval<P<R>>().get_future())
     {
-        auto outAsync = ::std::make_shared<::IceInternal::PromiseOutgoing<P<R>, R>>(shared_from_this(), sync);
+        using Outgoing = ::IceInternal::PromiseOutgoing<P<R>, R>;
+        auto outAsync = ::std::allocate_shared<Outgoing>(::IceInternal::ThreadCacheAllocator<Outgoing>(),
+                                                         shared_from_this(), sync);
         (obj->*fn)(outAsync, std::forward<Args>(args)...);
         return outAsync->getFuture();
     }
@@ -616,7 +618,9 @@ protected:
     template<typename R, typename Re, typename E, typename S, typename Obj, typename Fn, typename... Args>
     ::std::function<void()> makeLambdaOutgoing(Re r, E e, S s, Obj obj, Fn fn, Args&&... args)
     {
-        auto outAsync = ::std::make_shared<::IceInternal::LambdaOutgoing<R>>(shared_from_this(), r, e, s);
+        using Outgoing = ::IceInternal::LambdaOutgoing<R>;
+        auto outAsync = ::std::allocate_shared<Outgoing>(::IceInternal::ThreadCacheAllocator<Outgoing>(),
+                                                         shared_from_this(), r, e, s);
         (obj->*fn)(outAsync, std::forward<Args>(args)...);
         return [outAsync]() { outAsync->cancel(); };
     }
@@ -1250,6 +1254,34 @@ public:
 
     bool ___end_ice_invoke(::std::pair<const ::Ice::Byte*, const ::Ice::Byte*>&, const ::Ice::AsyncResultPtr&);
 
+    //
+    // ice_invoke with a request body encoded once to be sent to several
+    // proxies, the result is retrieved with end_ice_invoke.
+    //
+    bool ice_invoke(const ::IceInternal::RequestBodyPtr& body, ::std::vector< ::Ice::Byte>& outParams)
+    {
+        return end_ice_invoke(outParams, __begin_ice_invoke(body, ::IceInternal::__dummyCallback, 0, true));
+    }
+
+    ::Ice::AsyncResultPtr begin_ice_invoke(const ::IceInternal::RequestBodyPtr& body)
+    {
+        return __begin_ice_invoke(body, ::IceInternal::__dummyCallback, 0);
+    }
+
+    ::Ice::AsyncResultPtr begin_ice_invoke(const ::IceInternal::RequestBodyPtr& body,
+                                           const ::Ice::CallbackPtr& del,
+                                           const ::Ice::LocalObjectPtr& cookie = 0)
+    {
+        return __begin_ice_invoke(body, del, cookie);
+    }
+
+    ::Ice::AsyncResultPtr begin_ice_invoke(const ::IceInternal::RequestBodyPtr& body,
+                                           const ::Ice::Callback_Object_ice_invokePtr& del,
+                                           const ::Ice::LocalObjectPtr& cookie = 0)
+    {
+        return __begin_ice_invoke(body, del, cookie);
+    }
+
     ::Ice::Identity ice_getIdentity() const;
     ::Ice::ObjectPrx ice_identity(const ::Ice::Identity&) const;
 
@@ -1425,6 +1457,11 @@ private:
                                              const ::Ice::LocalObjectPtr&,
                                              bool = false);
 
+    ::Ice::AsyncResultPtr __begin_ice_invoke(const ::IceInternal::RequestBodyPtr&,
+                                             const ::IceInternal::CallbackBasePtr&,
+                                             const ::Ice::LocalObjectPtr&,
+                                             bool = false);
+
     ::Ice::AsyncResultPtr __begin_ice_getConnection(const ::IceInternal::CallbackBasePtr&,
                                                     const ::Ice::LocalObjectPtr&);
 
@@ -0,0 +1,88 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_REQUEST_BODY_H
+#define ICE_REQUEST_BODY_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Handle.h>
+#include <Ice/CommunicatorF.h>
+#include <Ice/Current.h>
+
+namespace IceInternal
+{
+
+//
+// The body of a request, that is the operation, mode, context and
+// parameter encapsulation, encoded once to be sent to several
+// proxies. The connections write the body directly from this object
+// after the request header which is specific to each proxy instead of
+// copying it into the request stream, the body must therefore not be
+// modified once created.
+//
+class ICE_API RequestBody : public IceUtil::Shared
+{
+public:
+
+    RequestBody(const Ice::CommunicatorPtr&, const std::string&, Ice::OperationMode,
+                const std::pair<const Ice::Byte*, const Ice::Byte*>&, const Ice::Context&);
+
+    const std::string& getOperation() const
+    {
+        return _operation;
+    }
+
+    Ice::OperationMode getMode() const
+    {
+        return _mode;
+    }
+
+    const Ice::Context& getContext() const
+    {
+        return _context;
+    }
+
+    std::pair<const Ice::Byte*, const Ice::Byte*> getParamEncaps() const
+    {
+        return std::pair<const Ice::Byte*, const Ice::Byte*>(begin() + _encapsPos, end());
+    }
+
+    //
+    // The encoded body, which ends with the parameter encapsulation. An
+    // empty encapsulation isn't encoded since its encoding depends on
+    // the proxy, such a body is always copied into the request stream.
+    //
+    const Ice::Byte* begin() const
+    {
+        return _bytes.empty() ? 0 : &_bytes[0];
+    }
+
+    const Ice::Byte* end() const
+    {
+        return begin() + _bytes.size();
+    }
+
+    size_t size() const
+    {
+        return _bytes.size();
+    }
+
+private:
+
+    const std::string _operation;
+    const Ice::OperationMode _mode;
+    const Ice::Context _context;
+    std::vector<Ice::Byte> _bytes;
+    size_t _encapsPos;
+};
+typedef IceUtil::Handle<RequestBody> RequestBodyPtr;
+
+}
+
+#endif
@@ -0,0 +1,147 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_THREAD_CACHE_H
+#define ICE_THREAD_CACHE_H
+
+#include <Ice/Config.h>
+#include <new>
+#include <limits>
+
+namespace IceInternal
+{
+
+//
+// Per-thread cache of small memory blocks and stream buffers. It
+// recycles the memory of the invocation objects, of their stream
+// buffers and of the connection request map entries so that steady
+// state invocations don't call malloc.
+//
+// The blocks released by a thread which doesn't allocate them (such
+// as a thread pool thread processing replies) are returned in batches
+// to a shared depot where the other threads pick them up.
+//
+// All the memory is obtained with malloc: a block or a buffer can
+// always be released with free instead.
+//
+namespace ThreadCache
+{
+
+//
+// Allocate or release a block of the given size. Blocks larger than
+// the largest size class are allocated with malloc.
+//
+ICE_API void* allocate(size_t);
+ICE_API void deallocate(void*, size_t);
+
+//
+// Return a cached buffer with a capacity of at least the given size
+// and set its capacity or return 0 if no buffer is cached. Release a
+// buffer to the cache, false is returned if the buffer isn't cached
+// and must be released by the caller.
+//
+ICE_API void* allocateBuffer(size_t, size_t&);
+ICE_API bool deallocateBuffer(void*, size_t);
+
+//
+// Release the calling thread's cache, this is called when a thread
+// terminates on Windows.
+//
+ICE_API void cleanupThread();
+
+}
+
+//
+// Standard allocator using the thread cache.
+//
+template<typename T>
+class ThreadCacheAllocator
+{
+public:
+
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+
+    template<typename U>
+    struct rebind
+    {
+        typedef ThreadCacheAllocator<U> other;
+    };
+
+    ThreadCacheAllocator()
+    {
+    }
+
+    template<typename U>
+    ThreadCacheAllocator(const ThreadCacheAllocator<U>&)
+    {
+    }
+
+    pointer address(reference r) const
+    {
+        return &r;
+    }
+
+    const_pointer address(const_reference r) const
+    {
+        return &r;
+    }
+
+    pointer allocate(size_type n, const void* = 0)
+    {
+        if(n > max_size())
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<pointer>(ThreadCache::allocate(n * sizeof(T)));
+    }
+
+    void deallocate(pointer p, size_type n)
+    {
+        ThreadCache::deallocate(p, n * sizeof(T));
+    }
+
+    size_type max_size() const
+    {
+        return std::numeric_limits<size_type>::max() / sizeof(T);
+    }
+
+    void construct(pointer p, const T& v)
+    {
+        new(static_cast<void*>(p)) T(v);
+    }
+
+    void destroy(pointer p)
+    {
+        p->~T();
+    }
+};
+
+template<typename T, typename U>
+inline bool
+operator==(const ThreadCacheAllocator<T>&, const ThreadCacheAllocator<U>&)
+{
+    return true;
+}
+
+template<typename T, typename U>
+inline bool
+operator!=(const ThreadCacheAllocator<T>&, const ThreadCacheAllocator<U>&)
+{
+    return false;
+}
+
+}
+
+#endif
@@ -181,6 +181,120 @@ private:
 
 #endif
 
+//
+// 64-bit counterpart of Atomic, used for counters which can overflow
+// 32 bits (such as the IceMX metrics histograms).
+//
+#ifdef ICE_CPP11_COMPILER_HAS_ATOMIC
+typedef std::atomic<IceUtil::Int64> Atomic64;
+#else
+
+class ICE_API Atomic64 : public IceUtil::noncopyable
+{
+public:
+
+    Atomic64() :
+        _value(0)
+    {
+    }
+
+    Atomic64(IceUtil::Int64 desired) :
+        _value(desired)
+    {
+    }
+
+    inline IceUtil::Int64 fetch_add(IceUtil::Int64 value)
+    {
+#if defined(_WIN32)
+        return InterlockedExchangeAdd64(&_value, value);
+#elif defined(ICE_HAS_GCC_BUILTINS)
+        return __sync_fetch_and_add(&_value, value);
+#else
+        IceUtil::Mutex::Lock sync(_mutex);
+        IceUtil::Int64 tmp = _value;
+        _value += value;
+        return tmp;
+#endif
+    }
+
+    inline IceUtil::Int64 load() const
+    {
+#if defined(_WIN32)
+        return InterlockedCompareExchange64(const_cast<volatile LONGLONG*>(&_value), 0, 0);
+#elif defined(ICE_HAS_GCC_BUILTINS)
+        return __sync_fetch_and_add(const_cast<IceUtil::Int64*>(&_value), 0);
+#else
+        IceUtil::Mutex::Lock sync(_mutex);
+        return _value;
+#endif
+    }
+
+    inline void store(IceUtil::Int64 value)
+    {
+        exchange(value);
+    }
+
+    inline IceUtil::Int64 exchange(IceUtil::Int64 value)
+    {
+#if defined(_WIN32)
+        return InterlockedExchange64(&_value, value);
+#elif defined(ICE_HAS_GCC_BUILTINS)
+        __sync_synchronize();
+        return __sync_lock_test_and_set(&_value, value);
+#else
+        IceUtil::Mutex::Lock sync(_mutex);
+        IceUtil::Int64 tmp = _value;
+        _value = value;
+        return tmp;
+#endif
+    }
+
+    inline bool compare_exchange_strong(IceUtil::Int64& expected, IceUtil::Int64 desired)
+    {
+#if defined(_WIN32)
+        IceUtil::Int64 previous = InterlockedCompareExchange64(&_value, desired, expected);
+#elif defined(ICE_HAS_GCC_BUILTINS)
+        IceUtil::Int64 previous = __sync_val_compare_and_swap(&_value, expected, desired);
+#else
+        IceUtil::Mutex::Lock sync(_mutex);
+        IceUtil::Int64 previous = _value;
+        if(previous == expected)
+        {
+            _value = desired;
+        }
+#endif
+        if(previous == expected)
+        {
+            return true;
+        }
+        expected = previous;
+        return false;
+    }
+
+    inline bool compare_exchange_weak(IceUtil::Int64& expected, IceUtil::Int64 desired)
+    {
+        return compare_exchange_strong(expected, desired);
+    }
+
+    inline operator IceUtil::Int64() const
+    {
+        return load();
+    }
+
+private:
+
+#if defined(_WIN32)
+    volatile LONGLONG _value;
+#else
+    IceUtil::Int64 _value;
+#endif
+#if !defined(_WIN32) && !defined(ICE_HAS_GCC_BUILTINS)
+    mutable IceUtil::Mutex _mutex;
+#endif
+};
+
+#endif
+
 }
 
 #endif
@@ -29,7 +29,11 @@ public:
     // automatically generated copy constructor and assignment
     // operator do the right thing.
 
-    enum Clock { Realtime, Monotonic };
+    //
+    // ThreadCpu is the CPU time consumed by the calling thread, it's
+    // always 0 on platforms which don't provide it.
+    //
+    enum Clock { Realtime, Monotonic, ThreadCpu };
     static Time now(Clock = Realtime);
 
     static Time seconds(Int64);
@@ -164,18 +164,18 @@ SessionObserverI::overridden(bool client)
 {
     if(client)
     {
-        forEach(inc(&SessionMetrics::overriddenClient));
+        forEachShard(inc(&SessionMetrics::overriddenClient));
     }
     else
     {
-        forEach(inc(&SessionMetrics::overriddenServer));
+        forEachShard(inc(&SessionMetrics::overriddenServer));
     }
 }
 
 void
 SessionObserverI::routingTableSize(int delta)
 {
-    forEach(add(&SessionMetrics::routingTableSize, delta));
+    forEachShard(add(&SessionMetrics::routingTableSize, delta));
 }
 
 RouterObserverI::RouterObserverI(const IceInternal::MetricsAdminIPtr& metrics, const string& instanceName) : 
@@ -15,6 +15,37 @@
 #include <Glacier2/Instrumentation.h>
 #include <Glacier2/Metrics.h>
 
+namespace IceMX
+{
+
+inline void
+mergeMetrics(SessionMetrics* m, const SessionMetrics* shard)
+{
+    mergeMetrics(static_cast<Metrics*>(m), shard);
+    m->forwardedClient += shard->forwardedClient;
+    m->forwardedServer += shard->forwardedServer;
+    m->routingTableSize += shard->routingTableSize;
+    m->queuedClient += shard->queuedClient;
+    m->queuedServer += shard->queuedServer;
+    m->overriddenClient += shard->overriddenClient;
+    m->overriddenServer += shard->overriddenServer;
+}
+
+inline void
+writeOpenMetrics(IceInternal::OpenMetricsWriter& writer, const SessionMetrics* m)
+{
+    writeOpenMetrics(writer, static_cast<const Metrics*>(m));
+    writer.counter("forwarded_client", m->forwardedClient);
+    writer.counter("forwarded_server", m->forwardedServer);
+    writer.gauge("routing_table_size", m->routingTableSize);
+    writer.gauge("queued_client", m->queuedClient);
+    writer.gauge("queued_server", m->queuedServer);
+    writer.counter("overridden_client", m->overriddenClient);
+    writer.counter("overridden_server", m->overriddenServer);
+}
+
+}
+
 namespace Glacier2
 {
 
@@ -0,0 +1,279 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/AdmissionControl.h>
+#include <Ice/ConnectionI.h>
+#include <Ice/Instance.h>
+#include <Ice/Properties.h>
+#include <Ice/LocalException.h>
+#include <IceUtil/StringUtil.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(AdmissionControl* p) { return p; }
+
+IceInternal::QueuedMessage::QueuedMessage(const ConnectionIPtr& connection, Int requests, bool priority) :
+    DispatchWorkItem(connection),
+    _connectionI(connection),
+    _requests(requests),
+    _priority(priority),
+    _queued(IceUtil::Time::now(IceUtil::Time::Monotonic)),
+    _rejected(false)
+{
+}
+
+AdmissionControlPtr
+IceInternal::AdmissionControl::create(const InstancePtr& instance, const string& name)
+{
+    PropertiesPtr properties = instance->initializationData().properties;
+    int maxDispatches = properties->getPropertyAsInt(name + ".MaxDispatches");
+    if(maxDispatches <= 0)
+    {
+        return 0;
+    }
+
+    int maxQueued = properties->getPropertyAsInt(name + ".MaxQueuedRequests");
+    if(maxQueued < 0)
+    {
+        maxQueued = 0;
+    }
+
+    Policy policy;
+    string policyName = properties->getPropertyWithDefault(name + ".OverloadPolicy", "Reject");
+    if(policyName == "Reject")
+    {
+        policy = PolicyReject;
+    }
+    else if(policyName == "Pause")
+    {
+        policy = PolicyPause;
+    }
+    else if(policyName == "Shed")
+    {
+        policy = PolicyShed;
+    }
+    else
+    {
+        InitializationException ex(__FILE__, __LINE__);
+        ex.reason = "invalid overload policy `" + policyName + "' for object adapter `" + name + "'";
+        throw ex;
+    }
+
+    int priorityDispatches = properties->getPropertyAsInt(name + ".PriorityDispatches");
+    if(priorityDispatches < 0)
+    {
+        priorityDispatches = 0;
+    }
+
+    string operations = properties->getPropertyWithDefault(name + ".PriorityOperations", "ice_ping");
+    vector<string> priorityOperations;
+    IceUtilInternal::splitString(operations, ", \t\r\n", priorityOperations);
+
+    vector<string> priorityFacets;
+    IceUtilInternal::splitString(properties->getProperty(name + ".PriorityFacets"), ", \t\r\n", priorityFacets);
+
+    return new AdmissionControl(maxDispatches, maxQueued, policy, priorityDispatches,
+                                set<string>(priorityOperations.begin(), priorityOperations.end()),
+                                set<string>(priorityFacets.begin(), priorityFacets.end()));
+}
+
+IceInternal::AdmissionControl::AdmissionControl(int maxDispatches, int maxQueued, Policy policy,
+                                                int priorityDispatches, const set<string>& priorityOperations,
+                                                const set<string>& priorityFacets) :
+    _maxDispatches(maxDispatches),
+    _maxQueued(static_cast<size_t>(maxQueued)),
+    _policy(policy),
+    _maxPriorityDispatches(maxDispatches + priorityDispatches),
+    _priorityOperations(priorityOperations),
+    _priorityFacets(priorityFacets),
+    _dispatching(0)
+{
+}
+
+bool
+IceInternal::AdmissionControl::isPriority(InputStream& stream) const
+{
+    if(_priorityOperations.empty() && _priorityFacets.empty())
+    {
+        return false;
+    }
+
+    //
+    // Peek at the request header: a request is a priority request if
+    // its operation or its facet is configured as a priority operation
+    // or facet. The priority is only selected by the server
+    // configuration, the request context isn't read.
+    //
+    InputStream::Container::iterator start = stream.i;
+    bool priority = false;
+    try
+    {
+        stream.skip(stream.readSize()); // Identity name.
+        stream.skip(stream.readSize()); // Identity category.
+        if(_priorityFacets.empty())
+        {
+            for(Int sz = stream.readSize(); sz > 0; --sz)
+            {
+                stream.skip(stream.readSize());
+            }
+        }
+        else
+        {
+            vector<string> facetPath;
+            stream.read(facetPath);
+            priority = !facetPath.empty() && _priorityFacets.find(facetPath[0]) != _priorityFacets.end();
+        }
+        if(!priority && !_priorityOperations.empty())
+        {
+            string operation;
+            stream.read(operation, false);
+            priority = _priorityOperations.find(operation) != _priorityOperations.end();
+        }
+    }
+    catch(const LocalException&)
+    {
+        // Invalid request header, the dispatch reports the error.
+    }
+    stream.i = start;
+    return priority;
+}
+
+AdmissionControl::Admission
+IceInternal::AdmissionControl::admit(Int requests, bool priority)
+{
+    Lock sync(*this);
+    if(_dispatching < (priority ? _maxPriorityDispatches : _maxDispatches))
+    {
+        _dispatching += requests;
+        return AdmissionDispatch;
+    }
+    else if((priority ? _priorityQueue : _queue).size() < _maxQueued || _policy != PolicyReject)
+    {
+        return AdmissionQueue;
+    }
+    else
+    {
+        //
+        // The rejected requests are counted until the rejection is
+        // sent like any other dispatch.
+        //
+        _dispatching += requests;
+        return AdmissionReject;
+    }
+}
+
+bool
+IceInternal::AdmissionControl::queue(const QueuedMessagePtr& message)
+{
+    QueuedMessagePtr shed;
+    {
+        Lock sync(*this);
+        if(_dispatching < (message->priority() ? _maxPriorityDispatches : _maxDispatches))
+        {
+            //
+            // A dispatch completed since the message was refused.
+            //
+            _dispatching += message->requests();
+            return false;
+        }
+
+        //
+        // The priority requests have their own queue, with the same
+        // limit and overload policy.
+        //
+        deque<QueuedMessagePtr>& queue = message->priority() ? _priorityQueue : _queue;
+        queue.push_back(message);
+        if(queue.size() > _maxQueued)
+        {
+            if(_policy == PolicyShed)
+            {
+                shed = queue.front();
+                queue.pop_front();
+                _dispatching += shed->requests();
+                shed->reject();
+            }
+            else
+            {
+                assert(_policy == PolicyPause);
+                if(message->connection()->pauseReading())
+                {
+                    _paused.push_back(message->connection());
+                }
+            }
+        }
+    }
+
+    //
+    // Messages are scheduled without the mutex locked, the connection
+    // calls finished() if the thread pool is destroyed.
+    //
+    if(shed)
+    {
+        shed->schedule();
+    }
+    return true;
+}
+
+void
+IceInternal::AdmissionControl::finished(Int requests)
+{
+    vector<QueuedMessagePtr> admitted;
+    vector<ConnectionIPtr> resumed;
+    {
+        Lock sync(*this);
+        _dispatching -= requests;
+        assert(_dispatching >= 0);
+        while(_dispatching < _maxPriorityDispatches && !_priorityQueue.empty())
+        {
+            admitted.push_back(pop(_priorityQueue));
+        }
+        while(_dispatching < _maxDispatches && !_queue.empty())
+        {
+            admitted.push_back(pop(_queue));
+        }
+
+        if(!_paused.empty() && _queue.size() <= _maxQueued && _priorityQueue.size() <= _maxQueued)
+        {
+            resumed.swap(_paused);
+        }
+    }
+
+    for(vector<QueuedMessagePtr>::const_iterator p = admitted.begin(); p != admitted.end(); ++p)
+    {
+        (*p)->schedule();
+    }
+
+    for(vector<ConnectionIPtr>::const_iterator p = resumed.begin(); p != resumed.end(); ++p)
+    {
+        (*p)->resumeReading();
+    }
+}
+
+QueuedMessagePtr
+IceInternal::AdmissionControl::pop(deque<QueuedMessagePtr>& queue)
+{
+    //
+    // With the Shed policy, the newest requests are dispatched first.
+    //
+    QueuedMessagePtr message;
+    if(_policy == PolicyShed)
+    {
+        message = queue.back();
+        queue.pop_back();
+    }
+    else
+    {
+        message = queue.front();
+        queue.pop_front();
+    }
+    _dispatching += message->requests();
+    return message;
+}
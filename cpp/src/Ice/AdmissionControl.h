@@ -0,0 +1,176 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_ADMISSION_CONTROL_H
+#define ICE_ADMISSION_CONTROL_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+#include <Ice/ThreadPool.h>
+#include <Ice/InputStream.h>
+#include <Ice/ConnectionIF.h>
+#include <Ice/AdmissionControlF.h>
+#include <Ice/InstanceF.h>
+
+#include <deque>
+#include <set>
+
+namespace IceInternal
+{
+
+//
+// A message received by a connection while its object adapter
+// reached its limit of concurrent dispatches. Once admitted, or if
+// rejected, the message is dispatched with the thread pool of the
+// connection.
+//
+class QueuedMessage : public DispatchWorkItem
+{
+public:
+
+    QueuedMessage(const Ice::ConnectionIPtr&, Ice::Int, bool);
+
+    const Ice::ConnectionIPtr& connection() const
+    {
+        return _connectionI;
+    }
+
+    Ice::Int requests() const
+    {
+        return _requests;
+    }
+
+    bool priority() const
+    {
+        return _priority;
+    }
+
+    //
+    // The time spent by the message in the queue.
+    //
+    IceUtil::Time queueTime() const
+    {
+        return IceUtil::Time::now(IceUtil::Time::Monotonic) - _queued;
+    }
+
+    bool rejected() const
+    {
+        return _rejected;
+    }
+
+    void reject()
+    {
+        _rejected = true;
+    }
+
+    //
+    // Queue the message with the thread pool of the connection.
+    //
+    virtual void schedule() = 0;
+
+private:
+
+    const Ice::ConnectionIPtr _connectionI;
+    const Ice::Int _requests;
+    const bool _priority;
+    const IceUtil::Time _queued;
+    bool _rejected;
+};
+typedef IceUtil::Handle<QueuedMessage> QueuedMessagePtr;
+
+//
+// Limits the number of concurrent dispatches of an object adapter.
+// The requests received while the limit is reached are queued and
+// once the queue is full, the overload policy of the adapter either
+// rejects the new requests, stops reading from the connections until
+// the queue drains or sheds the oldest queued request. With the Shed
+// policy, the newest requests are dispatched first since their client
+// is the most likely to still wait for the reply.
+//
+// A dispatch is complete once its reply is sent, the requests of a
+// batch are admitted together.
+//
+// Priority requests, such as health checks, are admitted before the
+// other queued requests and can use additional dispatches reserved
+// for them. The priority requests are selected by their operation or
+// facet, they are queued separately and the same limit and overload
+// policy apply to their queue.
+//
+class AdmissionControl : public IceUtil::Shared, private IceUtil::Mutex
+{
+public:
+
+    enum Policy
+    {
+        PolicyReject,
+        PolicyPause,
+        PolicyShed
+    };
+
+    enum Admission
+    {
+        AdmissionDispatch,
+        AdmissionReject,
+        AdmissionQueue
+    };
+
+    //
+    // Returns null if the adapter doesn't limit its dispatches.
+    //
+    static AdmissionControlPtr create(const InstancePtr&, const std::string&);
+
+    AdmissionControl(int, int, Policy, int, const std::set<std::string>&, const std::set<std::string>&);
+
+    //
+    // Returns true if the request read next from the stream is a
+    // priority request. The stream position is not changed, only the
+    // request header up to the operation name is read.
+    //
+    bool isPriority(Ice::InputStream&) const;
+
+    //
+    // Called by the connection before dispatching a message. If the
+    // message must be queued, the connection creates the queued
+    // message and calls queue().
+    //
+    Admission admit(Ice::Int, bool);
+
+    //
+    // Returns false if the message can be dispatched now.
+    //
+    bool queue(const QueuedMessagePtr&);
+
+    //
+    // Called by the connection once it sent the replies of the given
+    // number of requests, this must be called without the connection
+    // locked.
+    //
+    void finished(Ice::Int);
+
+private:
+
+    QueuedMessagePtr pop(std::deque<QueuedMessagePtr>&);
+
+    const int _maxDispatches;
+    const size_t _maxQueued;
+    const Policy _policy;
+    const int _maxPriorityDispatches;
+    const std::set<std::string> _priorityOperations;
+    const std::set<std::string> _priorityFacets;
+
+    int _dispatching;
+    std::deque<QueuedMessagePtr> _queue;
+    std::deque<QueuedMessagePtr> _priorityQueue;
+    std::vector<Ice::ConnectionIPtr> _paused;
+};
+
+}
+
+#endif
@@ -0,0 +1,24 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_ADMISSION_CONTROL_F_H
+#define ICE_ADMISSION_CONTROL_F_H
+
+#include <Ice/Handle.h>
+
+namespace IceInternal
+{
+
+class AdmissionControl;
+IceUtil::Shared* upCast(AdmissionControl*);
+typedef Handle<AdmissionControl> AdmissionControlPtr;
+
+}
+
+#endif
@@ -9,6 +9,7 @@
 
 #include <Ice/Buffer.h>
 #include <Ice/LocalException.h>
+#include <Ice/ThreadCache.h>
 
 using namespace std;
 using namespace Ice;
@@ -86,7 +87,7 @@ IceInternal::Buffer::Container::Container(Container& other, bool adopt)
 
 IceInternal::Buffer::Container::~Container()
 {
-    if(_buf && _owned)
+    if(_buf && _owned && !ThreadCache::deallocateBuffer(_buf, _capacity))
     {
         ::free(_buf);
     }
@@ -105,7 +106,7 @@ IceInternal::Buffer::Container::swap(Container& other)
 void
 IceInternal::Buffer::Container::clear()
 {
-    if(_buf && _owned)
+    if(_buf && _owned && !ThreadCache::deallocateBuffer(_buf, _capacity))
     {
         ::free(_buf);
     }
@@ -136,7 +137,23 @@ IceInternal::Buffer::Container::reserve(size_type n)
     }
 
     pointer p;
-    if(_owned)
+    if(_owned && !_buf)
+    {
+        //
+        // Reuse a buffer released by this thread if possible.
+        //
+        size_type capacity;
+        p = reinterpret_cast<pointer>(ThreadCache::allocateBuffer(_capacity, capacity));
+        if(p)
+        {
+            _capacity = capacity;
+        }
+        else
+        {
+            p = reinterpret_cast<pointer>(::malloc(_capacity));
+        }
+    }
+    else if(_owned)
     {
         p = reinterpret_cast<pointer>(::realloc(_buf, _capacity));
     }
@@ -206,6 +206,7 @@ IceInternal::OutgoingConnectionFactory::waitUntilFinished()
 void
 IceInternal::OutgoingConnectionFactory::create(const vector<EndpointIPtr>& endpts, bool hasMore,
                                                Ice::EndpointSelectionType selType,
+                                               bool trackLatency,
                                                const CreateConnectionCallbackPtr& callback)
 {
     assert(!endpts.empty());
@@ -224,6 +225,10 @@ IceInternal::OutgoingConnectionFactory::create(const vector<EndpointIPtr>& endpt
         Ice::ConnectionIPtr connection = findConnection(endpoints, compress);
         if(connection)
         {
+            if(trackLatency)
+            {
+                this->trackLatency(connection);
+            }
             callback->setConnection(connection, compress);
             return;
         }
@@ -235,9 +240,9 @@ IceInternal::OutgoingConnectionFactory::create(const vector<EndpointIPtr>& endpt
     }
 
 #ifdef ICE_CPP11_MAPPING
-    auto cb = make_shared<ConnectCallback>(_instance, this, endpoints, hasMore, callback, selType);
+    auto cb = make_shared<ConnectCallback>(_instance, this, endpoints, hasMore, callback, selType, trackLatency);
 #else
-    ConnectCallbackPtr cb = new ConnectCallback(_instance, this, endpoints, hasMore, callback, selType);
+    ConnectCallbackPtr cb = new ConnectCallback(_instance, this, endpoints, hasMore, callback, selType, trackLatency);
 #endif
     cb->getConnectors();
 }
@@ -350,6 +355,7 @@ IceInternal::OutgoingConnectionFactory::OutgoingConnectionFactory(const Communic
     _communicator(communicator),
     _instance(instance),
     _monitor(new FactoryACMMonitor(instance, instance->clientACM())),
+    _endpointLatencies(new EndpointLatencyTable()),
     _destroyed(false),
     _pendingConnectCount(0)
 {
@@ -567,7 +573,8 @@ IceInternal::OutgoingConnectionFactory::getConnection(const vector<ConnectorInfo
 }
 
 ConnectionIPtr
-IceInternal::OutgoingConnectionFactory::createConnection(const TransceiverPtr& transceiver, const ConnectorInfo& ci)
+IceInternal::OutgoingConnectionFactory::createConnection(const TransceiverPtr& transceiver, const ConnectorInfo& ci,
+                                                         bool trackLatency)
 {
     IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
     assert(_pending.find(ci.connector) != _pending.end() && transceiver);
@@ -587,6 +594,10 @@ IceInternal::OutgoingConnectionFactory::createConnection(const TransceiverPtr& t
 
         connection = ConnectionI::create(_communicator, _instance, _monitor, transceiver, ci.connector,
                                          ci.endpoint->compress(false), ICE_NULLPTR);
+        if(trackLatency)
+        {
+            connection->setEndpointLatency(_endpointLatencies->get(ci.endpoint));
+        }
     }
     catch(const Ice::LocalException&)
     {
@@ -783,6 +794,19 @@ IceInternal::OutgoingConnectionFactory::removeFromPending(const ConnectCallbackP
     }
 }
 
+void
+IceInternal::OutgoingConnectionFactory::trackLatency(const ConnectionIPtr& connection)
+{
+    //
+    // The connection might have been established for a proxy which
+    // doesn't use the endpoint latency, start measuring it now.
+    //
+    if(!connection->getEndpointLatency())
+    {
+        connection->setEndpointLatency(_endpointLatencies->get(connection->endpoint()));
+    }
+}
+
 void
 IceInternal::OutgoingConnectionFactory::handleException(const LocalException& ex, bool hasMore)
 {
@@ -844,13 +868,15 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(const I
                                                                          const vector<EndpointIPtr>& endpoints,
                                                                          bool hasMore,
                                                                          const CreateConnectionCallbackPtr& cb,
-                                                                         Ice::EndpointSelectionType selType) :
+                                                                         Ice::EndpointSelectionType selType,
+                                                                         bool trackLatency) :
     _instance(instance),
     _factory(factory),
     _endpoints(endpoints),
     _hasMore(hasMore),
     _callback(cb),
-    _selType(selType)
+    _selType(selType),
+    _trackLatency(trackLatency)
 {
     _endpointsIter = _endpoints.begin();
 }
@@ -866,6 +892,15 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartComplete
         _observer->detach();
     }
 
+    //
+    // The connection establishment and validation provides the first
+    // latency sample for the endpoint.
+    //
+    if(_trackLatency)
+    {
+        connection->getEndpointLatency()->addSample(IceUtil::Time::now(IceUtil::Time::Monotonic) - _connectStartTime);
+    }
+
     connection->activate();
     _factory->finishGetConnection(_connectors, *_iter, connection, ICE_SHARED_FROM_THIS);
 }
@@ -991,6 +1026,10 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::getConnection()
             return;
         }
 
+        if(_trackLatency)
+        {
+            _factory->trackLatency(connection);
+        }
         _callback->setConnection(connection, compress);
         _factory->decPendingConnectCount(); // Must be called last.
     }
@@ -1026,7 +1065,12 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::nextConnector()
                 out << "trying to establish " << _iter->endpoint->protocol() << " connection to "
                     << _iter->connector->toString();
             }
-            Ice::ConnectionIPtr connection = _factory->createConnection(_iter->connector->connect(), *_iter);
+            if(_trackLatency)
+            {
+                _connectStartTime = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            }
+            Ice::ConnectionIPtr connection = _factory->createConnection(_iter->connector->connect(), *_iter,
+                                                                        _trackLatency);
             connection->start(ICE_SHARED_FROM_THIS);
         }
         catch(const Ice::LocalException& ex)
@@ -1055,6 +1099,10 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::setConnection(const Ice
     // Callback from the factory: the connection to one of the callback
     // connectors has been established.
     //
+    if(_trackLatency)
+    {
+        _factory->trackLatency(connection);
+    }
     _callback->setConnection(connection, compress);
     _factory->decPendingConnectCount(); // Must be called last.
 }
@@ -1115,8 +1163,14 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedIm
     if(dynamic_cast<const Ice::CommunicatorDestroyedException*>(&ex)) // No need to continue.
     {
         _factory->finishGetConnection(_connectors, ex, ICE_SHARED_FROM_THIS);
+        return false;
+    }
+
+    if(_trackLatency)
+    {
+        _factory->_endpointLatencies->get(_iter->endpoint)->failed();
     }
-    else if(++_iter != _connectors.end()) // Try the next connector.
+    if(++_iter != _connectors.end()) // Try the next connector.
     {
         return true;
     }
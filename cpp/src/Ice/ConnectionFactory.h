@@ -28,6 +28,7 @@
 #include <Ice/InstrumentationF.h>
 #include <Ice/ACMF.h>
 #include <Ice/Comparable.h>
+#include <Ice/EndpointLatency.h>
 
 #include <list>
 #include <set>
@@ -63,11 +64,18 @@ public:
 
     void waitUntilFinished();
 
-    void create(const std::vector<EndpointIPtr>&, bool, Ice::EndpointSelectionType, const CreateConnectionCallbackPtr&);
+    void create(const std::vector<EndpointIPtr>&, bool, Ice::EndpointSelectionType, bool,
+                const CreateConnectionCallbackPtr&);
     void setRouterInfo(const RouterInfoPtr&);
     void removeAdapter(const Ice::ObjectAdapterPtr&);
     void flushAsyncBatchRequests(const CommunicatorFlushBatchAsyncPtr&);
 
+    const EndpointLatencyTablePtr& endpointLatencies() const
+    {
+        // No mutex lock, immutable.
+        return _endpointLatencies;
+    }
+
     OutgoingConnectionFactory(const Ice::CommunicatorPtr&, const InstancePtr&);
     virtual ~OutgoingConnectionFactory();
     friend class Instance;
@@ -96,7 +104,7 @@ private:
     public:
 
         ConnectCallback(const InstancePtr&, const OutgoingConnectionFactoryPtr&, const std::vector<EndpointIPtr>&, bool,
-                        const CreateConnectionCallbackPtr&, Ice::EndpointSelectionType);
+                        const CreateConnectionCallbackPtr&, Ice::EndpointSelectionType, bool);
 
         virtual void connectionStartCompleted(const Ice::ConnectionIPtr&);
         virtual void connectionStartFailed(const Ice::ConnectionIPtr&, const Ice::LocalException&);
@@ -129,10 +137,12 @@ private:
         const bool _hasMore;
         const CreateConnectionCallbackPtr _callback;
         const Ice::EndpointSelectionType _selType;
+        const bool _trackLatency;
         Ice::Instrumentation::ObserverPtr _observer;
         std::vector<EndpointIPtr>::const_iterator _endpointsIter;
         std::vector<ConnectorInfo> _connectors;
         std::vector<ConnectorInfo>::const_iterator _iter;
+        IceUtil::Time _connectStartTime;
     };
     ICE_DEFINE_PTR(ConnectCallbackPtr, ConnectCallback);
     friend class ConnectCallback;
@@ -150,7 +160,8 @@ private:
     void removeFromPending(const ConnectCallbackPtr&, const std::vector<ConnectorInfo>&);
 
     Ice::ConnectionIPtr findConnection(const std::vector<ConnectorInfo>&, bool&);
-    Ice::ConnectionIPtr createConnection(const TransceiverPtr&, const ConnectorInfo&);
+    Ice::ConnectionIPtr createConnection(const TransceiverPtr&, const ConnectorInfo&, bool);
+    void trackLatency(const Ice::ConnectionIPtr&);
 
     void handleException(const Ice::LocalException&, bool);
     void handleConnectionException(const Ice::LocalException&, bool);
@@ -158,6 +169,7 @@ private:
     Ice::CommunicatorPtr _communicator;
     const InstancePtr _instance;
     const FactoryACMMonitorPtr _monitor;
+    const EndpointLatencyTablePtr _endpointLatencies;
     bool _destroyed;
 
     std::multimap<ConnectorPtr, Ice::ConnectionIPtr> _connections;
@@ -27,6 +27,8 @@
 #include <Ice/ReferenceFactory.h> // For createProxy().
 #include <Ice/ProxyFactory.h> // For createProxy().
 #include <Ice/BatchRequestQueue.h>
+#include <Ice/AdmissionControl.h>
+#include <Ice/MetricsAdminI.h> // For newMetricsCacheId().
 
 #ifdef ICE_HAS_BZIP2
 #  include <bzlib.h>
@@ -112,6 +114,56 @@ private:
     InputStream _stream;
 };
 
+class QueuedDispatchCall : public QueuedMessage
+{
+public:
+
+    QueuedDispatchCall(const ConnectionIPtr& connection, const ThreadPoolPtr& threadPool, Byte compress,
+                       Int requestId, Int invokeNum, bool priority, const ServantManagerPtr& servantManager,
+                       const ObjectAdapterPtr& adapter, InputStream& stream) :
+        QueuedMessage(connection, invokeNum, priority),
+        _threadPool(threadPool),
+        _compress(compress),
+        _requestId(requestId),
+        _invokeNum(invokeNum),
+        _servantManager(servantManager),
+        _adapter(adapter),
+        _stream(stream.instance(), currentProtocolEncoding)
+    {
+        _stream.swap(stream);
+    }
+
+    virtual void
+    run()
+    {
+        connection()->invokeQueued(_stream, _invokeNum, _requestId, _compress, _servantManager, _adapter,
+                                   queueTime(), rejected());
+    }
+
+    virtual void
+    schedule()
+    {
+        try
+        {
+            _threadPool->dispatch(this);
+        }
+        catch(const CommunicatorDestroyedException& ex)
+        {
+            connection()->invokeException(_requestId, ex, _invokeNum, false);
+        }
+    }
+
+private:
+
+    const ThreadPoolPtr _threadPool;
+    const Byte _compress;
+    const Int _requestId;
+    const Int _invokeNum;
+    const ServantManagerPtr _servantManager;
+    const ObjectAdapterPtr _adapter;
+    InputStream _stream;
+};
+
 class FinishCall : public DispatchWorkItem
 {
 public:
@@ -618,6 +670,15 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
     assert(_state > StateNotValidated);
     assert(_state < StateClosing);
 
+    //
+    // The request body is copied into the request stream if it can't be
+    // sent separately with this connection.
+    //
+    if(out->getRequestBody() && (!_writeRequestBodies || compress))
+    {
+        out->writeRequestBody();
+    }
+
     //
     // Ensure the message isn't bigger than what we can send with the
     // transport.
@@ -684,10 +745,28 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
         //
         _asyncRequestsHint = _asyncRequests.insert(_asyncRequests.end(),
                                                    pair<const Int, OutgoingAsyncBasePtr>(requestId, out));
+        updateOutstandingRequests();
+
+        if(_endpointLatency && _latencyRequestId == 0)
+        {
+            _latencyRequestId = requestId;
+            _latencyRequestTime = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        }
     }
     return status;
 }
 
+int
+Ice::ConnectionI::outstandingRequests() const
+{
+    //
+    // The requests waiting for a reply, including the requests which
+    // aren't sent yet. This is read without locking the connection, it's
+    // only an approximation of the connection load.
+    //
+    return _outstandingRequests.load();
+}
+
 BatchRequestQueuePtr
 Ice::ConnectionI::getBatchRequestQueue() const
 {
@@ -854,6 +933,37 @@ Ice::ConnectionI::setCloseCallback(ICE_IN(ICE_CLOSE_CALLBACK) callback)
     }
 }
 
+bool
+Ice::ConnectionI::pauseReading()
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    if(_readPaused || (_state != StateActive && _state != StateHolding))
+    {
+        return false;
+    }
+    if(_state == StateActive)
+    {
+        _threadPool->unregister(ICE_SHARED_FROM_THIS, SocketOperationRead);
+    }
+    _readPaused = true;
+    return true;
+}
+
+void
+Ice::ConnectionI::resumeReading()
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    if(!_readPaused)
+    {
+        return;
+    }
+    _readPaused = false;
+    if(_state == StateActive)
+    {
+        _threadPool->_register(ICE_SHARED_FROM_THIS, SocketOperationRead);
+    }
+}
+
 void
 Ice::ConnectionI::closeCallback(const ICE_CLOSE_CALLBACK& callback)
 {
@@ -939,6 +1049,10 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
         {
             if(o->requestId)
             {
+                if(o->requestId == _latencyRequestId)
+                {
+                    _latencyRequestId = 0;
+                }
                 if(_asyncRequestsHint != _asyncRequests.end() &&
                    _asyncRequestsHint->second == ICE_DYNAMIC_CAST(OutgoingAsync, outAsync))
                 {
@@ -949,6 +1063,7 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
                 {
                     _asyncRequests.erase(o->requestId);
                 }
+                updateOutstandingRequests();
             }
 
             if(dynamic_cast<const Ice::ConnectionTimeoutException*>(&ex))
@@ -991,8 +1106,13 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
                 }
                 else
                 {
+                    if(_asyncRequestsHint->first == _latencyRequestId)
+                    {
+                        _latencyRequestId = 0;
+                    }
                     _asyncRequests.erase(_asyncRequestsHint);
                     _asyncRequestsHint = _asyncRequests.end();
+                    updateOutstandingRequests();
                     if(outAsync->exception(ex))
                     {
                         outAsync->invokeExceptionAsync();
@@ -1002,7 +1122,7 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
             }
         }
 
-        for(map<Int, OutgoingAsyncBasePtr>::iterator p = _asyncRequests.begin(); p != _asyncRequests.end(); ++p)
+        for(AsyncRequestMap::iterator p = _asyncRequests.begin(); p != _asyncRequests.end(); ++p)
         {
             if(p->second.get() == outAsync.get())
             {
@@ -1013,7 +1133,12 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
                 else
                 {
                     assert(p != _asyncRequestsHint);
+                    if(p->first == _latencyRequestId)
+                    {
+                        _latencyRequestId = 0;
+                    }
                     _asyncRequests.erase(p);
+                    updateOutstandingRequests();
                     if(outAsync->exception(ex))
                     {
                         outAsync->invokeExceptionAsync();
@@ -1028,6 +1153,11 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
 void
 Ice::ConnectionI::sendResponse(Int, OutputStream* os, Byte compressFlag, bool /*amd*/)
 {
+    if(_admissionControl)
+    {
+        _admissionControl->finished(1);
+    }
+
     IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
     assert(_state > StateNotValidated);
 
@@ -1067,6 +1197,11 @@ Ice::ConnectionI::sendResponse(Int, OutputStream* os, Byte compressFlag, bool /*
 void
 Ice::ConnectionI::sendNoResponse()
 {
+    if(_admissionControl)
+    {
+        _admissionControl->finished(1);
+    }
+
     IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
     assert(_state > StateNotValidated);
 
@@ -1112,6 +1247,11 @@ Ice::ConnectionI::invokeException(Ice::Int, const LocalException& ex, int invoke
     // called in case of a fatal exception we decrement _dispatchCount here.
     //
 
+    if(_admissionControl && invokeNum > 0)
+    {
+        _admissionControl->finished(invokeNum);
+    }
+
     IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
     setState(StateClosed, ex);
 
@@ -1142,6 +1282,20 @@ Ice::ConnectionI::connector() const
     return _connector; // No mutex protection necessary, _connector is immutable.
 }
 
+void
+Ice::ConnectionI::setEndpointLatency(const EndpointLatencyPtr& latency)
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    _endpointLatency = latency;
+}
+
+EndpointLatencyPtr
+Ice::ConnectionI::getEndpointLatency() const
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    return _endpointLatency;
+}
+
 void
 Ice::ConnectionI::setAdapter(const ObjectAdapterPtr& adapter)
 {
@@ -1339,7 +1493,7 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                 {
                     _observer.startWrite(_writeStream);
                 }
-                writeOp = write(_writeStream);
+                writeOp = writeMessage(_writeStream);
                 if(_observer && !(writeOp & SocketOperationWrite))
                 {
                     _observer.finishWrite(_writeStream);
@@ -1835,7 +1989,7 @@ Ice::ConnectionI::finish(bool close)
         _sendStreams.clear();
     }
 
-    for(map<Int, OutgoingAsyncBasePtr>::const_iterator q = _asyncRequests.begin(); q != _asyncRequests.end(); ++q)
+    for(AsyncRequestMap::const_iterator q = _asyncRequests.begin(); q != _asyncRequests.end(); ++q)
     {
         if(q->second->exception(*_exception))
         {
@@ -1850,6 +2004,7 @@ Ice::ConnectionI::finish(bool close)
     //
     _writeStream.clear();
     _writeStream.b.clear();
+    setWriteBody(0);
     _readStream.clear();
     _readStream.b.clear();
 
@@ -1977,12 +2132,29 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _compressionLevel(1),
     _nextRequestId(1),
     _asyncRequestsHint(_asyncRequests.end()),
+    _outstandingRequests(0),
+    _latencyRequestId(0),
     _messageSizeMax(adapter ? adapter->messageSizeMax() : _instance->messageSizeMax()),
     _batchRequestQueue(new BatchRequestQueue(instance, endpoint->datagram())),
     _readStream(_instance.get(), Ice::currentProtocolEncoding),
     _readHeader(false),
     _writeStream(_instance.get(), Ice::currentProtocolEncoding),
+#if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
+    _writeRequestBodies(false),
+#else
+    //
+    // Request bodies are only written separately with the TCP and SSL
+    // transports, the other transports frame each write or send
+    // datagrams. They are copied into the request stream if protocol
+    // tracing is enabled, the request is traced with its body.
+    //
+    _writeRequestBodies(instance->traceLevels()->protocol < 1 &&
+                        (transceiver->protocol() == "tcp" || transceiver->protocol() == "ssl")),
+#endif
     _dispatchCount(0),
+    _admissionControl(adapter ? adapter->getAdmissionControl() : AdmissionControlPtr()),
+    _readPaused(false),
+    _metricsCacheId(newMetricsCacheId()),
     _state(StateNotInitialized),
     _shutdownInitiated(false),
     _initialized(false),
@@ -2151,7 +2323,10 @@ Ice::ConnectionI::setState(State state)
                 {
                     return;
                 }
-                _threadPool->_register(ICE_SHARED_FROM_THIS, SocketOperationRead);
+                if(!_readPaused)
+                {
+                    _threadPool->_register(ICE_SHARED_FROM_THIS, SocketOperationRead);
+                }
                 break;
             }
 
@@ -2165,7 +2340,7 @@ Ice::ConnectionI::setState(State state)
                 {
                     return;
                 }
-                if(_state == StateActive)
+                if(_state == StateActive && !_readPaused)
                 {
                     _threadPool->unregister(ICE_SHARED_FROM_THIS, SocketOperationRead);
                 }
@@ -2182,6 +2357,18 @@ Ice::ConnectionI::setState(State state)
                 {
                     return;
                 }
+
+                //
+                // Keep reading the messages of the peer while closing.
+                //
+                if(_readPaused)
+                {
+                    _readPaused = false;
+                    if(_state == StateActive)
+                    {
+                        _threadPool->_register(ICE_SHARED_FROM_THIS, SocketOperationRead);
+                    }
+                }
                 break;
             }
 
@@ -2266,6 +2453,7 @@ Ice::ConnectionI::setState(State state)
         }
     }
     _state = state;
+    updateOutstandingRequests();
 
     notifyAll();
 
@@ -2282,6 +2470,16 @@ Ice::ConnectionI::setState(State state)
     }
 }
 
+void
+Ice::ConnectionI::updateOutstandingRequests()
+{
+    //
+    // Must be called with the connection locked, each time the async
+    // requests or the state change.
+    //
+    _outstandingRequests.exchange(_state < StateClosing ? static_cast<int>(_asyncRequests.size()) : -1);
+}
+
 void
 Ice::ConnectionI::initiateShutdown()
 {
@@ -2527,6 +2725,7 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
         // Message wasn't sent, empty the _writeStream, we're not going to send more data.
         OutgoingMessage* message = &_sendStreams.front();
         _writeStream.swap(*message->stream);
+        setWriteBody(0);
         return SocketOperationNone;
     }
 
@@ -2547,6 +2746,7 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
                     callbacks.push_back(*message);
                 }
             }
+            setWriteBody(0);
             _sendStreams.pop_front();
 
             //
@@ -2577,6 +2777,8 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
 #ifdef ICE_HAS_BZIP2
             if(message->compress && message->stream->b.size() >= 100) // Only compress messages > 100 bytes.
             {
+                assert(!message->body);
+
                 //
                 // Message compressed. Request compressed response, if any.
                 //
@@ -2607,7 +2809,7 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
                 //
                 // No compression, just fill in the message size.
                 //
-                Int sz = static_cast<Int>(message->stream->b.size());
+                Int sz = static_cast<Int>(message->stream->b.size() + (message->body ? message->body->size() : 0));
                 const Byte* p = reinterpret_cast<const Byte*>(&sz);
 #ifdef ICE_BIG_ENDIAN
                 reverse_copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
@@ -2621,6 +2823,7 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
             }
 #endif
             _writeStream.swap(*message->stream);
+            setWriteBody(message->body);
 
             //
             // Send the message.
@@ -2630,13 +2833,10 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
                 _observer.startWrite(_writeStream);
             }
             assert(_writeStream.i);
-            if(_writeStream.i != _writeStream.b.end())
+            SocketOperation op = writeMessage(_writeStream);
+            if(op)
             {
-                SocketOperation op = write(_writeStream);
-                if(op)
-                {
-                    return op;
-                }
+                return op;
             }
             if(_observer)
             {
@@ -2689,6 +2889,8 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 #ifdef ICE_HAS_BZIP2
     if(message.compress && message.stream->b.size() >= 100) // Only compress messages larger than 100 bytes.
     {
+        assert(!message.body);
+
         //
         // Message compressed. Request compressed response, if any.
         //
@@ -2747,7 +2949,7 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
         //
         // No compression, just fill in the message size.
         //
-        Int sz = static_cast<Int>(message.stream->b.size());
+        Int sz = static_cast<Int>(message.stream->b.size() + (message.body ? message.body->size() : 0));
         const Byte* p = reinterpret_cast<const Byte*>(&sz);
 #ifdef ICE_BIG_ENDIAN
         reverse_copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
@@ -2765,9 +2967,11 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
         {
             _observer.startWrite(*message.stream);
         }
-        op = write(*message.stream);
+        setWriteBody(message.body);
+        op = writeMessage(*message.stream);
         if(!op)
         {
+            setWriteBody(0);
             if(_observer)
             {
                 _observer.finishWrite(*message.stream);
@@ -3076,7 +3280,7 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
 
                 stream.read(requestId);
 
-                map<Int, OutgoingAsyncBasePtr>::iterator q = _asyncRequests.end();
+                AsyncRequestMap::iterator q = _asyncRequests.end();
 
                 if(_asyncRequestsHint != _asyncRequests.end())
                 {
@@ -3095,6 +3299,13 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
                 {
                     outAsync = q->second;
 
+                    if(requestId == _latencyRequestId)
+                    {
+                        _endpointLatency->addSample(IceUtil::Time::now(IceUtil::Time::Monotonic) -
+                                                    _latencyRequestTime);
+                        _latencyRequestId = 0;
+                    }
+
                     if(q == _asyncRequestsHint)
                     {
                         _asyncRequests.erase(q++);
@@ -3104,6 +3315,7 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
                     {
                         _asyncRequests.erase(q);
                     }
+                    updateOutstandingRequests();
 
                     stream.swap(*outAsync->getIs());
 
@@ -3177,7 +3389,7 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
         }
     }
 
-    return _state == StateHolding ? SocketOperationNone : SocketOperationRead;
+    return _state == StateHolding || _readPaused ? SocketOperationNone : SocketOperationRead;
 }
 
 void
@@ -3189,6 +3401,59 @@ Ice::ConnectionI::invokeAll(InputStream& stream, Int invokeNum, Int requestId, B
     // operation must be called *without* the mutex locked.
     //
 
+    bool reject = false;
+    if(_admissionControl)
+    {
+        //
+        // The requests of a batch are never priority requests.
+        //
+        const bool priority = invokeNum == 1 && _admissionControl->isPriority(stream);
+        switch(_admissionControl->admit(invokeNum, priority))
+        {
+            case AdmissionControl::AdmissionDispatch:
+            {
+                break;
+            }
+            case AdmissionControl::AdmissionReject:
+            {
+                reject = true;
+                break;
+            }
+            case AdmissionControl::AdmissionQueue:
+            {
+                QueuedMessagePtr message = new QueuedDispatchCall(ICE_SHARED_FROM_THIS, _threadPool, compress,
+                                                                  requestId, invokeNum, priority, servantManager,
+                                                                  adapter, stream);
+                if(!_admissionControl->queue(message))
+                {
+                    message->run(); // Admitted in the meantime.
+                }
+                return;
+            }
+        }
+    }
+
+    invokeAll(stream, invokeNum, requestId, compress, servantManager, adapter, IceUtil::Time(), reject);
+}
+
+void
+Ice::ConnectionI::invokeQueued(InputStream& stream, Int invokeNum, Int requestId, Byte compress,
+                               const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter,
+                               const IceUtil::Time& queueTime, bool reject)
+{
+    //
+    // Don't dispatch the messages which were queued while the
+    // connection closed, their replies can't be sent.
+    //
+    invokeAll(stream, invokeNum, requestId, compress, servantManager, adapter, queueTime,
+              reject || !isActiveOrHolding());
+}
+
+void
+Ice::ConnectionI::invokeAll(InputStream& stream, Int invokeNum, Int requestId, Byte compress,
+                            const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter,
+                            const IceUtil::Time& queueTime, bool reject)
+{
     try
     {
         while(invokeNum > 0)
@@ -3200,11 +3465,21 @@ Ice::ConnectionI::invokeAll(InputStream& stream, Int invokeNum, Int requestId, B
             assert(!response || invokeNum == 1);
 
             Incoming in(_instance.get(), this, this, adapter, response, compress, requestId);
+            in.setQueueTime(queueTime);
 
             //
-            // Dispatch the invocation.
+            // Dispatch the invocation or reject it if the object adapter
+            // is overloaded.
             //
-            in.invoke(servantManager, &stream);
+            if(reject)
+            {
+                in.reject(&stream, ObjectAdapterOverloadedException(__FILE__, __LINE__,
+                                                                    adapter ? adapter->getName() : string()));
+            }
+            else
+            {
+                in.invoke(servantManager, &stream);
+            }
 
             --invokeNum;
         }
@@ -3376,6 +3651,40 @@ ConnectionI::write(Buffer& buf)
     return op;
 }
 
+SocketOperation
+ConnectionI::writeMessage(Buffer& buf)
+{
+    //
+    // Write the message stream followed by the request body of the
+    // message, if any. The stream is always written even if it's
+    // already sent, some transports write their own data.
+    //
+    SocketOperation op = write(buf);
+    if(op || _writeBody.i == _writeBody.b.end())
+    {
+        return op;
+    }
+
+    Buffer::Container::iterator start = _writeBody.i;
+    op = write(_writeBody);
+    if(_observer && _writeBody.i != start)
+    {
+        _observer->sentBytes(static_cast<int>(_writeBody.i - start));
+    }
+    return op;
+}
+
+void
+ConnectionI::setWriteBody(const RequestBodyPtr& body)
+{
+    //
+    // The buffer doesn't own the body bytes, the body is kept alive by
+    // the message being sent.
+    //
+    Buffer buf(body ? body->begin() : 0, body ? body->end() : 0);
+    _writeBody.swapBuffer(buf);
+}
+
 void
 ConnectionI::reap()
 {
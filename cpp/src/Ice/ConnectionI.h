@@ -16,6 +16,7 @@
 #include <IceUtil/StopWatch.h>
 #include <IceUtil/Timer.h>
 #include <IceUtil/UniquePtr.h>
+#include <IceUtil/Atomic.h>
 
 #include <Ice/CommunicatorF.h>
 #include <Ice/Connection.h>
@@ -38,6 +39,8 @@
 #include <Ice/ConnectionAsync.h>
 #include <Ice/BatchRequestQueueF.h>
 #include <Ice/ACM.h>
+#include <Ice/EndpointLatency.h>
+#include <Ice/AdmissionControlF.h>
 #include <Ice/OutputStream.h>
 #include <Ice/InputStream.h>
 
@@ -102,7 +105,7 @@ public:
 
         OutgoingMessage(const IceInternal::OutgoingAsyncBasePtr& o, Ice::OutputStream* str,
                         bool comp, int rid) :
-            stream(str), outAsync(o), compress(comp), requestId(rid), adopted(false)
+            stream(str), body(o->getRequestBody()), outAsync(o), compress(comp), requestId(rid), adopted(false)
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
             , isSent(false), invokeSent(false), receivedReply(false)
 #endif
@@ -115,6 +118,7 @@ public:
         void completed(const Ice::LocalException&);
 
         Ice::OutputStream* stream;
+        IceInternal::RequestBodyPtr body; // Sent after the stream if not null.
         IceInternal::OutgoingAsyncBasePtr outAsync;
         bool compress;
         int requestId;
@@ -172,6 +176,7 @@ public:
     void monitor(const IceUtil::Time&, const IceInternal::ACMConfig&);
 
     IceInternal::AsyncStatus sendAsyncRequest(const IceInternal::OutgoingAsyncBasePtr&, bool, bool, int);
+    int outstandingRequests() const; // Returns -1 if the connection is closing or closed.
 
     IceInternal::BatchRequestQueuePtr getBatchRequestQueue() const;
 
@@ -208,6 +213,9 @@ public:
     IceInternal::EndpointIPtr endpoint() const;
     IceInternal::ConnectorPtr connector() const;
 
+    void setEndpointLatency(const IceInternal::EndpointLatencyPtr&);
+    IceInternal::EndpointLatencyPtr getEndpointLatency() const;
+
     virtual void setAdapter(const ObjectAdapterPtr&); // From Connection.
     virtual ObjectAdapterPtr getAdapter() const; // From Connection.
     virtual EndpointPtr getEndpoint() const; // From Connection.
@@ -242,8 +250,23 @@ public:
                   const ICE_HEARTBEAT_CALLBACK&, Ice::InputStream&);
     void finish(bool);
 
+    //
+    // Admission control of the object adapter: the connection stops
+    // reading while paused. pauseReading() returns false if the
+    // connection was already paused or isn't active.
+    //
+    bool pauseReading();
+    void resumeReading();
+    void invokeQueued(Ice::InputStream&, Int, Int, Byte, const IceInternal::ServantManagerPtr&,
+                      const ObjectAdapterPtr&, const IceUtil::Time&, bool);
+
     void closeCallback(const ICE_CLOSE_CALLBACK&);
 
+    Ice::Long getMetricsCacheId() const
+    {
+        return _metricsCacheId; // Immutable, see IceInternal::MetricsCacheKey.
+    }
+
     virtual ~ConnectionI();
 
 private:
@@ -274,6 +297,7 @@ private:
 
     void setState(State, const LocalException&);
     void setState(State);
+    void updateOutstandingRequests();
 
     void initiateShutdown();
     void heartbeat();
@@ -294,6 +318,8 @@ private:
 
     void invokeAll(Ice::InputStream&, Int, Int, Byte,
                    const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&);
+    void invokeAll(Ice::InputStream&, Int, Int, Byte,
+                   const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&, const IceUtil::Time&, bool);
 
     void scheduleTimeout(IceInternal::SocketOperation status);
     void unscheduleTimeout(IceInternal::SocketOperation status);
@@ -303,6 +329,8 @@ private:
 
     IceInternal::SocketOperation read(IceInternal::Buffer&);
     IceInternal::SocketOperation write(IceInternal::Buffer&);
+    IceInternal::SocketOperation writeMessage(IceInternal::Buffer&);
+    void setWriteBody(const IceInternal::RequestBodyPtr&);
 
     void reap();
 
@@ -346,8 +374,29 @@ private:
 
     Int _nextRequestId;
 
-    std::map<Int, IceInternal::OutgoingAsyncBasePtr> _asyncRequests;
-    std::map<Int, IceInternal::OutgoingAsyncBasePtr>::iterator _asyncRequestsHint;
+    //
+    // The entries are allocated by the invoking threads and released by
+    // the thread pool threads, they are recycled by the thread cache.
+    //
+    typedef std::map<Int, IceInternal::OutgoingAsyncBasePtr, std::less<Int>,
+                     IceInternal::ThreadCacheAllocator<std::pair<const Int, IceInternal::OutgoingAsyncBasePtr> > >
+        AsyncRequestMap;
+    AsyncRequestMap _asyncRequests;
+    AsyncRequestMap::iterator _asyncRequestsHint;
+
+    //
+    // The size of _asyncRequests, published to be read without locking
+    // the connection, or -1 once the connection is closing.
+    //
+    IceUtilInternal::Atomic _outstandingRequests;
+
+    //
+    // One twoway request at a time is timed to sample the latency of
+    // the endpoint.
+    //
+    IceInternal::EndpointLatencyPtr _endpointLatency;
+    Int _latencyRequestId;
+    IceUtil::Time _latencyRequestTime;
 
     IceUtil::UniquePtr<LocalException> _exception;
 
@@ -360,10 +409,23 @@ private:
     bool _readHeader;
     Ice::OutputStream _writeStream;
 
+    //
+    // The request body of the message being sent, written after
+    // _writeStream. Only set if request bodies are sent separately
+    // from the request stream instead of being copied into it.
+    //
+    const bool _writeRequestBodies;
+    IceInternal::Buffer _writeBody;
+
     Observer _observer;
 
     int _dispatchCount;
 
+    const IceInternal::AdmissionControlPtr _admissionControl;
+    bool _readPaused;
+
+    const Ice::Long _metricsCacheId;
+
     State _state; // The current state.
     bool _shutdownInitiated;
     bool _initialized;
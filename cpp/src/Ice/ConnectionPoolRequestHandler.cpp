@@ -0,0 +1,269 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/ConnectionPoolRequestHandler.h>
+#include <Ice/RequestHandlerFactory.h>
+#include <Ice/Reference.h>
+#include <Ice/Instance.h>
+#include <Ice/ConnectionI.h>
+#include <Ice/OutgoingAsync.h>
+#include <Ice/LocalException.h>
+
+#include <sstream>
+
+using namespace std;
+using namespace IceInternal;
+
+ConnectionPoolRequestHandler::ConnectionPoolRequestHandler(const RoutableReferencePtr& ref,
+                                                           const Ice::ObjectPrxPtr& proxy) :
+    RequestHandler(ref),
+    _handlers(new HandlerList),
+    _next(0)
+{
+    //
+    // The first connection of the pool is the connection used by the
+    // proxies without a pool, the others use the connection id of the
+    // proxy suffixed with their index in the pool.
+    //
+    RoutableReferencePtr base = RoutableReferencePtr::dynamicCast(ref->changeConnectionsPerEndpoint(1));
+    RequestHandlerFactoryPtr factory = ref->getInstance()->requestHandlerFactory();
+    const int count = ref->getConnectionsPerEndpoint();
+    _references.reserve(count);
+    _handlers->handlers.reserve(count);
+    for(int i = 0; i < count; ++i)
+    {
+        RoutableReferencePtr r = base;
+        if(i > 0)
+        {
+            ostringstream os;
+            os << base->getConnectionId() << '#' << i;
+            r = RoutableReferencePtr::dynamicCast(base->changeConnectionId(os.str()));
+        }
+        _references.push_back(r);
+        _handlers->handlers.push_back(factory->getConnectRequestHandler(r, proxy));
+    }
+}
+
+RequestHandlerPtr
+ConnectionPoolRequestHandler::update(const RequestHandlerPtr& previousHandler, const RequestHandlerPtr& newHandler)
+{
+    //
+    // An invocation failed or a connection of the pool couldn't be
+    // established: keep the pool, selectHandler replaces the dead
+    // connections.
+    //
+    if(!newHandler)
+    {
+        return ICE_SHARED_FROM_THIS;
+    }
+
+    if(previousHandler.get() == this)
+    {
+        return newHandler;
+    }
+
+    //
+    // A connect request handler of the pool established its connection,
+    // replace it with the connection request handler.
+    //
+    HandlerListPtr list;
+    {
+        Lock sync(*this);
+        list = _handlers;
+    }
+    for(size_t i = 0; i < list->handlers.size(); ++i)
+    {
+        if(list->handlers[i].get() == previousHandler.get())
+        {
+            setHandler(i, previousHandler, newHandler);
+            break;
+        }
+    }
+    return ICE_SHARED_FROM_THIS;
+}
+
+AsyncStatus
+ConnectionPoolRequestHandler::sendAsyncRequest(const ProxyOutgoingAsyncBasePtr& out)
+{
+    //
+    // ice_getConnection always returns the first connection of the pool.
+    //
+    if(dynamic_cast<ProxyGetConnection*>(out.get()))
+    {
+        RequestHandlerPtr handler;
+        {
+            Lock sync(*this);
+            handler = _handlers->handlers.front();
+        }
+        try
+        {
+            Ice::ConnectionIPtr connection = handler->getConnection();
+            if(connection && connection->outstandingRequests() < 0)
+            {
+                handler = replaceHandler(0, handler, out);
+            }
+        }
+        catch(const Ice::LocalException&)
+        {
+            handler = replaceHandler(0, handler, out);
+        }
+        return handler->sendAsyncRequest(out);
+    }
+    return selectHandler(out)->sendAsyncRequest(out);
+}
+
+void
+ConnectionPoolRequestHandler::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync,
+                                                   const Ice::LocalException& ex)
+{
+    //
+    // The requests register the handler of the pool connection as their
+    // cancellation handler, this is only called if a request is canceled
+    // before being sent to one of them.
+    //
+    if(outAsync->exception(ex))
+    {
+        outAsync->invokeExceptionAsync();
+    }
+}
+
+Ice::ConnectionIPtr
+ConnectionPoolRequestHandler::getConnection()
+{
+    RequestHandlerPtr handler;
+    {
+        Lock sync(*this);
+        handler = _handlers->handlers.front();
+    }
+    return handler->getConnection();
+}
+
+Ice::ConnectionIPtr
+ConnectionPoolRequestHandler::waitForConnection()
+{
+    RequestHandlerPtr handler;
+    {
+        Lock sync(*this);
+        handler = _handlers->handlers.front();
+    }
+    return handler->waitForConnection();
+}
+
+RequestHandlerPtr
+ConnectionPoolRequestHandler::selectHandler(const ProxyOutgoingAsyncBasePtr& out)
+{
+    //
+    // Pick the established connection with the fewest outstanding
+    // requests, starting with the connection following the last one
+    // picked to spread the requests on idle connections. If no
+    // connection is established yet, queue the request with the connect
+    // request handlers in turn. Only the handler list and the start
+    // position are read with the pool locked, the load of the
+    // connections is read without locking them.
+    //
+    HandlerListPtr list;
+    size_t start;
+    {
+        Lock sync(*this);
+        list = _handlers;
+        start = _next++;
+    }
+
+    RequestHandlerPtr selected;
+    RequestHandlerPtr connecting;
+    vector<pair<size_t, RequestHandlerPtr> > dead;
+    const vector<RequestHandlerPtr>& handlers = list->handlers;
+    const size_t count = handlers.size();
+    int load = -1;
+    for(size_t i = 0; i < count; ++i)
+    {
+        const size_t index = (start + i) % count;
+        Ice::ConnectionIPtr connection;
+        try
+        {
+            connection = handlers[index]->getConnection();
+        }
+        catch(const Ice::LocalException&)
+        {
+            dead.push_back(make_pair(index, handlers[index])); // The connection establishment failed.
+            continue;
+        }
+
+        if(!connection)
+        {
+            if(!connecting)
+            {
+                connecting = handlers[index];
+            }
+            continue;
+        }
+
+        const int outstanding = connection->outstandingRequests();
+        if(outstanding < 0)
+        {
+            dead.push_back(make_pair(index, handlers[index])); // The connection is closing or closed.
+        }
+        else if(load < 0 || outstanding < load)
+        {
+            selected = handlers[index];
+            load = outstanding;
+        }
+    }
+
+    if(!selected)
+    {
+        selected = connecting;
+    }
+
+    //
+    // Replace the dead connections of the pool, the other connections
+    // are kept. The replacements are created without the pool locked as
+    // they can update the pool right away if the connection is already
+    // established.
+    //
+    for(vector<pair<size_t, RequestHandlerPtr> >::const_iterator p = dead.begin(); p != dead.end(); ++p)
+    {
+        RequestHandlerPtr handler = replaceHandler(p->first, p->second, out);
+        if(!selected)
+        {
+            selected = handler;
+        }
+    }
+    return selected;
+}
+
+RequestHandlerPtr
+ConnectionPoolRequestHandler::replaceHandler(size_t index, const RequestHandlerPtr& previous,
+                                             const ProxyOutgoingAsyncBasePtr& out)
+{
+    RequestHandlerPtr handler =
+        _references[index]->getInstance()->requestHandlerFactory()->getConnectRequestHandler(_references[index],
+                                                                                             out->getProxy());
+    return setHandler(index, previous, handler);
+}
+
+RequestHandlerPtr
+ConnectionPoolRequestHandler::setHandler(size_t index, const RequestHandlerPtr& previous,
+                                         const RequestHandlerPtr& handler)
+{
+    //
+    // Another invocation might have replaced the handler already. The
+    // current list might still be used by other invocations, a new list
+    // is created.
+    //
+    Lock sync(*this);
+    if(_handlers->handlers[index].get() == previous.get())
+    {
+        HandlerListPtr list = new HandlerList;
+        list->handlers = _handlers->handlers;
+        list->handlers[index] = handler;
+        _handlers = list;
+    }
+    return _handlers->handlers[index];
+}
@@ -0,0 +1,77 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_CONNECTION_POOL_REQUEST_HANDLER_H
+#define ICE_CONNECTION_POOL_REQUEST_HANDLER_H
+
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Shared.h>
+
+#include <Ice/RequestHandler.h>
+#include <Ice/ReferenceF.h>
+#include <Ice/ProxyF.h>
+
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// Request handler for twoway proxies configured with several
+// connections per endpoint (ConnectionsPerEndpoint > 1). Each
+// connection of the pool is obtained with its own connection id and
+// invocations are sent over the connection with the fewest outstanding
+// requests. A connection of the pool which is closed or which couldn't
+// be established is replaced with a new connection.
+//
+class ConnectionPoolRequestHandler : public RequestHandler, private IceUtil::Mutex
+#ifdef ICE_CPP11_MAPPING
+                                   , public std::enable_shared_from_this<ConnectionPoolRequestHandler>
+#endif
+{
+public:
+
+    ConnectionPoolRequestHandler(const RoutableReferencePtr&, const Ice::ObjectPrxPtr&);
+
+    virtual RequestHandlerPtr update(const RequestHandlerPtr&, const RequestHandlerPtr&);
+
+    virtual AsyncStatus sendAsyncRequest(const ProxyOutgoingAsyncBasePtr&);
+
+    virtual void asyncRequestCanceled(const OutgoingAsyncBasePtr&, const Ice::LocalException&);
+
+    virtual Ice::ConnectionIPtr getConnection();
+    virtual Ice::ConnectionIPtr waitForConnection();
+
+private:
+
+    //
+    // The handlers of the pool connections. A list is immutable once
+    // set, the invocations get the current list with the mutex locked
+    // and select a connection from it without the mutex.
+    //
+    class HandlerList : public IceUtil::Shared
+    {
+    public:
+
+        std::vector<RequestHandlerPtr> handlers;
+    };
+    typedef IceUtil::Handle<HandlerList> HandlerListPtr;
+
+    RequestHandlerPtr selectHandler(const ProxyOutgoingAsyncBasePtr&);
+    RequestHandlerPtr replaceHandler(size_t, const RequestHandlerPtr&, const ProxyOutgoingAsyncBasePtr&);
+    RequestHandlerPtr setHandler(size_t, const RequestHandlerPtr&, const RequestHandlerPtr&);
+
+    std::vector<RoutableReferencePtr> _references;
+    HandlerListPtr _handlers;
+    size_t _next;
+};
+
+}
+
+#endif
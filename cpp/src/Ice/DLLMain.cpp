@@ -9,6 +9,8 @@
 
 #include <Ice/ImplicitContextI.h>
 #include <Ice/Service.h>
+#include <Ice/ThreadCache.h>
+#include <Ice/MetricsAdminI.h>
 
 extern "C" BOOL WINAPI _CRT_INIT(HINSTANCE, DWORD, LPVOID);
 
@@ -36,6 +38,8 @@ ice_DLL_Main(HINSTANCE hDLL, DWORD reason, LPVOID reserved)
     else if(reason == DLL_THREAD_DETACH)
     {
         Ice::ImplicitContextI::cleanupThread();
+        IceInternal::ThreadCache::cleanupThread();
+        IceInternal::cleanupMetricsThread();
     }
 
     //
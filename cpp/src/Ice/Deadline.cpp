@@ -0,0 +1,149 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Deadline.h>
+#include <IceUtil/InputUtil.h>
+#include <IceUtil/ThreadException.h>
+
+#ifndef _WIN32
+#   include <pthread.h>
+#endif
+
+#include <sstream>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+const string IceInternal::deadlineContextKey = "_deadline";
+
+namespace
+{
+
+#ifdef _WIN32
+DWORD deadlineKey = TLS_OUT_OF_INDEXES;
+#else
+pthread_key_t deadlineKey;
+bool deadlineKeyInitialized = false;
+#endif
+
+class Init
+{
+public:
+
+    Init()
+    {
+        //
+        // Note that we never delete this key: other threads might still
+        // be dispatching requests during static destruction.
+        //
+#ifdef _WIN32
+        deadlineKey = TlsAlloc();
+#else
+        deadlineKeyInitialized = pthread_key_create(&deadlineKey, 0) == 0;
+#endif
+    }
+};
+
+Init init;
+
+bool
+isDeadlineKeyInitialized()
+{
+#ifdef _WIN32
+    return deadlineKey != TLS_OUT_OF_INDEXES;
+#else
+    return deadlineKeyInitialized;
+#endif
+}
+
+void
+setDeadline(const IceUtil::Time* deadline)
+{
+#ifdef _WIN32
+    if(TlsSetValue(deadlineKey, const_cast<IceUtil::Time*>(deadline)) == 0)
+    {
+        throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, GetLastError());
+    }
+#else
+    if(int err = pthread_setspecific(deadlineKey, deadline))
+    {
+        throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, err);
+    }
+#endif
+}
+
+}
+
+bool
+IceInternal::readDeadline(const string& value, IceUtil::Time& deadline)
+{
+    IceUtil::Int64 ms;
+    if(!IceUtilInternal::stringToInt64(value, ms))
+    {
+        return false;
+    }
+    IceUtil::Time remaining = IceUtil::Time::milliSeconds(ms) - IceUtil::Time::now(IceUtil::Time::Realtime);
+    deadline = IceUtil::Time::now(IceUtil::Time::Monotonic) + remaining;
+    return true;
+}
+
+void
+IceInternal::writeDeadline(const IceUtil::Time& deadline, Context& ctx)
+{
+    IceUtil::Time remaining = deadline - IceUtil::Time::now(IceUtil::Time::Monotonic);
+    IceUtil::Int64 ms = (IceUtil::Time::now(IceUtil::Time::Realtime) + remaining).toMilliSeconds();
+
+    string& value = ctx[deadlineContextKey];
+    IceUtil::Int64 previous;
+    if(value.empty() || !IceUtilInternal::stringToInt64(value, previous) || ms < previous)
+    {
+        ostringstream os;
+        os << ms;
+        value = os.str();
+    }
+}
+
+const IceUtil::Time*
+IceInternal::getDispatchDeadline()
+{
+    if(!isDeadlineKeyInitialized())
+    {
+        return 0;
+    }
+#ifdef _WIN32
+    return static_cast<const IceUtil::Time*>(TlsGetValue(deadlineKey));
+#else
+    return static_cast<const IceUtil::Time*>(pthread_getspecific(deadlineKey));
+#endif
+}
+
+void
+IceInternal::DeadlineScope::begin(const IceUtil::Time& deadline)
+{
+    if(isDeadlineKeyInitialized())
+    {
+        _previous = getDispatchDeadline();
+        setDeadline(deadline != IceUtil::Time() ? &deadline : 0);
+        _set = true;
+    }
+}
+
+void
+IceInternal::DeadlineScope::end()
+{
+    try
+    {
+        setDeadline(_previous);
+    }
+    catch(const IceUtil::ThreadSyscallException&)
+    {
+        // Ignore, we can't throw from the destructor.
+    }
+}
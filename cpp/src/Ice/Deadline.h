@@ -0,0 +1,82 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_DEADLINE_H
+#define ICE_DEADLINE_H
+
+#include <IceUtil/Time.h>
+#include <Ice/Current.h>
+
+namespace IceInternal
+{
+
+//
+// The deadline of a request is sent in the request context with this
+// key. The value is the deadline in milliseconds since the epoch, the
+// clocks of the client and the server are assumed to be synchronized.
+//
+extern const std::string deadlineContextKey;
+
+//
+// Converts the value of the deadline context entry into a deadline of
+// the monotonic clock. Returns false if the value is invalid.
+//
+bool readDeadline(const std::string&, IceUtil::Time&);
+
+//
+// Adds the given monotonic clock deadline to the context, unless the
+// context already carries an earlier deadline.
+//
+void writeDeadline(const IceUtil::Time&, Ice::Context&);
+
+//
+// Returns the deadline of the request dispatched by the calling
+// thread or null if the thread isn't dispatching a request with a
+// deadline.
+//
+const IceUtil::Time* getDispatchDeadline();
+
+//
+// Sets the deadline of the request dispatched by the calling thread
+// for the scope of the object, the invocations made from the dispatch
+// inherit this deadline. The previous deadline is restored on
+// destruction to support nested collocated dispatch.
+//
+class DeadlineScope : private IceUtil::noncopyable
+{
+public:
+
+    DeadlineScope(const IceUtil::Time& deadline) : _set(false)
+    {
+        if(deadline != IceUtil::Time() || getDispatchDeadline())
+        {
+            begin(deadline);
+        }
+    }
+
+    ~DeadlineScope()
+    {
+        if(_set)
+        {
+            end();
+        }
+    }
+
+private:
+
+    void begin(const IceUtil::Time&);
+    void end();
+
+    bool _set;
+    const IceUtil::Time* _previous;
+};
+
+}
+
+#endif
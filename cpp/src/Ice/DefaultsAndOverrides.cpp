@@ -118,10 +118,14 @@ IceInternal::DefaultsAndOverrides::DefaultsAndOverrides(const PropertiesPtr& pro
     {
         defaultEndpointSelection = Ordered;
     }
+    else if(value == "LatencyAware")
+    {
+        defaultEndpointSelection = LatencyAware;
+    }
     else
     {
         EndpointSelectionTypeParseException ex(__FILE__, __LINE__);
-        ex.str = "illegal value `" + value + "'; expected `Random' or `Ordered'";
+        ex.str = "illegal value `" + value + "'; expected `Random', `Ordered' or `LatencyAware'";
         throw ex;
     }
 
@@ -155,6 +159,25 @@ IceInternal::DefaultsAndOverrides::DefaultsAndOverrides(const PropertiesPtr& pro
             << properties->getProperty("Ice.Default.LocatorCacheTimeout") << "': defaulting to -1";
     }
 
+    const_cast<int&>(defaultConnectionsPerEndpoint) =
+        properties->getPropertyAsIntWithDefault("Ice.Default.ConnectionsPerEndpoint", 1);
+    if(defaultConnectionsPerEndpoint < 1)
+    {
+        const_cast<Int&>(defaultConnectionsPerEndpoint) = 1;
+        Warning out(logger);
+        out << "invalid value for Ice.Default.ConnectionsPerEndpoint `"
+            << properties->getProperty("Ice.Default.ConnectionsPerEndpoint") << "': defaulting to 1";
+    }
+
+    const_cast<int&>(defaultHedgeDelay) = properties->getPropertyAsIntWithDefault("Ice.Default.HedgeDelay", 0);
+    if(defaultHedgeDelay < -1)
+    {
+        const_cast<Int&>(defaultHedgeDelay) = 0;
+        Warning out(logger);
+        out << "invalid value for Ice.Default.HedgeDelay `"
+            << properties->getProperty("Ice.Default.HedgeDelay") << "': defaulting to 0";
+    }
+
     const_cast<bool&>(defaultPreferSecure) =
         properties->getPropertyAsIntWithDefault("Ice.Default.PreferSecure", 0) > 0;
 
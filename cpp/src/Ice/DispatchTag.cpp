@@ -0,0 +1,164 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/DispatchTagI.h>
+#include <Ice/ServantManager.h>
+#include <IceUtil/ThreadException.h>
+
+#ifndef _WIN32
+#   include <pthread.h>
+#endif
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+#ifdef _WIN32
+DWORD tagKey = TLS_OUT_OF_INDEXES;
+#else
+pthread_key_t tagKey;
+bool tagKeyInitialized = false;
+#endif
+
+class Init
+{
+public:
+
+    Init()
+    {
+        //
+        // Note that we never delete this key: other threads might still
+        // be dispatching requests during static destruction.
+        //
+#ifdef _WIN32
+        tagKey = TlsAlloc();
+#else
+        tagKeyInitialized = pthread_key_create(&tagKey, 0) == 0;
+#endif
+    }
+};
+
+Init init;
+
+bool
+isTagKeyInitialized()
+{
+#ifdef _WIN32
+    return tagKey != TLS_OUT_OF_INDEXES;
+#else
+    return tagKeyInitialized;
+#endif
+}
+
+void
+setTag(const DispatchTag* tag)
+{
+#ifdef _WIN32
+    if(TlsSetValue(tagKey, const_cast<DispatchTag*>(tag)) == 0)
+    {
+        throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, GetLastError());
+    }
+#else
+    if(int err = pthread_setspecific(tagKey, tag))
+    {
+        throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, err);
+    }
+#endif
+}
+
+}
+
+const DispatchTag*
+Ice::getDispatchTag()
+{
+    if(!isTagKeyInitialized())
+    {
+        return 0;
+    }
+#ifdef _WIN32
+    return static_cast<const DispatchTag*>(TlsGetValue(tagKey));
+#else
+    return static_cast<const DispatchTag*>(pthread_getspecific(tagKey));
+#endif
+}
+
+//
+// Make sure the compiler doesn't inline or discard the calls to these
+// empty functions, the probes rely on them.
+//
+#if defined(__GNUC__)
+__attribute__((noinline))
+#elif defined(_MSC_VER)
+__declspec(noinline)
+#endif
+void
+iceDispatchBegin(const DispatchTag* tag)
+{
+#if defined(__GNUC__)
+    __asm__ __volatile__("" : : "r"(tag) : "memory");
+#else
+    (void)tag;
+#endif
+}
+
+#if defined(__GNUC__)
+__attribute__((noinline))
+#elif defined(_MSC_VER)
+__declspec(noinline)
+#endif
+void
+iceDispatchEnd(const DispatchTag* tag)
+{
+#if defined(__GNUC__)
+    __asm__ __volatile__("" : : "r"(tag) : "memory");
+#else
+    (void)tag;
+#endif
+}
+
+void
+IceInternal::DispatchTagger::begin(const Current& current, const ServantManagerPtr& servantManager)
+{
+    //
+    // The adapter name is owned by the servant manager, which outlives
+    // the dispatch.
+    //
+    _tag.adapter = servantManager ? servantManager->getAdapterName().c_str() : "";
+    _tag.category = current.id.category.c_str();
+    _tag.name = current.id.name.c_str();
+    _tag.facet = current.facet.c_str();
+    _tag.operation = current.operation.c_str();
+
+    _previous = getDispatchTag();
+    if(isTagKeyInitialized())
+    {
+        setTag(&_tag);
+    }
+    iceDispatchBegin(&_tag);
+}
+
+void
+IceInternal::DispatchTagger::end()
+{
+    iceDispatchEnd(&_tag);
+    if(isTagKeyInitialized())
+    {
+        try
+        {
+            setTag(_previous);
+        }
+        catch(const IceUtil::ThreadSyscallException&)
+        {
+            // Ignore, we can't throw from the destructor.
+        }
+    }
+}
@@ -0,0 +1,58 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_DISPATCH_TAG_I_H
+#define ICE_DISPATCH_TAG_I_H
+
+#include <Ice/DispatchTag.h>
+#include <Ice/Current.h>
+#include <Ice/ServantManagerF.h>
+
+namespace IceInternal
+{
+
+//
+// Tags the calling thread with the given request for the scope of
+// the object. The previous tag is restored on destruction to support
+// nested collocated dispatch.
+//
+class DispatchTagger : private IceUtil::noncopyable
+{
+public:
+
+    DispatchTagger(const Ice::Current& current, const ServantManagerPtr& servantManager, bool enabled) :
+        _enabled(enabled)
+    {
+        if(_enabled)
+        {
+            begin(current, servantManager);
+        }
+    }
+
+    ~DispatchTagger()
+    {
+        if(_enabled)
+        {
+            end();
+        }
+    }
+
+private:
+
+    void begin(const Ice::Current&, const ServantManagerPtr&);
+    void end();
+
+    const bool _enabled;
+    Ice::DispatchTag _tag;
+    const Ice::DispatchTag* _previous;
+};
+
+}
+
+#endif
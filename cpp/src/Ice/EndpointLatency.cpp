@@ -0,0 +1,270 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/EndpointLatency.h>
+#include <Ice/EndpointI.h>
+#include <IceUtil/Random.h>
+
+#include <math.h>
+
+using namespace std;
+using namespace IceInternal;
+
+namespace
+{
+
+//
+// The weight of a new sample in the moving average and deviation.
+//
+const double sampleWeight = 0.2;
+const double deviationWeight = 0.25;
+
+//
+// The time an endpoint is considered unhealthy after a connection
+// failure, unless a new sample is measured in the meantime.
+//
+const IceUtil::Time unhealthyPeriod = IceUtil::Time::seconds(5);
+
+//
+// The minimum size of the table before the unused entries are swept.
+//
+const size_t minimumSweepSize = 16;
+
+//
+// The endpoints are compared without the attributes which don't
+// change the server they designate.
+//
+EndpointIPtr
+normalize(const EndpointIPtr& endpoint)
+{
+    return endpoint->connectionId("")->compress(false)->timeout(-1);
+}
+
+}
+
+IceInternal::EndpointLatency::EndpointLatency() :
+    _average(0),
+    _deviation(0)
+{
+}
+
+void
+IceInternal::EndpointLatency::addSample(const IceUtil::Time& rtt)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    double sample = static_cast<double>(rtt.toMicroSeconds());
+    if(_average == 0)
+    {
+        _average = sample;
+        _deviation = sample / 2;
+    }
+    else
+    {
+        _deviation += deviationWeight * (fabs(sample - _average) - _deviation);
+        _average += sampleWeight * (sample - _average);
+    }
+    _failedUntil = IceUtil::Time();
+}
+
+void
+IceInternal::EndpointLatency::failed()
+{
+    IceUtil::Mutex::Lock sync(*this);
+    _failedUntil = IceUtil::Time::now(IceUtil::Time::Monotonic) + unhealthyPeriod;
+}
+
+double
+IceInternal::EndpointLatency::average() const
+{
+    IceUtil::Mutex::Lock sync(*this);
+    return _average;
+}
+
+double
+IceInternal::EndpointLatency::threshold() const
+{
+    //
+    // Like the TCP retransmission timeout, the average plus four times
+    // the mean deviation exceeds most of the round-trip times.
+    //
+    IceUtil::Mutex::Lock sync(*this);
+    return _average + 4 * _deviation;
+}
+
+bool
+IceInternal::EndpointLatency::healthy(const IceUtil::Time& now) const
+{
+    IceUtil::Mutex::Lock sync(*this);
+    return _failedUntil <= now;
+}
+
+IceInternal::EndpointLatencyTable::EndpointLatencyTable(const IceUtil::Time& idleTimeout) :
+    _idleTimeout(idleTimeout),
+    _sweepSize(minimumSweepSize)
+{
+}
+
+EndpointLatencyPtr
+IceInternal::EndpointLatencyTable::get(const EndpointIPtr& endpoint)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    EndpointMap::iterator p = _normalized.find(endpoint);
+    if(p == _normalized.end())
+    {
+        p = _normalized.insert(make_pair(endpoint, normalize(endpoint))).first;
+    }
+
+    Entry& entry = _latencies[p->second];
+    entry.idleSince = IceUtil::Time();
+    if(!entry.latency)
+    {
+        entry.latency = new EndpointLatency();
+        if(_latencies.size() >= _sweepSize)
+        {
+            EndpointLatencyPtr latency = entry.latency; // Keep the new entry out of the sweep.
+            sweep();
+            return latency;
+        }
+    }
+    return entry.latency;
+}
+
+size_t
+IceInternal::EndpointLatencyTable::size() const
+{
+    IceUtil::Mutex::Lock sync(*this);
+    return _latencies.size();
+}
+
+EndpointLatencyPtr
+IceInternal::EndpointLatencyTable::find(const EndpointIPtr& endpoint) const
+{
+    //
+    // The endpoints of the proxies are usually already known, look
+    // them up before normalizing them.
+    //
+    EndpointMap::const_iterator p = _normalized.find(endpoint);
+#ifdef ICE_CPP11_MAPPING
+    map<EndpointIPtr, Entry, Ice::TargetCompare<EndpointIPtr, std::less>>::const_iterator q =
+#else
+    map<EndpointIPtr, Entry>::const_iterator q =
+#endif
+        _latencies.find(p != _normalized.end() ? p->second : normalize(endpoint));
+    return q != _latencies.end() ? q->second.latency : EndpointLatencyPtr();
+}
+
+void
+IceInternal::EndpointLatencyTable::sweep()
+{
+    //
+    // An entry is only referenced by the table once the connections
+    // using it are closed. It's removed if it's still unused after the
+    // idle timeout, so that the latency of the endpoints of a replica
+    // which reconnects shortly after isn't lost.
+    //
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+#ifdef ICE_CPP11_MAPPING
+    map<EndpointIPtr, Entry, Ice::TargetCompare<EndpointIPtr, std::less>>::iterator p = _latencies.begin();
+#else
+    map<EndpointIPtr, Entry>::iterator p = _latencies.begin();
+#endif
+    while(p != _latencies.end())
+    {
+        if(p->second.latency->__getRef() > 1)
+        {
+            p->second.idleSince = IceUtil::Time();
+        }
+        else if(p->second.idleSince == IceUtil::Time())
+        {
+            p->second.idleSince = now;
+        }
+
+        if(p->second.idleSince != IceUtil::Time() && now - p->second.idleSince >= _idleTimeout)
+        {
+            _latencies.erase(p++);
+        }
+        else
+        {
+            ++p;
+        }
+    }
+
+    EndpointMap::iterator q = _normalized.begin();
+    while(q != _normalized.end())
+    {
+        if(_latencies.find(q->second) == _latencies.end())
+        {
+            _normalized.erase(q++);
+        }
+        else
+        {
+            ++q;
+        }
+    }
+
+    _sweepSize = max(minimumSweepSize, _latencies.size() * 2);
+}
+
+void
+IceInternal::EndpointLatencyTable::sort(vector<EndpointIPtr>& endpoints) const
+{
+    vector<pair<EndpointIPtr, double> > healthy;
+    vector<EndpointIPtr> unhealthy;
+    {
+        IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        IceUtil::Mutex::Lock sync(*this);
+        for(vector<EndpointIPtr>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+        {
+            //
+            // Endpoints without samples are tried as if they were the
+            // fastest to get their latency measured.
+            //
+            EndpointLatencyPtr latency = find(*p);
+            if(!latency)
+            {
+                healthy.push_back(make_pair(*p, 0.0));
+            }
+            else if(latency->healthy(now))
+            {
+                healthy.push_back(make_pair(*p, latency->average()));
+            }
+            else
+            {
+                unhealthy.push_back(*p);
+            }
+        }
+    }
+
+    //
+    // Use the power of two choices: each position is filled with the
+    // fastest of two endpoints randomly picked among the remaining
+    // healthy endpoints. This prefers the fast endpoints without
+    // sending all the load to the fastest one. The unhealthy endpoints
+    // are tried last, in random order.
+    //
+    endpoints.clear();
+    while(!healthy.empty())
+    {
+        const int size = static_cast<int>(healthy.size());
+        size_t i = IceUtilInternal::random(size);
+        size_t j = IceUtilInternal::random(size);
+        if(healthy[j].second < healthy[i].second)
+        {
+            i = j;
+        }
+        endpoints.push_back(healthy[i].first);
+        healthy.erase(healthy.begin() + i);
+    }
+    while(!unhealthy.empty())
+    {
+        size_t i = IceUtilInternal::random(static_cast<int>(unhealthy.size()));
+        endpoints.push_back(unhealthy[i]);
+        unhealthy.erase(unhealthy.begin() + i);
+    }
+}
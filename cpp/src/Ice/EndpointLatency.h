@@ -0,0 +1,109 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_ENDPOINT_LATENCY_H
+#define ICE_ENDPOINT_LATENCY_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Handle.h>
+#include <IceUtil/Time.h>
+#include <Ice/EndpointIF.h>
+#include <Ice/Comparable.h>
+#include <Ice/Config.h>
+
+#include <map>
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The exponentially weighted moving average and mean deviation of the
+// round-trip times measured with an endpoint. The samples are provided
+// by the connection establishment and validation and by the replies to
+// the twoway invocations.
+//
+class ICE_API EndpointLatency : public IceUtil::Shared, private IceUtil::Mutex
+{
+public:
+
+    EndpointLatency();
+
+    void addSample(const IceUtil::Time&);
+    void failed();
+
+    double average() const; // In microseconds, 0 if no samples yet.
+    double threshold() const; // Upper bound of most round-trip times, 0 if no samples yet.
+    bool healthy(const IceUtil::Time&) const;
+
+private:
+
+    double _average;
+    double _deviation;
+    IceUtil::Time _failedUntil;
+};
+typedef IceUtil::Handle<EndpointLatency> EndpointLatencyPtr;
+
+//
+// The latencies of the endpoints used by the outgoing connections of
+// the proxies configured with the LatencyAware endpoint selection type
+// or with an adaptive hedge delay. The latencies are used to sort the
+// endpoints of the LatencyAware proxies.
+//
+// An entry which is no longer used by a connection is removed once it
+// has been idle for the given period. The unused entries are swept when
+// a new entry is added and the table doubled in size since the last
+// sweep.
+//
+class ICE_API EndpointLatencyTable : public IceUtil::Shared, private IceUtil::Mutex
+{
+public:
+
+    EndpointLatencyTable(const IceUtil::Time& = IceUtil::Time::seconds(60));
+
+    EndpointLatencyPtr get(const EndpointIPtr&);
+
+    void sort(std::vector<EndpointIPtr>&) const;
+
+    size_t size() const;
+
+private:
+
+    struct Entry
+    {
+        EndpointLatencyPtr latency;
+        IceUtil::Time idleSince;
+    };
+
+    EndpointLatencyPtr find(const EndpointIPtr&) const;
+    void sweep();
+
+#ifdef ICE_CPP11_MAPPING
+    using EndpointMap = std::map<EndpointIPtr, EndpointIPtr, Ice::TargetCompare<EndpointIPtr, std::less>>;
+    std::map<EndpointIPtr, Entry, Ice::TargetCompare<EndpointIPtr, std::less>> _latencies;
+#else
+    typedef std::map<EndpointIPtr, EndpointIPtr> EndpointMap;
+    std::map<EndpointIPtr, Entry> _latencies;
+#endif
+
+    //
+    // The normalized endpoint of the endpoints already looked up, to
+    // avoid normalizing the endpoint again on each lookup.
+    //
+    EndpointMap _normalized;
+
+    const IceUtil::Time _idleTimeout;
+    size_t _sweepSize;
+};
+typedef IceUtil::Handle<EndpointLatencyTable> EndpointLatencyTablePtr;
+
+}
+
+#endif
@@ -286,6 +286,13 @@ Ice::ObjectAdapterDeactivatedException::ice_print(ostream& out) const
     out << ":\nobject adapter `" << name << "' deactivated";
 }
 
+void
+Ice::ObjectAdapterOverloadedException::ice_print(ostream& out) const
+{
+    Exception::ice_print(out);
+    out << ":\nobject adapter `" << name << "' overloaded";
+}
+
 void
 Ice::ObjectAdapterIdInUseException::ice_print(ostream& out) const
 {
@@ -10,8 +10,11 @@
 #include <Ice/ImplicitContextI.h>
 #include <Ice/OutputStream.h>
 #include <Ice/Object.h>
+#include <Ice/Instance.h>
 #include <IceUtil/Mutex.h>
 #include <IceUtil/MutexPtrLock.h>
+#include <IceUtil/Atomic.h>
+#include <IceUtil/Thread.h>
 
 using namespace std;
 using namespace Ice;
@@ -39,6 +42,85 @@ private:
     IceUtil::Mutex _mutex;
 };
 
+//
+// Implicit context shared by all the threads which publishes an
+// immutable snapshot of the context, along with its encoding, for
+// each update. Invocations read the current snapshot without locking
+// and without allocating, only the updates are serialized.
+//
+class SnapshotImplicitContext : public ImplicitContextI
+{
+public:
+
+    SnapshotImplicitContext(IceInternal::Instance*);
+    virtual ~SnapshotImplicitContext();
+
+    virtual Context getContext() const;
+    virtual void setContext(const Context&);
+
+    virtual bool containsKey(const string&) const;
+    virtual string get(const string&) const;
+    virtual string put(const string&, const string&);
+    virtual string remove(const string&);
+
+    virtual void write(const Context&, ::Ice::OutputStream*) const;
+    virtual void combine(const Context&, Context&) const;
+
+private:
+
+    struct Snapshot
+    {
+        Context context;
+        vector<Byte> encoding;
+    };
+
+    //
+    // The snapshots are stored in two slots. Readers register with the
+    // slot of the current snapshot and updates publish the new snapshot
+    // in the other slot once its readers are gone.
+    //
+    struct Slot
+    {
+        Slot() : snapshot(0), readers(0)
+        {
+        }
+
+        Snapshot* snapshot;
+        mutable IceUtilInternal::Atomic readers;
+    };
+
+    class Reader : private IceUtil::noncopyable
+    {
+    public:
+
+        Reader(const SnapshotImplicitContext&);
+        ~Reader();
+
+        const Context& context() const
+        {
+            return _slot->snapshot->context;
+        }
+
+        const vector<Byte>& encoding() const
+        {
+            return _slot->snapshot->encoding;
+        }
+
+    private:
+
+        const Slot* _slot;
+    };
+    friend class Reader;
+
+    Snapshot* createSnapshot(const Context&) const;
+    void publish(const Context&);
+
+    IceInternal::Instance* _instance;
+    Slot _slots[2];
+    IceUtilInternal::Atomic _current;
+    IceUtil::Mutex _mutex;
+};
+
 #ifndef ICE_OS_WINRT
 class PerThreadImplicitContext : public ImplicitContextI
 {
@@ -108,7 +190,7 @@ extern "C" void iceImplicitContextThreadDestructor(void*);
 
 
 ImplicitContextIPtr
-ImplicitContextI::create(const std::string& kind)
+ImplicitContextI::create(const std::string& kind, IceInternal::Instance* instance)
 {
     if(kind == "None" || kind == "")
     {
@@ -118,6 +200,10 @@ ImplicitContextI::create(const std::string& kind)
     {
         return ICE_MAKE_SHARED(SharedImplicitContext);
     }
+    else if(kind == "Snapshot")
+    {
+        return ICE_MAKE_SHARED(SnapshotImplicitContext, instance);
+    }
     else if(kind == "PerThread")
     {
 #ifndef ICE_OS_WINRT
@@ -257,6 +343,232 @@ SharedImplicitContext::combine(const Context& proxyCtx, Context& ctx) const
     }
 }
 
+//
+// SnapshotImplicitContext implementation
+//
+
+SnapshotImplicitContext::SnapshotImplicitContext(IceInternal::Instance* instance) :
+    _instance(instance),
+    _current(0)
+{
+    _slots[0].snapshot = createSnapshot(Context());
+}
+
+SnapshotImplicitContext::~SnapshotImplicitContext()
+{
+    delete _slots[0].snapshot;
+    delete _slots[1].snapshot;
+}
+
+SnapshotImplicitContext::Reader::Reader(const SnapshotImplicitContext& context)
+{
+    //
+    // Register with the slot of the current snapshot, retry if the
+    // current slot changed in the meantime since its snapshot might
+    // have been replaced before we registered.
+    //
+    while(true)
+    {
+        int current = context._current.load();
+        _slot = &context._slots[current];
+        _slot->readers.fetch_add(1);
+        if(context._current.load() == current)
+        {
+            break;
+        }
+        _slot->readers.fetch_sub(1);
+    }
+}
+
+SnapshotImplicitContext::Reader::~Reader()
+{
+    _slot->readers.fetch_sub(1);
+}
+
+SnapshotImplicitContext::Snapshot*
+SnapshotImplicitContext::createSnapshot(const Context& context) const
+{
+    Snapshot* snapshot = new Snapshot;
+    snapshot->context = context;
+    Ice::OutputStream os(_instance, Ice::currentProtocolEncoding);
+    os.write(context);
+    snapshot->encoding.assign(os.b.begin(), os.b.end());
+    return snapshot;
+}
+
+void
+SnapshotImplicitContext::publish(const Context& context)
+{
+    Snapshot* snapshot = createSnapshot(context);
+
+    //
+    // Wait for the readers of the previous snapshot to be done with it
+    // before replacing it. Readers only hold a slot while marshaling
+    // or copying the context.
+    //
+    int next = 1 - _current.load();
+    Slot& slot = _slots[next];
+    while(slot.readers.load() > 0)
+    {
+        IceUtil::ThreadControl::yield();
+    }
+    delete slot.snapshot;
+    slot.snapshot = snapshot;
+    _current.exchange(next);
+}
+
+Context
+SnapshotImplicitContext::getContext() const
+{
+    Reader reader(*this);
+    return reader.context();
+}
+
+void
+SnapshotImplicitContext::setContext(const Context& newContext)
+{
+    IceUtil::Mutex::Lock lock(_mutex);
+    publish(newContext);
+}
+
+bool
+SnapshotImplicitContext::containsKey(const string& k) const
+{
+    Reader reader(*this);
+    return reader.context().find(k) != reader.context().end();
+}
+
+string
+SnapshotImplicitContext::get(const string& k) const
+{
+    Reader reader(*this);
+    Context::const_iterator p = reader.context().find(k);
+    if(p == reader.context().end())
+    {
+        return "";
+    }
+    return p->second;
+}
+
+string
+SnapshotImplicitContext::put(const string& k, const string& v)
+{
+    IceUtil::Mutex::Lock lock(_mutex);
+    Context context = _slots[_current.load()].snapshot->context;
+    string& val = context[k];
+
+    string oldVal = val;
+    val = v;
+    publish(context);
+    return oldVal;
+}
+
+string
+SnapshotImplicitContext::remove(const string& k)
+{
+    IceUtil::Mutex::Lock lock(_mutex);
+    Context context = _slots[_current.load()].snapshot->context;
+    Context::iterator p = context.find(k);
+    if(p == context.end())
+    {
+        return "";
+    }
+
+    string oldVal = p->second;
+    context.erase(p);
+    publish(context);
+    return oldVal;
+}
+
+void
+SnapshotImplicitContext::write(const Context& proxyCtx, ::Ice::OutputStream* s) const
+{
+    Reader reader(*this);
+    const Context& context = reader.context();
+    if(proxyCtx.empty())
+    {
+        const vector<Byte>& encoding = reader.encoding();
+        s->writeBlob(&encoding[0], encoding.size());
+    }
+    else if(context.empty())
+    {
+        s->write(proxyCtx);
+    }
+    else
+    {
+        //
+        // Marshal the union of both contexts in key order without
+        // building the combined context, the proxy context entries
+        // take precedence.
+        //
+        Int sz = 0;
+        Context::const_iterator p = proxyCtx.begin();
+        Context::const_iterator q = context.begin();
+        while(p != proxyCtx.end() || q != context.end())
+        {
+            if(q == context.end() || (p != proxyCtx.end() && p->first < q->first))
+            {
+                ++p;
+            }
+            else if(p == proxyCtx.end() || q->first < p->first)
+            {
+                ++q;
+            }
+            else
+            {
+                ++p;
+                ++q;
+            }
+            ++sz;
+        }
+
+        s->writeSize(sz);
+        p = proxyCtx.begin();
+        q = context.begin();
+        while(p != proxyCtx.end() || q != context.end())
+        {
+            if(q == context.end() || (p != proxyCtx.end() && p->first < q->first))
+            {
+                s->write(p->first);
+                s->write(p->second);
+                ++p;
+            }
+            else if(p == proxyCtx.end() || q->first < p->first)
+            {
+                s->write(q->first);
+                s->write(q->second);
+                ++q;
+            }
+            else
+            {
+                s->write(p->first);
+                s->write(p->second);
+                ++p;
+                ++q;
+            }
+        }
+    }
+}
+
+void
+SnapshotImplicitContext::combine(const Context& proxyCtx, Context& ctx) const
+{
+    Reader reader(*this);
+    if(proxyCtx.size() == 0)
+    {
+        ctx = reader.context();
+    }
+    else if(reader.context().size() == 0)
+    {
+        ctx = proxyCtx;
+    }
+    else
+    {
+        ctx = proxyCtx;
+        ctx.insert(reader.context().begin(), reader.context().end());
+    }
+}
+
 //
 // PerThreadImplicitContext implementation
 //
@@ -11,6 +11,7 @@
 #define ICE_IMPLICIT_CONTEXT_I_H
 
 #include <Ice/ImplicitContext.h>
+#include <Ice/InstanceF.h>
 
 namespace Ice
 {
@@ -25,7 +26,7 @@ class ImplicitContextI : public ImplicitContext
 {
 public:
 
-    static ImplicitContextIPtr create(const std::string&);
+    static ImplicitContextIPtr create(const std::string&, IceInternal::Instance*);
 
 #ifdef _WIN32
     static void cleanupThread();
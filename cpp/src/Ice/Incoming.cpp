@@ -8,6 +8,8 @@
 // **********************************************************************
 
 #include <Ice/Incoming.h>
+#include <Ice/DispatchTagI.h>
+#include <Ice/Deadline.h>
 #include <Ice/IncomingAsync.h>
 #include <Ice/IncomingRequest.h>
 #include <Ice/ObjectAdapter.h>
@@ -75,6 +77,7 @@ IceInternal::IncomingBase::IncomingBase(IncomingBase& other) :
     _compress(other._compress),
     _format(other._format),
     _os(other._os.instance(), Ice::currentProtocolEncoding),
+    _deadline(other._deadline),
     _responseHandler(other._responseHandler),
     _interceptorCBs(other._interceptorCBs)
 {
@@ -410,7 +413,16 @@ IceInternal::IncomingBase::handleException(const std::exception& exc, bool amd)
     }
     else if(const Exception* ex = dynamic_cast<const Exception*>(&exc))
     {
-        if(_os.instance()->initializationData().properties->getPropertyAsIntWithDefault("Ice.Warn.Dispatch", 1) > 0)
+        //
+        // Like requests for non-existent objects, requests which expired
+        // or which were rejected by an overloaded object adapter are
+        // expected during overloads and only logged with a warning level
+        // greater than 1.
+        //
+        const bool overload = dynamic_cast<const ObjectAdapterOverloadedException*>(&exc) ||
+            (_deadline != IceUtil::Time() && dynamic_cast<const InvocationTimeoutException*>(&exc));
+        if(_os.instance()->initializationData().properties->getPropertyAsIntWithDefault("Ice.Warn.Dispatch", 1) >
+           (overload ? 1 : 0))
         {
             warning(*ex);
         }
@@ -608,7 +620,7 @@ IceInternal::Incoming::startOver()
 }
 
 void
-IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStream* stream)
+IceInternal::Incoming::readCurrent(InputStream* stream)
 {
     _is = stream;
 
@@ -649,6 +661,10 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStre
         pair<const string, string> pr;
         _is->read(const_cast<string&>(pr.first));
         _is->read(pr.second);
+        if(pr.first == deadlineContextKey && !readDeadline(pr.second, _deadline))
+        {
+            _deadline = IceUtil::Time(); // Ignore invalid deadlines.
+        }
         _current.ctx.insert(_current.ctx.end(), pr);
     }
 
@@ -661,7 +677,37 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStre
         _is->i -= 4;
 
         _observer.attach(obsv->getDispatchObserver(_current, static_cast<Int>(_is->i - start + sz)));
+
+        if(_queueTime != IceUtil::Time())
+        {
+            _observer.queued(_queueTime.toMicroSeconds());
+        }
     }
+}
+
+void
+IceInternal::Incoming::reject(InputStream* stream, const LocalException& ex)
+{
+    readCurrent(stream);
+    skipReadParams(); // Required for batch requests.
+    handleException(ex, false);
+}
+
+void
+IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStream* stream)
+{
+    readCurrent(stream);
+
+    //
+    // Tag the thread with the request until it returns from the
+    // dispatch if profiling support is enabled.
+    //
+    DispatchTagger tagger(_current, servantManager, _is->instance()->dispatchTag());
+
+    //
+    // The invocations made from the dispatch inherit its deadline.
+    //
+    DeadlineScope deadlineScope(_deadline);
 
     //
     // Don't put the code above into the try block below. Exceptions
@@ -669,6 +715,16 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStre
     // the caller of this operation.
     //
 
+    if(_deadline != IceUtil::Time() && _deadline <= IceUtil::Time::now(IceUtil::Time::Monotonic))
+    {
+        //
+        // The caller already gave up on this request, don't dispatch it.
+        //
+        skipReadParams(); // Required for batch requests.
+        handleException(InvocationTimeoutException(__FILE__, __LINE__), false);
+        return;
+    }
+
     if(servantManager)
     {
         _servant = servantManager->findServant(_current.id, _current.facet);
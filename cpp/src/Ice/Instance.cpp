@@ -38,6 +38,7 @@
 #include <Ice/PropertiesI.h>
 #include <Ice/Communicator.h>
 #include <Ice/InstrumentationI.h>
+#include <Ice/MetricsExporterI.h>
 #include <Ice/ProtocolInstance.h>
 #include <Ice/LoggerAdminI.h>
 #include <Ice/RegisterPluginsInit.h>
@@ -948,6 +949,8 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
     _messageSizeMax(0),
     _batchAutoFlushSize(0),
     _collectObjects(false),
+    _dispatchTag(false),
+    _propagateDeadlines(false),
     _implicitContext(0),
     _stringConverter(Ice::getProcessStringConverter()),
     _wstringConverter(Ice::getProcessWstringConverter()),
@@ -1189,12 +1192,17 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
 
         const_cast<bool&>(_collectObjects) = _initData.properties->getPropertyAsInt("Ice.CollectObjects") > 0;
 
+        const_cast<bool&>(_dispatchTag) = _initData.properties->getPropertyAsInt("Ice.DispatchTag") > 0;
+
+        const_cast<bool&>(_propagateDeadlines) =
+            _initData.properties->getPropertyAsInt("Ice.PropagateDeadlines") > 0;
+
         //
         // Client ACM enabled by default. Server ACM disabled by default.
         //
 #ifndef ICE_OS_WINRT
         const_cast<ImplicitContextIPtr&>(_implicitContext) =
-            ImplicitContextI::create(_initData.properties->getProperty("Ice.ImplicitContext"));
+            ImplicitContextI::create(_initData.properties->getProperty("Ice.ImplicitContext"), this);
 #endif
         _routerManager = new RouterManager;
 
@@ -1402,6 +1410,16 @@ IceInternal::Instance::finishSetup(int& argc, char* argv[], const Ice::Communica
             _initData.observer = observer;
             _adminFacets.insert(make_pair(metricsFacetName, observer->getFacet()));
 
+            //
+            // MetricsExporter facet
+            //
+            const string exporterFacetName = "MetricsExporter";
+            if(_adminFacetFilter.empty() || _adminFacetFilter.find(exporterFacetName) != _adminFacetFilter.end())
+            {
+                _adminFacets.insert(make_pair(exporterFacetName,
+                                              ICE_MAKE_SHARED(MetricsExporterI, observer->getFacet())));
+            }
+
             //
             // Make sure the metrics admin facet receives property updates.
             //
@@ -1418,6 +1436,16 @@ IceInternal::Instance::finishSetup(int& argc, char* argv[], const Ice::Communica
         }
     }
 
+    //
+    // The metrics are also enabled without the admin facets if the
+    // OpenMetrics HTTP exporter is configured.
+    //
+    if(!ICE_DYNAMIC_CAST(CommunicatorObserverI, _initData.observer) &&
+       _initData.properties->getPropertyAsInt("IceMX.OpenMetrics.Port") > 0)
+    {
+        _initData.observer = ICE_MAKE_SHARED(CommunicatorObserverI, _initData);
+    }
+
     //
     // Set observer updater
     //
@@ -110,6 +110,8 @@ public:
     size_t messageSizeMax() const { return _messageSizeMax; }
     size_t batchAutoFlushSize() const { return _batchAutoFlushSize; }
     bool collectObjects() const { return _collectObjects; }
+    bool dispatchTag() const { return _dispatchTag; }
+    bool propagateDeadlines() const { return _propagateDeadlines; }
     const ACMConfig& clientACM() const;
     const ACMConfig& serverACM() const;
 
@@ -177,6 +179,8 @@ private:
     const size_t _messageSizeMax; // Immutable, not reset by destroy().
     const size_t _batchAutoFlushSize; // Immutable, not reset by destroy().
     const bool _collectObjects; // Immutable, not reset by destroy().
+    const bool _dispatchTag; // Immutable, not reset by destroy().
+    const bool _propagateDeadlines; // Immutable, not reset by destroy().
     ACMConfig _clientACM;
     ACMConfig _serverACM;
     RouterManagerPtr _routerManager;
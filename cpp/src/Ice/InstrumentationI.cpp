@@ -8,10 +8,14 @@
 // **********************************************************************
 
 #include <Ice/InstrumentationI.h>
+#include <Ice/MetricsExporterI.h>
 
 #include <Ice/Connection.h>
 #include <Ice/Endpoint.h>
 #include <Ice/ObjectAdapter.h>
+#include <Ice/ConnectionI.h> // For the metrics cache identifiers.
+#include <Ice/ObjectAdapterI.h>
+#include <Ice/Reference.h>
 #include <Ice/LocalException.h>
 #include <Ice/Communicator.h>
 #include <Ice/LoggerUtil.h>
@@ -248,6 +252,35 @@ public:
         v->size += _size;
     }
 
+    virtual bool getCacheKey(IceInternal::MetricsCacheKey& key) const
+    {
+        //
+        // The connection (none for collocated dispatch), the object
+        // adapter and the target of the request determine all the
+        // attributes except the request ID and the context.
+        //
+        if(!_current.adapter)
+        {
+            return false;
+        }
+        if(_current.con)
+        {
+            key.ids[0] = static_cast<ConnectionI*>(_current.con.get())->getMetricsCacheId();
+        }
+        key.ids[1] = static_cast<ObjectAdapterI*>(_current.adapter.get())->getMetricsCacheId();
+        key.add(_current.operation);
+        key.add(_current.id.name);
+        key.add(_current.id.category);
+        key.add(_current.facet);
+        key.flags = _current.requestId == 0 ? 0 : 1;
+        return true;
+    }
+
+    virtual bool isCacheable(const string& attribute) const
+    {
+        return attribute != "requestId" && attribute.compare(0, 8, "context.") != 0;
+    }
+
     string resolve(const string& attribute) const
     {
         if(attribute.compare(0, 8, "context.") == 0)
@@ -376,6 +409,27 @@ public:
     {
     }
 
+    virtual bool getCacheKey(IceInternal::MetricsCacheKey& key) const
+    {
+        //
+        // The proxy and the operation determine all the attributes except
+        // the context. Computing the invocation id is expensive so this
+        // is worth caching for proxies which are used repeatedly.
+        //
+        if(!_proxy)
+        {
+            return false;
+        }
+        key.ids[0] = _proxy->__reference()->getMetricsCacheId();
+        key.add(_operation);
+        return true;
+    }
+
+    virtual bool isCacheable(const string& attribute) const
+    {
+        return attribute.compare(0, 8, "context.") != 0;
+    }
+
     string resolve(const string& attribute) const
     {
         if(attribute.compare(0, 8, "context.") == 0)
@@ -777,7 +831,7 @@ EndpointHelper::Attributes EndpointHelper::attributes;
 void
 ConnectionObserverI::sentBytes(Int num)
 {
-    forEach(add(&ConnectionMetrics::sentBytes, num));
+    forEachShard(add(&ConnectionMetrics::sentBytes, num));
     if(_delegate)
     {
         _delegate->sentBytes(num);
@@ -787,7 +841,7 @@ ConnectionObserverI::sentBytes(Int num)
 void
 ConnectionObserverI::receivedBytes(Int num)
 {
-    forEach(add(&ConnectionMetrics::receivedBytes, num));
+    forEachShard(add(&ConnectionMetrics::receivedBytes, num));
     if(_delegate)
     {
         _delegate->receivedBytes(num);
@@ -797,7 +851,7 @@ ConnectionObserverI::receivedBytes(Int num)
 void
 ThreadObserverI::stateChanged(ThreadState oldState, ThreadState newState)
 {
-    forEach(ThreadStateChanged(oldState, newState));
+    forEachShard(ThreadStateChanged(oldState, newState));
     if(_delegate)
     {
         _delegate->stateChanged(oldState, newState);
@@ -805,10 +859,51 @@ ThreadObserverI::stateChanged(ThreadState oldState, ThreadState newState)
 
 }
 
+DispatchObserverI::DispatchObserverI() : _cpuTimeEnabled(false)
+{
+}
+
+void
+DispatchObserverI::attach()
+{
+    ObserverWithDelegateT<DispatchMetrics, Ice::Instrumentation::DispatchObserver>::attach();
+
+    const EntrySeqType& entries = getEntries();
+    for(EntrySeqType::const_iterator p = entries.begin(); p != entries.end(); ++p)
+    {
+        if((*p)->getMap()->isCpuTimeEnabled())
+        {
+            _cpuTimeEnabled = true;
+            _thread = IceUtil::ThreadControl();
+            _cpuTime = IceUtil::Time::now(IceUtil::Time::ThreadCpu);
+            break;
+        }
+    }
+}
+
+void
+DispatchObserverI::detach()
+{
+    if(_cpuTimeEnabled && _thread == IceUtil::ThreadControl())
+    {
+        Ice::Long cpuTime = (IceUtil::Time::now(IceUtil::Time::ThreadCpu) - _cpuTime).toMicroSeconds();
+        const EntrySeqType& entries = getEntries();
+        for(EntrySeqType::const_iterator p = entries.begin(); p != entries.end(); ++p)
+        {
+            if((*p)->getMap()->isCpuTimeEnabled())
+            {
+                (*p)->executeOnShard(addOptional(&DispatchMetrics::cpuTime, cpuTime));
+            }
+        }
+    }
+
+    ObserverWithDelegateT<DispatchMetrics, Ice::Instrumentation::DispatchObserver>::detach();
+}
+
 void
 DispatchObserverI::userException()
 {
-    forEach(inc(&DispatchMetrics::userException));
+    forEachShard(inc(&DispatchMetrics::userException));
     if(_delegate)
     {
         _delegate->userException();
@@ -818,17 +913,29 @@ DispatchObserverI::userException()
 void
 DispatchObserverI::reply(Int size)
 {
-    forEach(add(&DispatchMetrics::replySize, size));
+    forEachShard(add(&DispatchMetrics::replySize, size));
     if(_delegate)
     {
         _delegate->reply(size);
     }
 }
 
+void
+DispatchObserverI::queued(Ice::Long time)
+{
+    forEachShard(addOptional(&DispatchMetrics::queueTime, time));
+    Ice::Instrumentation::DispatchQueueObserver* delegate =
+        dynamic_cast<Ice::Instrumentation::DispatchQueueObserver*>(_delegate.get());
+    if(delegate)
+    {
+        delegate->queued(time);
+    }
+}
+
 void
 RemoteObserverI::reply(Int size)
 {
-    forEach(add(&RemoteMetrics::replySize, size));
+    forEachShard(add(&RemoteMetrics::replySize, size));
     if(_delegate)
     {
         _delegate->reply(size);
@@ -838,7 +945,7 @@ RemoteObserverI::reply(Int size)
 void
 CollocatedObserverI::reply(Int size)
 {
-    forEach(add(&CollocatedMetrics::replySize, size));
+    forEachShard(add(&CollocatedMetrics::replySize, size));
     if(_delegate)
     {
         _delegate->reply(size);
@@ -848,7 +955,7 @@ CollocatedObserverI::reply(Int size)
 void
 InvocationObserverI::retried()
 {
-    forEach(inc(&InvocationMetrics::retry));
+    forEachShard(inc(&InvocationMetrics::retry));
     if(_delegate)
     {
         _delegate->retried();
@@ -858,7 +965,7 @@ InvocationObserverI::retried()
 void
 InvocationObserverI::userException()
 {
-    forEach(inc(&InvocationMetrics::userException));
+    forEachShard(inc(&InvocationMetrics::userException));
     if(_delegate)
     {
         _delegate->userException();
@@ -920,6 +1027,19 @@ CommunicatorObserverI::CommunicatorObserverI(const InitializationData& initData)
 {
     _invocations.registerSubMap<RemoteMetrics>("Remote", &InvocationMetrics::remotes);
     _invocations.registerSubMap<CollocatedMetrics>("Collocated", &InvocationMetrics::collocated);
+
+#ifndef ICE_OS_WINRT
+    if(initData.properties->getPropertyAsInt("IceMX.OpenMetrics.Port") > 0)
+    {
+        _openMetricsServer = new OpenMetricsHttpServer(_metrics, initData.properties, initData.logger);
+        _openMetricsServer->start();
+    }
+#endif
+}
+
+CommunicatorObserverI::~CommunicatorObserverI()
+{
+    // Out of line to avoid instantiating the OpenMetricsHttpServer handle destructor in the header.
 }
 
 void
@@ -1096,5 +1216,14 @@ CommunicatorObserverI::destroy()
     _connects.destroy();
     _endpointLookups.destroy();
 
+#ifndef ICE_OS_WINRT
+    if(_openMetricsServer)
+    {
+        _openMetricsServer->destroy();
+        _openMetricsServer->getThreadControl().join();
+        _openMetricsServer = 0;
+    }
+#endif
+
     _metrics->destroy();
 }
@@ -16,6 +16,8 @@
 namespace IceInternal
 {
 
+class OpenMetricsHttpServer;
+
 template<typename T, typename O> class ObserverWithDelegateT : public IceMX::ObserverT<T>, public virtual O
 {
 public:
@@ -167,13 +169,31 @@ public:
     virtual void stateChanged(Ice::Instrumentation::ThreadState, Ice::Instrumentation::ThreadState);
 };
 
-class DispatchObserverI : public ObserverWithDelegateT<IceMX::DispatchMetrics, Ice::Instrumentation::DispatchObserver>
+class DispatchObserverI : public ObserverWithDelegateT<IceMX::DispatchMetrics, Ice::Instrumentation::DispatchObserver>,
+                          public virtual Ice::Instrumentation::DispatchQueueObserver
 {
 public:
 
+    DispatchObserverI();
+
+    virtual void attach();
+    virtual void detach();
+
     virtual void userException();
 
     virtual void reply(Ice::Int);
+
+    virtual void queued(Ice::Long);
+
+private:
+
+    //
+    // The CPU time of the dispatch thread is only accounted if the
+    // dispatch completes on the thread which started it.
+    //
+    bool _cpuTimeEnabled;
+    IceUtil::ThreadControl _thread;
+    IceUtil::Time _cpuTime;
 };
 
 class RemoteObserverI : public ObserverWithDelegateT<IceMX::RemoteMetrics, Ice::Instrumentation::RemoteObserver>
@@ -214,6 +234,7 @@ class ICE_API CommunicatorObserverI : public Ice::Instrumentation::CommunicatorO
 public:
 
     CommunicatorObserverI(const Ice::InitializationData&);
+    virtual ~CommunicatorObserverI();
 
     virtual void setObserverUpdater(const Ice::Instrumentation::ObserverUpdaterPtr&);
 
@@ -253,6 +274,8 @@ private:
     ObserverFactoryWithDelegateT<ThreadObserverI> _threads;
     ObserverFactoryWithDelegateT<ObserverI> _connects;
     ObserverFactoryWithDelegateT<ObserverI> _endpointLookups;
+
+    IceUtil::Handle<OpenMetricsHttpServer> _openMetricsServer;
 };
 ICE_DEFINE_PTR(CommunicatorObserverIPtr, CommunicatorObserverI);
 
@@ -0,0 +1,322 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/InvocationHedge.h>
+#include <Ice/OutgoingAsync.h>
+#include <Ice/ConnectionI.h>
+#include <Ice/EndpointI.h>
+#include <Ice/EndpointLatency.h>
+#include <Ice/Reference.h>
+#include <Ice/ProxyFactory.h>
+#include <Ice/Instance.h>
+#include <Ice/LocalException.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+#ifndef ICE_CPP11_MAPPING
+IceUtil::Shared* IceInternal::upCast(InvocationHedge* p) { return p; }
+#endif
+
+namespace
+{
+
+//
+// The hedged request. It doesn't have any callbacks, it reports its
+// reply to the hedge which completes the hedged invocation with it.
+//
+class HedgeOutgoingAsync : public OutgoingAsync
+{
+public:
+
+    HedgeOutgoingAsync(const ObjectPrxPtr& proxy, OperationMode mode, OutputStream& request,
+                       const InvocationHedgePtr& owner) :
+        OutgoingAsync(proxy, false),
+        _owner(owner)
+    {
+        _mode = mode;
+        _os.swap(request);
+    }
+
+    void invoke()
+    {
+        invokeImpl(false);
+    }
+
+protected:
+
+    virtual bool handleSent(bool, bool)
+    {
+        return false;
+    }
+
+    virtual bool handleException(const Ice::Exception&)
+    {
+        return false;
+    }
+
+    virtual bool handleResponse(bool ok)
+    {
+        _owner->hedgeResponse(ok);
+        return false;
+    }
+
+    virtual void handleInvokeSent(bool, OutgoingAsyncBase*) const
+    {
+    }
+
+    virtual void handleInvokeException(const Ice::Exception&, OutgoingAsyncBase*) const
+    {
+    }
+
+    virtual void handleInvokeResponse(bool, OutgoingAsyncBase*) const
+    {
+    }
+
+private:
+
+    const InvocationHedgePtr _owner;
+};
+ICE_DEFINE_PTR(HedgeOutgoingAsyncPtr, HedgeOutgoingAsync);
+
+}
+
+IceInternal::InvocationHedge::InvocationHedge(const ProxyOutgoingAsyncBasePtr& parent, const OutputStream& os,
+                                              int delay) :
+    _instance(parent->_instance),
+    _delay(delay),
+    _parent(parent),
+    _request(_instance.get(), Ice::currentProtocolEncoding),
+    _state(StatePending),
+    _ok(false)
+{
+    //
+    // The request is copied now, the parent stream is used by the
+    // connection once the request is sent.
+    //
+    _request.writeBlob(os.b.begin(), os.b.size());
+}
+
+void
+IceInternal::InvocationHedge::sending(const ConnectionIPtr& connection)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    if(_endpoint || _state != StatePending)
+    {
+        return; // Retry of the invocation, the hedge delay already started.
+    }
+    _endpoint = connection->endpoint();
+
+    IceUtil::Time delay;
+    if(_delay > 0)
+    {
+        delay = IceUtil::Time::milliSeconds(_delay);
+    }
+    else
+    {
+        //
+        // Adaptive hedge delay: hedge the requests which take longer
+        // than most of the round-trip times measured with the endpoint.
+        //
+        EndpointLatencyPtr latency = connection->getEndpointLatency();
+        const double threshold = latency ? latency->threshold() : 0;
+        if(threshold <= 0)
+        {
+            return; // No round-trip time measured yet.
+        }
+        delay = IceUtil::Time::microSeconds(static_cast<IceUtil::Int64>(threshold));
+    }
+    schedule(delay);
+}
+
+bool
+IceInternal::InvocationHedge::complete()
+{
+    IceUtil::Mutex::Lock sync(*this);
+    if(_state == StateCompletedByHedge)
+    {
+        return false;
+    }
+    else if(_state == StatePending)
+    {
+        _state = StateCompleted;
+        _parent = 0;
+        if(_child)
+        {
+            //
+            // Cancel the hedged request from the timer thread, this can
+            // be called with the connection of the invocation locked.
+            //
+            if(!schedule(IceUtil::Time()))
+            {
+                _child = 0;
+            }
+        }
+        else
+        {
+            _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
+        }
+    }
+    return true;
+}
+
+bool
+IceInternal::InvocationHedge::completedByHedge() const
+{
+    IceUtil::Mutex::Lock sync(*this);
+    return _state == StateCompletedByHedge;
+}
+
+void
+IceInternal::InvocationHedge::hedgeResponse(bool ok)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    if(_state != StatePending)
+    {
+        return;
+    }
+    _state = StateCompletedByHedge;
+    _ok = ok;
+    if(!schedule(IceUtil::Time()))
+    {
+        //
+        // The communicator is being destroyed, let the invocation
+        // complete on its own.
+        //
+        _state = StatePending;
+    }
+}
+
+void
+IceInternal::InvocationHedge::runTimerTask()
+{
+    State state;
+    ProxyOutgoingAsyncBasePtr parent;
+    ProxyOutgoingAsyncBasePtr child;
+    HedgeOutgoingAsyncPtr hedged;
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        state = _state;
+        if(state == StatePending)
+        {
+            if(_child || !_parent)
+            {
+                return;
+            }
+            try
+            {
+                hedged = ICE_MAKE_SHARED(HedgeOutgoingAsync, createHedgeProxy(), _parent->_mode, _request,
+                                         ICE_SHARED_FROM_THIS);
+            }
+            catch(const Ice::LocalException&)
+            {
+                return; // Don't hedge, the invocation completes on its own.
+            }
+            _child = hedged;
+        }
+        else
+        {
+            parent = _parent;
+            child = _child;
+            _parent = 0;
+            _child = 0;
+        }
+    }
+
+    switch(state)
+    {
+        case StatePending:
+        {
+            hedged->invoke();
+            break;
+        }
+
+        case StateCompleted:
+        {
+            if(child)
+            {
+                child->cancel();
+            }
+            break;
+        }
+
+        case StateCompletedByHedge:
+        {
+            //
+            // Cancel the request of the invocation and complete the
+            // invocation with the reply of the hedged request. Once the
+            // cancellation returns, the connection of the invocation no
+            // longer uses its input stream.
+            //
+            assert(parent && child);
+            parent->cancel();
+            parent->_childObserver.detach();
+            parent->getIs()->swap(*child->getIs());
+            try
+            {
+                if(parent->responseImpl(_ok))
+                {
+                    parent->invokeResponseAsync();
+                }
+            }
+            catch(const Ice::CommunicatorDestroyedException&)
+            {
+            }
+            break;
+        }
+    }
+}
+
+ObjectPrxPtr
+IceInternal::InvocationHedge::createHedgeProxy() const
+{
+    //
+    // Send the hedged request to the other endpoints of the proxy. If
+    // the proxy has no other endpoints (indirect, routed or single
+    // endpoint proxy), use a separate connection.
+    //
+    ReferencePtr ref = _parent->_proxy->__reference();
+    vector<EndpointIPtr> endpoints;
+    if(!ref->getRouterInfo())
+    {
+        vector<EndpointIPtr> allEndpoints = ref->getEndpoints();
+        for(vector<EndpointIPtr>::const_iterator p = allEndpoints.begin(); p != allEndpoints.end(); ++p)
+        {
+            if(!(*p)->equivalent(_endpoint))
+            {
+                endpoints.push_back(*p);
+            }
+        }
+    }
+    if(!endpoints.empty())
+    {
+        ref = ref->changeEndpoints(endpoints);
+    }
+    else
+    {
+        ref = ref->changeConnectionId(ref->getConnectionId() + "#hedge");
+    }
+    return ref->getInstance()->proxyFactory()->referenceToProxy(ref);
+}
+
+bool
+IceInternal::InvocationHedge::schedule(const IceUtil::Time& delay)
+{
+    try
+    {
+        _instance->timer()->schedule(ICE_SHARED_FROM_THIS, delay);
+        return true;
+    }
+    catch(const IceUtil::IllegalArgumentException&)
+    {
+        // Expected if the communicator destroyed the timer.
+        return false;
+    }
+}
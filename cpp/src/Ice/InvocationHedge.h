@@ -0,0 +1,92 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_INVOCATION_HEDGE_H
+#define ICE_INVOCATION_HEDGE_H
+
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Timer.h>
+#include <Ice/OutgoingAsyncF.h>
+#include <Ice/InstanceF.h>
+#include <Ice/ProxyF.h>
+#include <Ice/ConnectionIF.h>
+#include <Ice/EndpointIF.h>
+#include <Ice/OutputStream.h>
+
+namespace IceInternal
+{
+
+//
+// Hedging of an idempotent twoway invocation on a proxy configured with
+// a hedge delay. If the invocation didn't complete once the delay
+// elapsed, a copy of the request is sent to another replica and the
+// invocation completes with the first reply. The request which didn't
+// complete the invocation is canceled.
+//
+// The hedge is a timer task: it's scheduled with the hedge delay to
+// send the hedged request, and without delay to cancel the request
+// which lost the race or to complete the invocation with the reply of
+// the hedged request. The invocations might be completed with their
+// connection locked, the connections of both requests can't be
+// locked from there.
+//
+class InvocationHedge : public IceUtil::TimerTask, private IceUtil::Mutex
+#ifdef ICE_CPP11_MAPPING
+                      , public std::enable_shared_from_this<InvocationHedge>
+#endif
+{
+public:
+
+    InvocationHedge(const ProxyOutgoingAsyncBasePtr&, const Ice::OutputStream&, int);
+
+    //
+    // Called by the invocation when its request is sent over a
+    // connection, the hedge delay starts with the first request.
+    //
+    void sending(const Ice::ConnectionIPtr&);
+
+    //
+    // Called by the invocation before it completes, returns false if
+    // the invocation was already completed by the hedged request.
+    //
+    bool complete();
+    bool completedByHedge() const;
+
+    //
+    // Called by the hedged request when it receives its reply.
+    //
+    void hedgeResponse(bool);
+
+    virtual void runTimerTask();
+
+private:
+
+    Ice::ObjectPrxPtr createHedgeProxy() const;
+    bool schedule(const IceUtil::Time&);
+
+    enum State
+    {
+        StatePending,
+        StateCompleted,
+        StateCompletedByHedge
+    };
+
+    const InstancePtr _instance;
+    const int _delay;
+    ProxyOutgoingAsyncBasePtr _parent;
+    ProxyOutgoingAsyncBasePtr _child;
+    Ice::OutputStream _request;
+    EndpointIPtr _endpoint;
+    State _state;
+    bool _ok;
+};
+
+}
+
+#endif
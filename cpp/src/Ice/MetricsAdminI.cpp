@@ -18,6 +18,8 @@
 
 #include <IceUtil/StringUtil.h>
 
+#include <cmath>
+
 using namespace std;
 using namespace Ice;
 using namespace IceInternal;
@@ -33,9 +35,237 @@ const string suffixes[] =
     "Accept.*",
     "Reject.*",
     "RetainDetached",
+    "Histogram",
+    "CpuTime",
     "Map.*",
 };
 
+//
+// The per-thread metrics state: the shard of the thread and the cache
+// of the metrics map entries, see MetricsCacheKey. The cache is a
+// direct-mapped table indexed by the hash of the key, a slot is simply
+// overwritten on collision. The key strings are only copied when an
+// entry is added.
+//
+const int CacheSize = 64;
+
+size_t
+hashKey(const void* map, const MetricsCacheKey& key)
+{
+    size_t h = reinterpret_cast<size_t>(map);
+    h = h * 31 + static_cast<size_t>(key.ids[0]);
+    h = h * 31 + static_cast<size_t>(key.ids[1]);
+    h = h * 31 + static_cast<size_t>(key.flags);
+    for(int i = 0; i < key.count; ++i)
+    {
+        const string& str = *key.strings[i];
+        for(string::const_iterator p = str.begin(); p != str.end(); ++p)
+        {
+            h = h * 31 + static_cast<unsigned char>(*p);
+        }
+        h = h * 31 + 1;
+    }
+    return h;
+}
+
+struct CacheSlot
+{
+    CacheSlot() : map(0), mapCacheId(0), flags(0), hash(0), count(0)
+    {
+        ids[0] = ids[1] = 0;
+    }
+
+    bool
+    matches(const void* m, Ice::Long id, const MetricsCacheKey& key, size_t h) const
+    {
+        if(map != m || mapCacheId != id || hash != h || ids[0] != key.ids[0] || ids[1] != key.ids[1] ||
+           flags != key.flags || count != key.count)
+        {
+            return false;
+        }
+        for(int i = 0; i < count; ++i)
+        {
+            if(strings[i] != *key.strings[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const void* map;
+    Ice::Long mapCacheId;
+    Ice::Long ids[2];
+    int flags;
+    size_t hash;
+    int count;
+    string strings[MetricsCacheKey::MaxStrings];
+    MetricsCacheEntryPtr entry;
+};
+
+IceUtilInternal::Atomic nextShard;
+IceUtilInternal::Atomic64 nextCacheId;
+
+class ThreadState
+{
+public:
+
+    ThreadState() : shard(nextShard++ % MetricsMapI::ShardCount)
+    {
+    }
+
+    const int shard;
+    CacheSlot slots[CacheSize];
+};
+
+#ifdef _WIN32
+DWORD stateKey = TLS_OUT_OF_INDEXES;
+#else
+pthread_key_t stateKey;
+#endif
+bool stateKeyInitialized = false;
+
+}
+
+#ifndef _WIN32
+extern "C"
+{
+
+static void
+iceMetricsThreadStateDestructor(void* p)
+{
+    delete static_cast<ThreadState*>(p);
+}
+
+}
+#endif
+
+namespace
+{
+
+ThreadState*
+getThreadState()
+{
+    //
+    // Before static initialization (or after static destruction) there's
+    // no per-thread state, metrics aren't cached and use the first shard.
+    //
+    if(!stateKeyInitialized)
+    {
+        return 0;
+    }
+
+#ifdef _WIN32
+    ThreadState* state = static_cast<ThreadState*>(TlsGetValue(stateKey));
+#else
+    ThreadState* state = static_cast<ThreadState*>(pthread_getspecific(stateKey));
+#endif
+    if(!state)
+    {
+        state = new (nothrow) ThreadState;
+        if(!state)
+        {
+            return 0;
+        }
+#ifdef _WIN32
+        if(TlsSetValue(stateKey, state) == 0)
+#else
+        if(pthread_setspecific(stateKey, state) != 0)
+#endif
+        {
+            delete state;
+            return 0;
+        }
+    }
+    return state;
+}
+
+class Init
+{
+public:
+
+    Init()
+    {
+        //
+        // Note that we never delete this key: other threads might still
+        // be running during static destruction.
+        //
+#ifdef _WIN32
+        stateKey = TlsAlloc();
+        stateKeyInitialized = stateKey != TLS_OUT_OF_INDEXES;
+#else
+        stateKeyInitialized = pthread_key_create(&stateKey, &iceMetricsThreadStateDestructor) == 0;
+#endif
+    }
+
+    ~Init()
+    {
+        if(stateKeyInitialized)
+        {
+            //
+            // The key destructor isn't called for the main thread.
+            //
+            cleanupMetricsThread();
+            stateKeyInitialized = false;
+        }
+    }
+};
+
+Init init;
+
+string
+escapeLabelValue(const string& value)
+{
+    string result;
+    result.reserve(value.size());
+    for(string::const_iterator p = value.begin(); p != value.end(); ++p)
+    {
+        if(*p == '\\' || *p == '"')
+        {
+            result += '\\';
+            result += *p;
+        }
+        else if(*p == '\n')
+        {
+            result += "\\n";
+        }
+        else
+        {
+            result += *p;
+        }
+    }
+    return result;
+}
+
+string
+toOpenMetricsValue(Ice::Long value, double scale)
+{
+    ostringstream os;
+    if(scale == 1.0)
+    {
+        os << value;
+    }
+    else
+    {
+        os.precision(15);
+        os << static_cast<double>(value) * scale;
+    }
+    return os.str();
+}
+
+struct MetricsMapSnapshot
+{
+    MetricsMapSnapshot(const string& v, const string& n, const MetricsMapIPtr& m) :
+        view(v), name(n), map(m), metrics(m->getMetrics())
+    {
+    }
+
+    string view;
+    string name;
+    MetricsMapIPtr map;
+    MetricsMap metrics;
+};
+
 void
 validateProperties(const string& prefix, const PropertiesPtr& properties)
 {
@@ -90,6 +320,401 @@ parseRule(const PropertiesPtr& properties, const string& name)
     return regexps;
 }
 
+inline int
+mostSignificantBit(Ice::Long value)
+{
+    assert(value > 0);
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(static_cast<unsigned long long>(value));
+#else
+    int msb = 0;
+    while(value >>= 1)
+    {
+        ++msb;
+    }
+    return msb;
+#endif
+}
+
+void
+computePercentiles(MetricsHistogram& histogram)
+{
+    histogram.p50 = getHistogramPercentile(histogram, 50.0);
+    histogram.p90 = getHistogramPercentile(histogram, 90.0);
+    histogram.p99 = getHistogramPercentile(histogram, 99.0);
+    histogram.p999 = getHistogramPercentile(histogram, 99.9);
+}
+
+}
+
+MetricsHistogramI::MetricsHistogramI()
+{
+    for(int i = 0; i < BucketCount; ++i)
+    {
+        _counts[i].store(0);
+    }
+    _min.store(ICE_INT64(0x7FFFFFFFFFFFFFFF));
+    _max.store(0);
+}
+
+void
+MetricsHistogramI::record(Ice::Long value)
+{
+    if(value < 0)
+    {
+        value = 0;
+    }
+
+    _counts[getBucket(value)].fetch_add(1);
+
+    IceUtil::Int64 current = _min.load();
+    while(value < current && !_min.compare_exchange_weak(current, value));
+
+    current = _max.load();
+    while(value > current && !_max.compare_exchange_weak(current, value));
+}
+
+void
+MetricsHistogramI::merge(const MetricsHistogramI& other)
+{
+    for(int i = 0; i < BucketCount; ++i)
+    {
+        Ice::Long count = other._counts[i].load();
+        if(count > 0)
+        {
+            _counts[i].fetch_add(count);
+        }
+    }
+
+    Ice::Long value = other._min.load();
+    IceUtil::Int64 current = _min.load();
+    while(value < current && !_min.compare_exchange_weak(current, value));
+
+    value = other._max.load();
+    current = _max.load();
+    while(value > current && !_max.compare_exchange_weak(current, value));
+}
+
+MetricsHistogram
+MetricsHistogramI::getHistogram() const
+{
+    //
+    // The histogram can be updated while we read it, the count is
+    // computed from the buckets to ensure the snapshot is consistent.
+    //
+    MetricsHistogram histogram;
+    histogram.count = 0;
+    for(int i = 0; i < BucketCount; ++i)
+    {
+        Ice::Long count = _counts[i].load();
+        if(count > 0)
+        {
+            MetricsHistogramBucket bucket;
+            bucket.upperBound = getUpperBound(i);
+            bucket.count = count;
+            histogram.buckets.push_back(bucket);
+            histogram.count += count;
+        }
+    }
+
+    if(histogram.count > 0)
+    {
+        histogram.min = _min.load();
+        histogram.max = _max.load();
+        computePercentiles(histogram);
+    }
+    return histogram;
+}
+
+Ice::Long
+MetricsHistogramI::getUpperBound(int bucket)
+{
+    assert(bucket >= 0 && bucket < BucketCount);
+    if(bucket < SubBucketCount)
+    {
+        return bucket;
+    }
+    int shift = bucket / SubBucketCount - 1;
+    Ice::Long mantissa = SubBucketCount + bucket % SubBucketCount;
+    return ((mantissa + 1) << shift) - 1;
+}
+
+int
+MetricsHistogramI::getBucket(Ice::Long value)
+{
+    if(value < SubBucketCount)
+    {
+        return value < 0 ? 0 : static_cast<int>(value);
+    }
+
+    int msb = mostSignificantBit(value);
+    if(msb >= MaxValueBits)
+    {
+        return BucketCount - 1;
+    }
+    int shift = msb - SubBucketBits;
+    return (shift + 1) * SubBucketCount + static_cast<int>((value >> shift) - SubBucketCount);
+}
+
+void
+IceInternal::mergeHistograms(MetricsHistogram& histogram, const MetricsHistogram& other)
+{
+    if(other.count == 0)
+    {
+        return;
+    }
+
+    if(histogram.count == 0)
+    {
+        histogram = other;
+        return;
+    }
+
+    MetricsHistogramBucketSeq buckets;
+    buckets.reserve(histogram.buckets.size() + other.buckets.size());
+    MetricsHistogramBucketSeq::const_iterator p = histogram.buckets.begin();
+    MetricsHistogramBucketSeq::const_iterator q = other.buckets.begin();
+    while(p != histogram.buckets.end() || q != other.buckets.end())
+    {
+        if(q == other.buckets.end() || (p != histogram.buckets.end() && p->upperBound < q->upperBound))
+        {
+            buckets.push_back(*p++);
+        }
+        else if(p == histogram.buckets.end() || q->upperBound < p->upperBound)
+        {
+            buckets.push_back(*q++);
+        }
+        else
+        {
+            MetricsHistogramBucket bucket = *p++;
+            bucket.count += q++->count;
+            buckets.push_back(bucket);
+        }
+    }
+    histogram.buckets.swap(buckets);
+
+    histogram.count += other.count;
+    histogram.min = min(histogram.min, other.min);
+    histogram.max = max(histogram.max, other.max);
+    computePercentiles(histogram);
+}
+
+Ice::Long
+IceInternal::getHistogramPercentile(const MetricsHistogram& histogram, double percentile)
+{
+    if(histogram.count == 0)
+    {
+        return 0;
+    }
+
+    Ice::Long rank = static_cast<Ice::Long>(ceil(percentile / 100.0 * static_cast<double>(histogram.count)));
+    if(rank < 1)
+    {
+        rank = 1;
+    }
+
+    Ice::Long count = 0;
+    for(MetricsHistogramBucketSeq::const_iterator p = histogram.buckets.begin(); p != histogram.buckets.end(); ++p)
+    {
+        count += p->count;
+        if(count >= rank)
+        {
+            //
+            // The bucket upper bound can be larger than the largest
+            // recorded value.
+            //
+            return max(histogram.min, min(p->upperBound, histogram.max));
+        }
+    }
+    return histogram.max;
+}
+
+void
+OpenMetricsWriter::setPrefix(const string& prefix)
+{
+    _prefix = prefix;
+}
+
+void
+OpenMetricsWriter::setLabels(const string& view, const string& parent, const string& id)
+{
+    _labels = "view=\"" + escapeLabelValue(view) + '"';
+    if(!parent.empty())
+    {
+        _labels += ",parent=\"" + escapeLabelValue(parent) + '"';
+    }
+    _labels += ",id=\"" + escapeLabelValue(id) + '"';
+}
+
+void
+OpenMetricsWriter::counter(const string& name, Ice::Long value, double scale)
+{
+    string family = name.empty() ? _prefix : _prefix + '_' + name;
+    string& samples = addFamily(family, "counter");
+    samples += family + "_total{" + _labels + "} " + toOpenMetricsValue(value, scale) + '\n';
+}
+
+void
+OpenMetricsWriter::gauge(const string& name, Ice::Long value)
+{
+    string family = _prefix + '_' + name;
+    string& samples = addFamily(family, "gauge");
+    samples += family + '{' + _labels + "} " + toOpenMetricsValue(value, 1.0) + '\n';
+}
+
+void
+OpenMetricsWriter::histogram(const string& name, const MetricsHistogram& histogram, Ice::Long sum, double scale)
+{
+    string family = _prefix + '_' + name;
+    string& samples = addFamily(family, "histogram");
+
+    //
+    // The OpenMetrics buckets are cumulative.
+    //
+    Ice::Long count = 0;
+    for(MetricsHistogramBucketSeq::const_iterator p = histogram.buckets.begin(); p != histogram.buckets.end(); ++p)
+    {
+        count += p->count;
+        samples += family + "_bucket{" + _labels + ",le=\"" + toOpenMetricsValue(p->upperBound, scale) + "\"} " +
+            toOpenMetricsValue(count, 1.0) + '\n';
+    }
+    samples += family + "_bucket{" + _labels + ",le=\"+Inf\"} " + toOpenMetricsValue(histogram.count, 1.0) + '\n';
+    samples += family + "_count{" + _labels + "} " + toOpenMetricsValue(histogram.count, 1.0) + '\n';
+    samples += family + "_sum{" + _labels + "} " + toOpenMetricsValue(sum, scale) + '\n';
+}
+
+string
+OpenMetricsWriter::str() const
+{
+    string result;
+    for(vector<string>::const_iterator p = _families.begin(); p != _families.end(); ++p)
+    {
+        map<string, pair<string, string> >::const_iterator q = _samples.find(*p);
+        assert(q != _samples.end());
+        result += "# TYPE " + *p + ' ' + q->second.first + '\n';
+        result += q->second.second;
+    }
+    result += "# EOF\n";
+    return result;
+}
+
+string&
+OpenMetricsWriter::addFamily(string& family, const string& type)
+{
+    //
+    // The samples of a family must all have the same type. Views can
+    // export the same metrics with different types (the lifetime is a
+    // histogram if the Histogram property is set for the map and a
+    // counter otherwise), the samples of the type which doesn't match
+    // the family are added to a family suffixed with their type.
+    //
+    map<string, pair<string, string> >::iterator p = _samples.find(family);
+    while(p != _samples.end() && p->second.first != type)
+    {
+        family += '_' + type;
+        p = _samples.find(family);
+    }
+    if(p == _samples.end())
+    {
+        _families.push_back(family);
+        p = _samples.insert(make_pair(family, make_pair(type, string()))).first;
+    }
+    return p->second.second;
+}
+
+string
+IceInternal::toOpenMetricsName(const string& name)
+{
+    string result;
+    for(string::const_iterator p = name.begin(); p != name.end(); ++p)
+    {
+        if(IceUtilInternal::isAlpha(*p) || IceUtilInternal::isDigit(*p))
+        {
+            if(*p >= 'A' && *p <= 'Z')
+            {
+                if(!result.empty() && result[result.size() - 1] != '_')
+                {
+                    result += '_';
+                }
+                result += static_cast<char>(*p - 'A' + 'a');
+            }
+            else
+            {
+                result += *p;
+            }
+        }
+        else if(!result.empty() && result[result.size() - 1] != '_')
+        {
+            result += '_';
+        }
+    }
+    return result;
+}
+
+void
+IceMX::writeOpenMetrics(OpenMetricsWriter& writer, const Metrics* m)
+{
+    writer.counter("", m->total);
+    writer.gauge("current", m->current);
+    writer.counter("failures", m->failures);
+    if(m->lifetimeHistogram)
+    {
+        writer.histogram("lifetime_seconds", *m->lifetimeHistogram, m->totalLifetime, 1e-6);
+    }
+    else
+    {
+        writer.counter("lifetime_seconds", m->totalLifetime, 1e-6);
+    }
+}
+
+void
+IceMX::writeOpenMetrics(OpenMetricsWriter& writer, const ThreadMetrics* m)
+{
+    writeOpenMetrics(writer, static_cast<const Metrics*>(m));
+    writer.gauge("in_use_for_io", m->inUseForIO);
+    writer.gauge("in_use_for_user", m->inUseForUser);
+    writer.gauge("in_use_for_other", m->inUseForOther);
+}
+
+void
+IceMX::writeOpenMetrics(OpenMetricsWriter& writer, const DispatchMetrics* m)
+{
+    writeOpenMetrics(writer, static_cast<const Metrics*>(m));
+    writer.counter("user_exceptions", m->userException);
+    writer.counter("size_bytes", m->size);
+    writer.counter("reply_size_bytes", m->replySize);
+    if(m->cpuTime)
+    {
+        writer.counter("cpu_seconds", *m->cpuTime, 1e-6);
+    }
+    if(m->queueTime)
+    {
+        writer.counter("queue_seconds", *m->queueTime, 1e-6);
+    }
+}
+
+void
+IceMX::writeOpenMetrics(OpenMetricsWriter& writer, const ChildInvocationMetrics* m)
+{
+    writeOpenMetrics(writer, static_cast<const Metrics*>(m));
+    writer.counter("size_bytes", m->size);
+    writer.counter("reply_size_bytes", m->replySize);
+}
+
+void
+IceMX::writeOpenMetrics(OpenMetricsWriter& writer, const InvocationMetrics* m)
+{
+    writeOpenMetrics(writer, static_cast<const Metrics*>(m));
+    writer.counter("retries", m->retry);
+    writer.counter("user_exceptions", m->userException);
+}
+
+void
+IceMX::writeOpenMetrics(OpenMetricsWriter& writer, const ConnectionMetrics* m)
+{
+    writeOpenMetrics(writer, static_cast<const Metrics*>(m));
+    writer.counter("received_bytes", m->receivedBytes);
+    writer.counter("sent_bytes", m->sentBytes);
 }
 
 MetricsMapI::RegExp::RegExp(const string& attribute, const string& regexp) : _attribute(attribute)
@@ -154,7 +779,9 @@ MetricsMapI::MetricsMapI(const std::string& mapPrefix, const PropertiesPtr& prop
     _properties(properties->getPropertiesForPrefix(mapPrefix)),
     _retain(properties->getPropertyAsIntWithDefault(mapPrefix + "RetainDetached", 10)),
     _accept(parseRule(properties, mapPrefix + "Accept")),
-    _reject(parseRule(properties, mapPrefix + "Reject"))
+    _reject(parseRule(properties, mapPrefix + "Reject")),
+    _histogram(properties->getPropertyAsInt(mapPrefix + "Histogram") > 0),
+    _cpuTime(properties->getPropertyAsInt(mapPrefix + "CpuTime") > 0)
 {
     validateProperties(mapPrefix, properties);
 
@@ -208,7 +835,9 @@ MetricsMapI::MetricsMapI(const MetricsMapI& map) :
     _groupBySeparators(map._groupBySeparators),
     _retain(map._retain),
     _accept(map._accept),
-    _reject(map._reject)
+    _reject(map._reject),
+    _histogram(map._histogram),
+    _cpuTime(map._cpuTime)
 {
 }
 
@@ -218,6 +847,80 @@ MetricsMapI::getProperties() const
     return _properties;
 }
 
+Ice::Long
+IceInternal::newMetricsCacheId()
+{
+    return nextCacheId.fetch_add(1) + 1;
+}
+
+bool
+IceInternal::findMetricsCacheEntry(const void* map, Ice::Long mapCacheId, const MetricsCacheKey& key,
+                                   MetricsCacheEntryPtr& entry)
+{
+    ThreadState* state = getThreadState();
+    if(!state)
+    {
+        return false;
+    }
+
+    size_t hash = hashKey(map, key);
+    const CacheSlot& slot = state->slots[hash % CacheSize];
+    if(!slot.matches(map, mapCacheId, key, hash))
+    {
+        return false;
+    }
+    entry = slot.entry;
+    return true;
+}
+
+void
+IceInternal::addMetricsCacheEntry(const void* map, Ice::Long mapCacheId, const MetricsCacheKey& key,
+                                  const MetricsCacheEntryPtr& entry)
+{
+    ThreadState* state = getThreadState();
+    if(!state)
+    {
+        return;
+    }
+
+    size_t hash = hashKey(map, key);
+    CacheSlot& slot = state->slots[hash % CacheSize];
+    slot.map = map;
+    slot.mapCacheId = mapCacheId;
+    slot.ids[0] = key.ids[0];
+    slot.ids[1] = key.ids[1];
+    slot.flags = key.flags;
+    slot.hash = hash;
+    slot.count = key.count;
+    for(int i = 0; i < key.count; ++i)
+    {
+        slot.strings[i] = *key.strings[i];
+    }
+    slot.entry = entry;
+}
+
+void
+IceInternal::cleanupMetricsThread()
+{
+    if(stateKeyInitialized)
+    {
+#ifdef _WIN32
+        delete static_cast<ThreadState*>(TlsGetValue(stateKey));
+        TlsSetValue(stateKey, 0);
+#else
+        delete static_cast<ThreadState*>(pthread_getspecific(stateKey));
+        pthread_setspecific(stateKey, 0);
+#endif
+    }
+}
+
+int
+MetricsMapI::getShard()
+{
+    ThreadState* state = getThreadState();
+    return state ? state->shard : 0;
+}
+
 MetricsMapFactory::~MetricsMapFactory()
 {
     // Out of line to avoid weak vtable
@@ -639,6 +1342,35 @@ MetricsAdminI::getLogger() const
     return _logger;
 }
 
+string
+MetricsAdminI::getOpenMetrics()
+{
+    //
+    // Get a snapshot of the metrics maps of the enabled views. The
+    // snapshot is converted to the OpenMetrics format without holding
+    // any mutex.
+    //
+    vector<MetricsMapSnapshot> snapshots;
+    {
+        Lock sync(*this);
+        for(map<string, MetricsViewIPtr>::const_iterator p = _views.begin(); p != _views.end(); ++p)
+        {
+            vector<string> maps = p->second->getMaps();
+            for(vector<string>::const_iterator q = maps.begin(); q != maps.end(); ++q)
+            {
+                snapshots.push_back(MetricsMapSnapshot(p->first, *q, p->second->getMap(*q)));
+            }
+        }
+    }
+
+    OpenMetricsWriter writer;
+    for(vector<MetricsMapSnapshot>::const_iterator p = snapshots.begin(); p != snapshots.end(); ++p)
+    {
+        p->map->exportOpenMetrics(writer, "ice_" + toOpenMetricsName(p->name), p->view, "", p->metrics);
+    }
+    return writer.str();
+}
+
 MetricsViewIPtr
 MetricsAdminI::getMetricsView(const std::string& name)
 {
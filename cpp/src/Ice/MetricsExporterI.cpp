@@ -0,0 +1,317 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/MetricsExporterI.h>
+#include <Ice/HttpParser.h>
+#include <Ice/LocalException.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/Properties.h>
+
+#if !defined(ICE_OS_WINRT) && !defined(_WIN32)
+#  include <poll.h>
+#endif
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+#ifndef ICE_OS_WINRT
+
+//
+// Maximum size of the HTTP request headers and timeout for reading the
+// request and writing the response.
+//
+const size_t maxRequestSize = 8192;
+const int requestTimeout = 5;
+
+string
+getResponse(int status, const string& reason, const string& contentType, const string& body)
+{
+    ostringstream os;
+    os << "HTTP/1.1 " << status << ' ' << reason << "\r\n";
+    os << "Content-Type: " << contentType << "\r\n";
+    os << "Content-Length: " << body.size() << "\r\n";
+    if(status == 405)
+    {
+        os << "Allow: GET\r\n";
+    }
+    os << "Connection: close\r\n";
+    os << "\r\n";
+    os << body;
+    return os.str();
+}
+
+void
+setTimeout(SOCKET fd, int option, int seconds)
+{
+#ifdef _WIN32
+    DWORD timeout = seconds * 1000;
+#else
+    struct timeval timeout;
+    timeout.tv_sec = seconds;
+    timeout.tv_usec = 0;
+#endif
+    if(setsockopt(fd, SOL_SOCKET, option, reinterpret_cast<char*>(&timeout), int(sizeof(timeout))) == SOCKET_ERROR)
+    {
+        SocketException ex(__FILE__, __LINE__);
+        ex.error = getSocketErrno();
+        throw ex;
+    }
+}
+
+#endif
+
+}
+
+MetricsExporterI::MetricsExporterI(const MetricsAdminIPtr& metrics) : _metrics(metrics)
+{
+}
+
+string
+MetricsExporterI::getOpenMetrics(const Current&)
+{
+    return _metrics->getOpenMetrics();
+}
+
+#ifndef ICE_OS_WINRT
+
+OpenMetricsHttpServer::OpenMetricsHttpServer(const MetricsAdminIPtr& metrics,
+                                             const PropertiesPtr& properties,
+                                             const LoggerPtr& logger) :
+    IceUtil::Thread("Ice.OpenMetrics"),
+    _metrics(metrics),
+    _logger(logger),
+    _fd(INVALID_SOCKET),
+    _fdIntrRead(INVALID_SOCKET),
+    _fdIntrWrite(INVALID_SOCKET)
+{
+    const string host = properties->getPropertyWithDefault("IceMX.OpenMetrics.Host", "127.0.0.1");
+    const int port = properties->getPropertyAsInt("IceMX.OpenMetrics.Port");
+    const bool preferIPv6 = properties->getPropertyAsInt("Ice.PreferIPv6Address") > 0;
+
+    Address addr = getAddressForServer(host, port, EnableBoth, preferIPv6);
+    _fd = createServerSocket(false, addr, EnableBoth);
+    try
+    {
+        setBlock(_fd, false);
+#ifndef _WIN32
+        //
+        // Enable SO_REUSEADDR on Unix platforms to allow re-using the
+        // socket even if it's in the TIME_WAIT state (see the comment
+        // in TcpAcceptor.cpp).
+        //
+        setReuseAddress(_fd, true);
+#endif
+        doBind(_fd, addr);
+        doListen(_fd, 16);
+
+        SOCKET fds[2];
+        createPipe(fds);
+        _fdIntrRead = fds[0];
+        _fdIntrWrite = fds[1];
+    }
+    catch(...)
+    {
+        closeSocketNoThrow(_fd);
+        throw;
+    }
+}
+
+OpenMetricsHttpServer::~OpenMetricsHttpServer()
+{
+    closeSocketNoThrow(_fd);
+    closeSocketNoThrow(_fdIntrRead);
+    closeSocketNoThrow(_fdIntrWrite);
+}
+
+void
+OpenMetricsHttpServer::run()
+{
+    while(waitForConnection())
+    {
+        SOCKET fd;
+        try
+        {
+            fd = doAccept(_fd);
+        }
+        catch(const SocketException& ex)
+        {
+            if(ex.error != 0 && !wouldBlock())
+            {
+                Warning out(_logger);
+                out << "OpenMetrics exporter failed to accept connection:\n" << ex;
+                IceUtil::ThreadControl::sleep(IceUtil::Time::seconds(1));
+            }
+            continue;
+        }
+
+        try
+        {
+            handleRequest(fd);
+        }
+        catch(const LocalException&)
+        {
+            // Ignore, the client closed the connection or didn't send a valid request on time.
+        }
+        closeSocketNoThrow(fd);
+    }
+}
+
+void
+OpenMetricsHttpServer::destroy()
+{
+    char c = 0;
+    while(true)
+    {
+#ifdef _WIN32
+        if(::send(_fdIntrWrite, &c, 1, 0) == SOCKET_ERROR)
+#else
+        if(::write(_fdIntrWrite, &c, 1) == SOCKET_ERROR)
+#endif
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+        }
+        break;
+    }
+}
+
+bool
+OpenMetricsHttpServer::waitForConnection()
+{
+    while(true)
+    {
+#ifdef _WIN32
+        fd_set fdSet;
+        FD_ZERO(&fdSet);
+        FD_SET(_fd, &fdSet);
+        FD_SET(_fdIntrRead, &fdSet);
+        int ret = ::select(0, &fdSet, 0, 0, 0);
+#else
+        struct pollfd fds[2];
+        fds[0].fd = _fd;
+        fds[0].events = POLLIN;
+        fds[1].fd = _fdIntrRead;
+        fds[1].events = POLLIN;
+        int ret = ::poll(fds, 2, -1);
+#endif
+        if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+
+            SocketException ex(__FILE__, __LINE__);
+            ex.error = getSocketErrno();
+            Error out(_logger);
+            out << "OpenMetrics exporter failed to wait for connections:\n" << ex;
+            return false;
+        }
+
+#ifdef _WIN32
+        return !FD_ISSET(_fdIntrRead, &fdSet);
+#else
+        return fds[1].revents == 0;
+#endif
+    }
+}
+
+void
+OpenMetricsHttpServer::handleRequest(SOCKET fd)
+{
+    setBlock(fd, true);
+    setTimeout(fd, SO_RCVTIMEO, requestTimeout);
+    setTimeout(fd, SO_SNDTIMEO, requestTimeout);
+
+    //
+    // Read the request headers, the request body (if any) is ignored.
+    //
+    Byte request[maxRequestSize];
+    size_t size = 0;
+    HttpParser parser;
+    while(size == 0 || !parser.isCompleteMessage(request, request + size))
+    {
+        if(size == maxRequestSize)
+        {
+            return;
+        }
+
+        ssize_t ret = ::recv(fd, reinterpret_cast<char*>(request + size), static_cast<int>(maxRequestSize - size), 0);
+        if(ret == 0)
+        {
+            return;
+        }
+        else if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+            return;
+        }
+        size += static_cast<size_t>(ret);
+    }
+
+    string response;
+    try
+    {
+        parser.parse(request, request + size);
+        if(parser.type() != HttpParser::TypeRequest)
+        {
+            response = getResponse(400, "Bad Request", "text/plain", "");
+        }
+        else if(parser.method() != "GET")
+        {
+            response = getResponse(405, "Method Not Allowed", "text/plain", "");
+        }
+        else
+        {
+            string path = parser.uri();
+            path = path.substr(0, path.find('?'));
+            if(path != "/" && path != "/metrics")
+            {
+                response = getResponse(404, "Not Found", "text/plain", "");
+            }
+            else
+            {
+                response = getResponse(200, "OK", "application/openmetrics-text; version=1.0.0; charset=utf-8",
+                                       _metrics->getOpenMetrics());
+            }
+        }
+    }
+    catch(const WebSocketException&)
+    {
+        response = getResponse(400, "Bad Request", "text/plain", "");
+    }
+
+    const char* p = response.data();
+    size = response.size();
+    while(size > 0)
+    {
+        ssize_t ret = ::send(fd, p, static_cast<int>(size), 0);
+        if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+            return;
+        }
+        p += ret;
+        size -= static_cast<size_t>(ret);
+    }
+}
+
+#endif
@@ -0,0 +1,74 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_METRICS_EXPORTER_I_H
+#define ICE_METRICS_EXPORTER_I_H
+
+#include <IceUtil/Thread.h>
+#include <Ice/MetricsAdminI.h>
+#include <Ice/Network.h>
+
+namespace IceInternal
+{
+
+//
+// The MetricsExporter admin facet, it provides the metrics of the
+// enabled views in the OpenMetrics text format.
+//
+class MetricsExporterI : public IceMX::MetricsExporter
+{
+public:
+
+    MetricsExporterI(const MetricsAdminIPtr&);
+
+    virtual std::string getOpenMetrics(const Ice::Current&);
+
+private:
+
+    const MetricsAdminIPtr _metrics;
+};
+
+#ifndef ICE_OS_WINRT
+
+//
+// Minimal HTTP server which answers GET requests with the metrics of
+// the enabled views in the OpenMetrics text format, for monitoring
+// systems which scrape metrics over HTTP. It's enabled with the
+// IceMX.OpenMetrics.Port property and handles the requests one at a
+// time from a dedicated thread.
+//
+class OpenMetricsHttpServer : public IceUtil::Thread
+{
+public:
+
+    OpenMetricsHttpServer(const MetricsAdminIPtr&, const Ice::PropertiesPtr&, const Ice::LoggerPtr&);
+    virtual ~OpenMetricsHttpServer();
+
+    virtual void run();
+
+    void destroy();
+
+private:
+
+    bool waitForConnection();
+    void handleRequest(SOCKET);
+
+    const MetricsAdminIPtr _metrics;
+    const Ice::LoggerPtr _logger;
+    SOCKET _fd;
+    SOCKET _fdIntrRead;
+    SOCKET _fdIntrWrite;
+};
+typedef IceUtil::Handle<OpenMetricsHttpServer> OpenMetricsHttpServerPtr;
+
+#endif
+
+}
+
+#endif
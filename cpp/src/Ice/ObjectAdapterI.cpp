@@ -26,11 +26,13 @@
 #include <Ice/Locator.h>
 #include <Ice/LoggerUtil.h>
 #include <Ice/ThreadPool.h>
+#include <Ice/AdmissionControl.h>
 #include <Ice/Communicator.h>
 #include <Ice/Router.h>
 #include <Ice/DefaultsAndOverrides.h>
 #include <Ice/TraceLevels.h>
 #include <Ice/PropertyNames.h>
+#include <Ice/MetricsAdminI.h> // For newMetricsCacheId().
 
 #ifdef _WIN32
 #   include <sys/timeb.h>
@@ -914,7 +916,8 @@ Ice::ObjectAdapterI::ObjectAdapterI(const InstancePtr& instance, const Communica
     _name(name),
     _directCount(0),
     _noConfig(noConfig),
-    _messageSizeMax(0)
+    _messageSizeMax(0),
+    _metricsCacheId(newMetricsCacheId())
 {
 }
 
@@ -1005,6 +1008,12 @@ Ice::ObjectAdapterI::initialize(const RouterPrxPtr& router)
             _threadPool = new ThreadPool(_instance, _name + ".ThreadPool", 0);
         }
 
+        //
+        // Create the admission control if the dispatches are limited,
+        // this is also needed by the incoming connection factories.
+        //
+        _admissionControl = AdmissionControl::create(_instance, _name);
+
         if(!router)
         {
             const_cast<RouterPrxPtr&>(router) = ICE_UNCHECKED_CAST(RouterPrx,
@@ -1418,7 +1427,13 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "Locator.PreferSecure",
         "Locator.CollocationOptimized",
         "Locator.Router",
+        "MaxDispatches",
+        "MaxQueuedRequests",
         "MessageSizeMax",
+        "OverloadPolicy",
+        "PriorityDispatches",
+        "PriorityFacets",
+        "PriorityOperations",
         "PublishedEndpoints",
         "ReplicaGroupId",
         "Router",
@@ -1442,7 +1457,8 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "ThreadPool.SizeWarn",
         "ThreadPool.StackSize",
         "ThreadPool.Serialize",
-        "ThreadPool.ThreadPriority"
+        "ThreadPool.ThreadPriority",
+        "ThreadPool.WorkStealing"
     };
 
     //
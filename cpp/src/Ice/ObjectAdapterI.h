@@ -25,6 +25,7 @@
 #include <Ice/EndpointIF.h>
 #include <Ice/LocatorInfoF.h>
 #include <Ice/ThreadPoolF.h>
+#include <Ice/AdmissionControlF.h>
 #include <Ice/OutgoingAsyncF.h>
 #include <Ice/Exception.h>
 #include <Ice/BuiltinSequences.h>
@@ -104,6 +105,8 @@ public:
     IceInternal::ServantManagerPtr getServantManager() const;
     IceInternal::ACMConfig getACM() const;
     size_t messageSizeMax() const { return _messageSizeMax; }
+    IceInternal::AdmissionControlPtr getAdmissionControl() const { return _admissionControl; }
+    Ice::Long getMetricsCacheId() const { return _metricsCacheId; }
 
     ObjectAdapterI(const IceInternal::InstancePtr&, const CommunicatorPtr&,
                    const IceInternal::ObjectAdapterFactoryPtr&, const std::string&, bool);
@@ -139,6 +142,7 @@ private:
     CommunicatorPtr _communicator;
     IceInternal::ObjectAdapterFactoryPtr _objectAdapterFactory;
     IceInternal::ThreadPoolPtr _threadPool;
+    IceInternal::AdmissionControlPtr _admissionControl;
     IceInternal::ACMConfig _acm;
     IceInternal::ServantManagerPtr _servantManager;
     const std::string _name;
@@ -153,6 +157,7 @@ private:
     int _directCount; // The number of direct proxies dispatching on this object adapter.
     bool _noConfig;
     size_t _messageSizeMax;
+    const Ice::Long _metricsCacheId;
 };
 
 }
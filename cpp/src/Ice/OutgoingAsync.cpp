@@ -20,6 +20,8 @@
 #include <Ice/ConnectionFactory.h>
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/LoggerUtil.h>
+#include <Ice/InvocationHedge.h>
+#include <Ice/Deadline.h>
 
 using namespace std;
 using namespace Ice;
@@ -573,6 +575,11 @@ ProxyOutgoingAsyncBase::exception(const Exception& exc)
         _childObserver.detach();
     }
 
+    if(_hedge && _hedge->completedByHedge())
+    {
+        return false; // The request was canceled, the hedged request completes the invocation.
+    }
+
     _cachedConnection = 0;
     if(_proxy->__reference()->getInvocationTimeout() == -2)
     {
@@ -792,6 +799,10 @@ ProxyOutgoingAsyncBase::sentImpl(bool done)
 bool
 ProxyOutgoingAsyncBase::exceptionImpl(const Exception& ex)
 {
+    if(_hedge && !_hedge->complete())
+    {
+        return false;
+    }
     if(_proxy->__reference()->getInvocationTimeout() != -1)
     {
         _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
@@ -837,7 +848,37 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
     _mode = mode;
     _observer.attach(_proxy, operation, context);
 
-    switch(_proxy->__reference()->getMode())
+    Reference* ref = _proxy->__reference().get();
+
+    //
+    // If deadlines are propagated, the request carries the earliest of
+    // the deadline of the request dispatched by this thread and of the
+    // invocation timeout.
+    //
+    IceUtil::Time deadline;
+    if(_instance->propagateDeadlines())
+    {
+        const IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        if(const IceUtil::Time* dispatchDeadline = getDispatchDeadline())
+        {
+            deadline = *dispatchDeadline;
+        }
+        const int invocationTimeout = ref->getInvocationTimeout();
+        if(invocationTimeout > 0)
+        {
+            const IceUtil::Time timeout = now + IceUtil::Time::milliSeconds(invocationTimeout);
+            if(deadline == IceUtil::Time() || timeout < deadline)
+            {
+                deadline = timeout;
+            }
+        }
+        if(deadline != IceUtil::Time() && deadline <= now)
+        {
+            throw InvocationTimeoutException(__FILE__, __LINE__); // Don't send requests which already expired.
+        }
+    }
+
+    switch(ref->getMode())
     {
         case Reference::ModeTwoway:
         case Reference::ModeOneway:
@@ -855,32 +896,35 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
         }
     }
 
-    Reference* ref = _proxy->__reference().get();
-
-    _os.write(ref->getIdentity());
-
-    //
-    // For compatibility with the old FacetPath.
-    //
-    if(ref->getFacet().empty())
-    {
-        _os.write(static_cast<string*>(0), static_cast<string*>(0));
-    }
-    else
+    if(deadline != IceUtil::Time())
     {
-        string facet = ref->getFacet();
-        _os.write(&facet, &facet + 1);
+        //
+        // Add the deadline to the explicit or implicit context
+        //
+        Context ctx;
+        const ImplicitContextIPtr& implicitContext = ref->getInstance()->getImplicitContext();
+        if(&context != &Ice::noExplicitContext)
+        {
+            ctx = context;
+        }
+        else if(implicitContext)
+        {
+            implicitContext->combine(ref->getContext()->getValue(), ctx);
+        }
+        else
+        {
+            ctx = ref->getContext()->getValue();
+        }
+        writeDeadline(deadline, ctx);
+        ref->writeRequestHeader(&_os, operation, _mode, false);
+        _os.write(ctx);
     }
-
-    _os.write(operation, false);
-
-    _os.write(static_cast<Byte>(_mode));
-
-    if(&context != &Ice::noExplicitContext)
+    else if(&context != &Ice::noExplicitContext)
     {
         //
         // Explicit context
         //
+        ref->writeRequestHeader(&_os, operation, _mode, false);
         _os.write(context);
     }
     else
@@ -889,18 +933,49 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
         // Implicit context
         //
         const ImplicitContextIPtr& implicitContext = ref->getInstance()->getImplicitContext();
-        const Context& prxContext = ref->getContext()->getValue();
         if(implicitContext == 0)
         {
-            _os.write(prxContext);
+            ref->writeRequestHeader(&_os, operation, _mode, true);
         }
         else
         {
-            implicitContext->write(prxContext, &_os);
+            ref->writeRequestHeader(&_os, operation, _mode, false);
+            implicitContext->write(ref->getContext()->getValue(), &_os);
         }
     }
 }
 
+void
+OutgoingAsync::prepare(const RequestBodyPtr& body)
+{
+    //
+    // The request body is copied into the request stream like with
+    // prepare() if the deadline must be added to its context, if the
+    // request is batched or if the parameter encapsulation is empty,
+    // its encoding depends on the proxy.
+    //
+    Reference* ref = _proxy->__reference().get();
+    const pair<const Byte*, const Byte*> encaps = body->getParamEncaps();
+    if(_instance->propagateDeadlines() ||
+       ref->getMode() == Reference::ModeBatchOneway ||
+       ref->getMode() == Reference::ModeBatchDatagram ||
+       encaps.first == encaps.second)
+    {
+        prepare(body->getOperation(), body->getMode(), body->getContext());
+        writeParamEncaps(encaps.first, static_cast<Int>(encaps.second - encaps.first));
+        return;
+    }
+
+    checkSupportedProtocol(getCompatibleProtocol(ref->getProtocol()));
+
+    _mode = body->getMode();
+    _observer.attach(_proxy, body->getOperation(), body->getContext());
+
+    _os.writeBlob(requestHdr, sizeof(requestHdr));
+    ref->writeIdentityAndFacet(&_os);
+    _requestBody = body;
+}
+
 bool
 OutgoingAsync::sent()
 {
@@ -923,6 +998,11 @@ OutgoingAsync::response()
         _childObserver.detach();
     }
 
+    if(_hedge && !_hedge->complete())
+    {
+        return false; // The hedged request already completed the invocation.
+    }
+
     Byte replyStatus;
     try
     {
@@ -1056,12 +1136,17 @@ AsyncStatus
 OutgoingAsync::invokeRemote(const ConnectionIPtr& connection, bool compress, bool response)
 {
     _cachedConnection = connection;
+    if(_hedge)
+    {
+        _hedge->sending(connection);
+    }
     return connection->sendAsyncRequest(ICE_SHARED_FROM_THIS, compress, response, 0);
 }
 
 AsyncStatus
 OutgoingAsync::invokeCollocated(CollocatedRequestHandler* handler)
 {
+    writeRequestBody(); // The collocated dispatch reads the request from the request stream.
     return handler->invokeAsyncRequest(this, 0, _synchronous);
 }
 
@@ -1094,6 +1179,20 @@ OutgoingAsync::invoke(const string& operation)
         return; // Don't call sent/completed callback for batch AMI requests
     }
 
+    //
+    // Idempotent twoway requests can be hedged if the proxy is configured
+    // with a hedge delay.
+    //
+    if(mode == Reference::ModeTwoway && _mode != ICE_ENUM(OperationMode, Normal))
+    {
+        const int hedgeDelay = _proxy->__reference()->getHedgeDelay();
+        if(hedgeDelay != 0)
+        {
+            writeRequestBody(); // The hedge copies the request stream.
+            _hedge = ICE_MAKE_SHARED(InvocationHedge, ICE_SHARED_FROM_THIS, _os, hedgeDelay);
+        }
+    }
+
     //
     // NOTE: invokeImpl doesn't throw so this can be called from the
     // try block with the catch block calling abort() in case of an
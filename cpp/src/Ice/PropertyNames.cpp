@@ -39,6 +39,8 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.Locator.PreferSecure", false, 0),
     IceInternal::Property("Ice.Admin.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Admin.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("Ice.Admin.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("Ice.Admin.Locator.HedgeDelay", false, 0),
     IceInternal::Property("Ice.Admin.Locator.Locator", false, 0),
     IceInternal::Property("Ice.Admin.Locator.Router", false, 0),
     IceInternal::Property("Ice.Admin.Locator.CollocationOptimized", false, 0),
@@ -51,6 +53,8 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.Router.PreferSecure", false, 0),
     IceInternal::Property("Ice.Admin.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Admin.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("Ice.Admin.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("Ice.Admin.Router.HedgeDelay", false, 0),
     IceInternal::Property("Ice.Admin.Router.Locator", false, 0),
     IceInternal::Property("Ice.Admin.Router.Router", false, 0),
     IceInternal::Property("Ice.Admin.Router.CollocationOptimized", false, 0),
@@ -64,7 +68,14 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("Ice.Admin.MessageSizeMax", false, 0),
+    IceInternal::Property("Ice.Admin.MaxDispatches", false, 0),
+    IceInternal::Property("Ice.Admin.MaxQueuedRequests", false, 0),
+    IceInternal::Property("Ice.Admin.OverloadPolicy", false, 0),
+    IceInternal::Property("Ice.Admin.PriorityDispatches", false, 0),
+    IceInternal::Property("Ice.Admin.PriorityFacets", false, 0),
+    IceInternal::Property("Ice.Admin.PriorityOperations", false, 0),
     IceInternal::Property("Ice.Admin.DelayCreation", false, 0),
     IceInternal::Property("Ice.Admin.Enabled", false, 0),
     IceInternal::Property("Ice.Admin.Facets", false, 0),
@@ -83,14 +94,18 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Config", false, 0),
     IceInternal::Property("Ice.ConsoleListener", false, 0),
     IceInternal::Property("Ice.Default.CollocationOptimized", false, 0),
+    IceInternal::Property("Ice.Default.ConnectionsPerEndpoint", false, 0),
     IceInternal::Property("Ice.Default.EncodingVersion", false, 0),
     IceInternal::Property("Ice.Default.EndpointSelection", false, 0),
+    IceInternal::Property("Ice.Default.HedgeDelay", false, 0),
     IceInternal::Property("Ice.Default.Host", false, 0),
     IceInternal::Property("Ice.Default.Locator.EndpointSelection", false, 0),
     IceInternal::Property("Ice.Default.Locator.ConnectionCached", false, 0),
     IceInternal::Property("Ice.Default.Locator.PreferSecure", false, 0),
     IceInternal::Property("Ice.Default.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Default.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("Ice.Default.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("Ice.Default.Locator.HedgeDelay", false, 0),
     IceInternal::Property("Ice.Default.Locator.Locator", false, 0),
     IceInternal::Property("Ice.Default.Locator.Router", false, 0),
     IceInternal::Property("Ice.Default.Locator.CollocationOptimized", false, 0),
@@ -106,6 +121,8 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.Router.PreferSecure", false, 0),
     IceInternal::Property("Ice.Default.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Default.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("Ice.Default.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("Ice.Default.Router.HedgeDelay", false, 0),
     IceInternal::Property("Ice.Default.Router.Locator", false, 0),
     IceInternal::Property("Ice.Default.Router.Router", false, 0),
     IceInternal::Property("Ice.Default.Router.CollocationOptimized", false, 0),
@@ -114,6 +131,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.SlicedFormat", false, 0),
     IceInternal::Property("Ice.Default.SourceAddress", false, 0),
     IceInternal::Property("Ice.Default.Timeout", false, 0),
+    IceInternal::Property("Ice.DispatchTag", false, 0),
     IceInternal::Property("Ice.EventLog.Source", false, 0),
     IceInternal::Property("Ice.FactoryAssemblies", false, 0),
     IceInternal::Property("Ice.HTTPProxyHost", false, 0),
@@ -141,6 +159,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.PrintProcessId", false, 0),
     IceInternal::Property("Ice.PrintStackTraces", false, 0),
     IceInternal::Property("Ice.ProgramName", false, 0),
+    IceInternal::Property("Ice.PropagateDeadlines", false, 0),
     IceInternal::Property("Ice.RetryIntervals", false, 0),
     IceInternal::Property("Ice.ServerIdleTime", false, 0),
     IceInternal::Property("Ice.SOCKSProxyHost", false, 0),
@@ -155,6 +174,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ThreadPool.Client.Serialize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.WorkStealing", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.Size", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.SizeMax", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.SizeWarn", false, 0),
@@ -162,6 +182,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ThreadPool.Server.Serialize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.WorkStealing", false, 0),
     IceInternal::Property("Ice.ThreadPriority", false, 0),
     IceInternal::Property("Ice.Trace.Admin.Properties", false, 0),
     IceInternal::Property("Ice.Trace.Admin.Logger", false, 0),
@@ -201,7 +222,11 @@ const IceInternal::Property IceMXPropsData[] =
     IceInternal::Property("IceMX.Metrics.*.RetainDetached", false, 0),
     IceInternal::Property("IceMX.Metrics.*.Accept", false, 0),
     IceInternal::Property("IceMX.Metrics.*.Reject", false, 0),
+    IceInternal::Property("IceMX.Metrics.*.Histogram", false, 0),
+    IceInternal::Property("IceMX.Metrics.*.CpuTime", false, 0),
     IceInternal::Property("IceMX.Metrics.*", false, 0),
+    IceInternal::Property("IceMX.OpenMetrics.Host", false, 0),
+    IceInternal::Property("IceMX.OpenMetrics.Port", false, 0),
 };
 
 const IceInternal::PropertyArray
@@ -221,6 +246,8 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Locator.HedgeDelay", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.Router", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.CollocationOptimized", false, 0),
@@ -233,6 +260,8 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.Router.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Router.HedgeDelay", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.Router", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.CollocationOptimized", false, 0),
@@ -246,7 +275,14 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.MessageSizeMax", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.MaxDispatches", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.MaxQueuedRequests", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.OverloadPolicy", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.PriorityDispatches", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.PriorityFacets", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.PriorityOperations", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Close", false, 0),
@@ -258,6 +294,8 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Locator.HedgeDelay", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.Router", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.CollocationOptimized", false, 0),
@@ -270,6 +308,8 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.Router.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Router.HedgeDelay", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.Router", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.CollocationOptimized", false, 0),
@@ -283,7 +323,14 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceDiscovery.Reply.MessageSizeMax", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.MaxDispatches", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.MaxQueuedRequests", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.OverloadPolicy", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.PriorityDispatches", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.PriorityFacets", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.PriorityOperations", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Close", false, 0),
@@ -295,6 +342,8 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Locator.HedgeDelay", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.Router", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.CollocationOptimized", false, 0),
@@ -307,6 +356,8 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.Router.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Router.HedgeDelay", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.Router", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.CollocationOptimized", false, 0),
@@ -320,7 +371,14 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceDiscovery.Locator.MessageSizeMax", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.MaxDispatches", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.MaxQueuedRequests", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.OverloadPolicy", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.PriorityDispatches", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.PriorityFacets", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.PriorityOperations", false, 0),
     IceInternal::Property("IceDiscovery.Lookup", false, 0),
     IceInternal::Property("IceDiscovery.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.RetryCount", false, 0),
@@ -348,6 +406,8 @@ const IceInternal::Property IceGridDiscoveryPropsData[] =
     IceInternal::Property("IceGridDiscovery.Reply.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.Locator.HedgeDelay", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Locator.Locator", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Locator.Router", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Locator.CollocationOptimized", false, 0),
@@ -360,6 +420,8 @@ const IceInternal::Property IceGridDiscoveryPropsData[] =
     IceInternal::Property("IceGridDiscovery.Reply.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.Router.HedgeDelay", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Router.Locator", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Router.Router", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Router.CollocationOptimized", false, 0),
@@ -373,7 +435,14 @@ const IceInternal::Property IceGridDiscoveryPropsData[] =
     IceInternal::Property("IceGridDiscovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.MaxDispatches", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.MaxQueuedRequests", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.OverloadPolicy", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.PriorityDispatches", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.PriorityFacets", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.PriorityOperations", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.ACM.Close", false, 0),
@@ -385,6 +454,8 @@ const IceInternal::Property IceGridDiscoveryPropsData[] =
     IceInternal::Property("IceGridDiscovery.Locator.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.Locator.HedgeDelay", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Locator.Locator", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Locator.Router", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Locator.CollocationOptimized", false, 0),
@@ -397,6 +468,8 @@ const IceInternal::Property IceGridDiscoveryPropsData[] =
     IceInternal::Property("IceGridDiscovery.Locator.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.Router.HedgeDelay", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Router.Locator", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Router.Router", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Router.CollocationOptimized", false, 0),
@@ -410,7 +483,14 @@ const IceInternal::Property IceGridDiscoveryPropsData[] =
     IceInternal::Property("IceGridDiscovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.MaxDispatches", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.MaxQueuedRequests", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.OverloadPolicy", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.PriorityDispatches", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.PriorityFacets", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.PriorityOperations", false, 0),
     IceInternal::Property("IceGridDiscovery.Lookup", false, 0),
     IceInternal::Property("IceGridDiscovery.Timeout", false, 0),
     IceInternal::Property("IceGridDiscovery.RetryCount", false, 0),
@@ -457,6 +537,8 @@ const IceInternal::Property IceBoxAdminPropsData[] =
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.PreferSecure", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.InvocationTimeout", false, 0),
+    IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.HedgeDelay", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.Locator", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.Router", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.CollocationOptimized", false, 0),
@@ -492,6 +574,8 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.HedgeDelay", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.Locator", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.CollocationOptimized", false, 0),
@@ -504,6 +588,8 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.HedgeDelay", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.Locator", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.CollocationOptimized", false, 0),
@@ -517,7 +603,14 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.MaxDispatches", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.MaxQueuedRequests", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.OverloadPolicy", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.PriorityDispatches", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.PriorityFacets", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.PriorityOperations", false, 0),
     IceInternal::Property("IceGridAdmin.Trace.Observers", false, 0),
     IceInternal::Property("IceGridAdmin.Trace.SaveToRegistry", false, 0),
 };
@@ -539,6 +632,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Locator.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.CollocationOptimized", false, 0),
@@ -551,6 +646,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Router.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.Router", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.CollocationOptimized", false, 0),
@@ -564,7 +661,14 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.MaxDispatches", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.MaxQueuedRequests", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.OverloadPolicy", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.PriorityDispatches", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.PriorityFacets", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.PriorityOperations", false, 0),
     IceInternal::Property("IceGrid.InstanceName", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Timeout", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Heartbeat", false, 0),
@@ -577,6 +681,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Node.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Node.Locator.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.CollocationOptimized", false, 0),
@@ -589,6 +695,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Node.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Node.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Node.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Node.Router.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Node.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Node.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Node.Router.CollocationOptimized", false, 0),
@@ -602,7 +710,14 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGrid.Node.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Node.MaxDispatches", false, 0),
+    IceInternal::Property("IceGrid.Node.MaxQueuedRequests", false, 0),
+    IceInternal::Property("IceGrid.Node.OverloadPolicy", false, 0),
+    IceInternal::Property("IceGrid.Node.PriorityDispatches", false, 0),
+    IceInternal::Property("IceGrid.Node.PriorityFacets", false, 0),
+    IceInternal::Property("IceGrid.Node.PriorityOperations", false, 0),
     IceInternal::Property("IceGrid.Node.AllowRunningServersAsRoot", false, 0),
     IceInternal::Property("IceGrid.Node.AllowEndpointsOverride", false, 0),
     IceInternal::Property("IceGrid.Node.CollocateRegistry", false, 0),
@@ -625,6 +740,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.UserAccountMapper.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Node.UserAccountMapper.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Node.UserAccountMapper.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.Locator", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.Router", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.CollocationOptimized", false, 0),
@@ -637,6 +754,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.CollocationOptimized", false, 0),
@@ -654,6 +773,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.CollocationOptimized", false, 0),
@@ -666,6 +787,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.CollocationOptimized", false, 0),
@@ -679,12 +802,21 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.MaxDispatches", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.MaxQueuedRequests", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.OverloadPolicy", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.PriorityDispatches", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.PriorityFacets", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.PriorityOperations", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.CollocationOptimized", false, 0),
@@ -701,6 +833,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Locator.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.CollocationOptimized", false, 0),
@@ -713,6 +847,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Router.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.CollocationOptimized", false, 0),
@@ -726,7 +862,14 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.MaxDispatches", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.MaxQueuedRequests", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.OverloadPolicy", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.PriorityDispatches", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.PriorityFacets", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.PriorityOperations", false, 0),
     IceInternal::Property("IceGrid.Registry.CryptPasswords", false, 0),
     IceInternal::Property("IceGrid.Registry.DefaultTemplates", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ACM.Timeout", false, 0),
@@ -740,6 +883,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Locator.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.CollocationOptimized", false, 0),
@@ -752,6 +897,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Router.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.CollocationOptimized", false, 0),
@@ -765,7 +912,14 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.MaxDispatches", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.MaxQueuedRequests", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.OverloadPolicy", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.PriorityDispatches", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.PriorityFacets", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.PriorityOperations", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Enabled", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Address", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Port", false, 0),
@@ -782,6 +936,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Locator.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.CollocationOptimized", false, 0),
@@ -794,6 +950,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Router.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.CollocationOptimized", false, 0),
@@ -807,7 +965,14 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.MaxDispatches", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.MaxQueuedRequests", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.OverloadPolicy", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.PriorityDispatches", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.PriorityFacets", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.PriorityOperations", false, 0),
     IceInternal::Property("IceGrid.Registry.LMDB.MapSize", false, 0),
     IceInternal::Property("IceGrid.Registry.LMDB.Path", false, 0),
     IceInternal::Property("IceGrid.Registry.NodeSessionTimeout", false, 0),
@@ -816,6 +981,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.PermissionsVerifier.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Registry.PermissionsVerifier.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.CollocationOptimized", false, 0),
@@ -836,6 +1003,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Locator.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.CollocationOptimized", false, 0),
@@ -848,6 +1017,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Router.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.CollocationOptimized", false, 0),
@@ -861,7 +1032,14 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.MaxDispatches", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.MaxQueuedRequests", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.OverloadPolicy", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.PriorityDispatches", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.PriorityFacets", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.PriorityOperations", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionFilters", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Timeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Heartbeat", false, 0),
@@ -874,6 +1052,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Locator.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.CollocationOptimized", false, 0),
@@ -886,6 +1066,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Router.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.CollocationOptimized", false, 0),
@@ -899,13 +1081,22 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.MaxDispatches", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.MaxQueuedRequests", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.OverloadPolicy", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.PriorityDispatches", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.PriorityFacets", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.PriorityOperations", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.HedgeDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.CollocationOptimized", false, 0),
@@ -943,6 +1134,8 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.Locator.PreferSecure", false, 0),
     IceInternal::Property("IcePatch2.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IcePatch2.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IcePatch2.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IcePatch2.Locator.HedgeDelay", false, 0),
     IceInternal::Property("IcePatch2.Locator.Locator", false, 0),
     IceInternal::Property("IcePatch2.Locator.Router", false, 0),
     IceInternal::Property("IcePatch2.Locator.CollocationOptimized", false, 0),
@@ -955,6 +1148,8 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.Router.PreferSecure", false, 0),
     IceInternal::Property("IcePatch2.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IcePatch2.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IcePatch2.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("IcePatch2.Router.HedgeDelay", false, 0),
     IceInternal::Property("IcePatch2.Router.Locator", false, 0),
     IceInternal::Property("IcePatch2.Router.Router", false, 0),
     IceInternal::Property("IcePatch2.Router.CollocationOptimized", false, 0),
@@ -968,7 +1163,14 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("IcePatch2.MessageSizeMax", false, 0),
+    IceInternal::Property("IcePatch2.MaxDispatches", false, 0),
+    IceInternal::Property("IcePatch2.MaxQueuedRequests", false, 0),
+    IceInternal::Property("IcePatch2.OverloadPolicy", false, 0),
+    IceInternal::Property("IcePatch2.PriorityDispatches", false, 0),
+    IceInternal::Property("IcePatch2.PriorityFacets", false, 0),
+    IceInternal::Property("IcePatch2.PriorityOperations", false, 0),
     IceInternal::Property("IcePatch2.Directory", false, 0),
     IceInternal::Property("IcePatch2.InstanceName", false, 0),
 };
@@ -1075,6 +1277,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.Locator.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.Client.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("Glacier2.Client.Locator.HedgeDelay", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.Locator", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.Router", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.CollocationOptimized", false, 0),
@@ -1087,6 +1291,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.Router.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Client.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Client.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.Client.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("Glacier2.Client.Router.HedgeDelay", false, 0),
     IceInternal::Property("Glacier2.Client.Router.Locator", false, 0),
     IceInternal::Property("Glacier2.Client.Router.Router", false, 0),
     IceInternal::Property("Glacier2.Client.Router.CollocationOptimized", false, 0),
@@ -1100,7 +1306,14 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("Glacier2.Client.MessageSizeMax", false, 0),
+    IceInternal::Property("Glacier2.Client.MaxDispatches", false, 0),
+    IceInternal::Property("Glacier2.Client.MaxQueuedRequests", false, 0),
+    IceInternal::Property("Glacier2.Client.OverloadPolicy", false, 0),
+    IceInternal::Property("Glacier2.Client.PriorityDispatches", false, 0),
+    IceInternal::Property("Glacier2.Client.PriorityFacets", false, 0),
+    IceInternal::Property("Glacier2.Client.PriorityOperations", false, 0),
     IceInternal::Property("Glacier2.Client.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Client.Buffered", false, 0),
     IceInternal::Property("Glacier2.Client.ForwardContext", false, 0),
@@ -1122,6 +1335,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.PermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.PermissionsVerifier.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("Glacier2.PermissionsVerifier.HedgeDelay", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.Locator", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.Router", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.CollocationOptimized", false, 0),
@@ -1133,6 +1348,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.SSLPermissionsVerifier.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("Glacier2.SSLPermissionsVerifier.HedgeDelay", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.Router", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.CollocationOptimized", false, 0),
@@ -1150,6 +1367,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.Locator.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.Server.Locator.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("Glacier2.Server.Locator.HedgeDelay", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.Locator", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.Router", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.CollocationOptimized", false, 0),
@@ -1162,6 +1381,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.Router.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Server.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Server.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.Server.Router.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("Glacier2.Server.Router.HedgeDelay", false, 0),
     IceInternal::Property("Glacier2.Server.Router.Locator", false, 0),
     IceInternal::Property("Glacier2.Server.Router.Router", false, 0),
     IceInternal::Property("Glacier2.Server.Router.CollocationOptimized", false, 0),
@@ -1175,7 +1396,14 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.WorkStealing", false, 0),
     IceInternal::Property("Glacier2.Server.MessageSizeMax", false, 0),
+    IceInternal::Property("Glacier2.Server.MaxDispatches", false, 0),
+    IceInternal::Property("Glacier2.Server.MaxQueuedRequests", false, 0),
+    IceInternal::Property("Glacier2.Server.OverloadPolicy", false, 0),
+    IceInternal::Property("Glacier2.Server.PriorityDispatches", false, 0),
+    IceInternal::Property("Glacier2.Server.PriorityFacets", false, 0),
+    IceInternal::Property("Glacier2.Server.PriorityOperations", false, 0),
     IceInternal::Property("Glacier2.Server.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Server.Buffered", false, 0),
     IceInternal::Property("Glacier2.Server.ForwardContext", false, 0),
@@ -1187,6 +1415,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SessionManager.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.SessionManager.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.SessionManager.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.SessionManager.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("Glacier2.SessionManager.HedgeDelay", false, 0),
     IceInternal::Property("Glacier2.SessionManager.Locator", false, 0),
     IceInternal::Property("Glacier2.SessionManager.Router", false, 0),
     IceInternal::Property("Glacier2.SessionManager.CollocationOptimized", false, 0),
@@ -1197,6 +1427,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SSLSessionManager.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.SSLSessionManager.ConnectionsPerEndpoint", false, 0),
+    IceInternal::Property("Glacier2.SSLSessionManager.HedgeDelay", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.Locator", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.Router", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.CollocationOptimized", false, 0),
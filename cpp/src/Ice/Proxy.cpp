@@ -433,6 +433,25 @@ IceProxy::Ice::Object::__begin_ice_invoke(const string& operation,
     return __result;
 }
 
+AsyncResultPtr
+IceProxy::Ice::Object::__begin_ice_invoke(const RequestBodyPtr& body,
+                                          const ::IceInternal::CallbackBasePtr& del,
+                                          const ::Ice::LocalObjectPtr& cookie,
+                                          bool sync)
+{
+    OutgoingAsyncPtr __result = new CallbackOutgoing(this, ice_invoke_name, del, cookie, sync);
+    try
+    {
+        __result->prepare(body);
+        __result->invoke(body->getOperation());
+    }
+    catch(const Exception& __ex)
+    {
+        __result->abort(__ex);
+    }
+    return __result;
+}
+
 bool
 IceProxy::Ice::Object::___end_ice_invoke(pair<const Byte*, const Byte*>& outEncaps, const AsyncResultPtr& __result)
 {
@@ -28,6 +28,7 @@
 #include <Ice/ConnectionRequestHandler.h>
 #include <Ice/DefaultsAndOverrides.h>
 #include <Ice/Comparable.h>
+#include <Ice/MetricsAdminI.h> // For newMetricsCacheId().
 
 #include <IceUtil/StringUtil.h>
 #include <IceUtil/Random.h>
@@ -46,6 +47,7 @@ namespace
 {
 
 IceUtil::Mutex* hashMutex = 0;
+IceUtil::Mutex* requestHeaderMutex = 0;
 
 class Init
 {
@@ -54,12 +56,15 @@ public:
     Init()
     {
         hashMutex = new IceUtil::Mutex;
+        requestHeaderMutex = new IceUtil::Mutex;
     }
 
     ~Init()
     {
         delete hashMutex;
         hashMutex = 0;
+        delete requestHeaderMutex;
+        requestHeaderMutex = 0;
     }
 };
 
@@ -86,6 +91,7 @@ IceInternal::Reference::changeContext(const Context& newContext) const
 {
     ReferencePtr r = _instance->referenceFactory()->copy(this);
     r->_context = new SharedContext(newContext);
+    r->clearRequestHeader();
     return r;
 }
 
@@ -122,6 +128,7 @@ IceInternal::Reference::changeIdentity(const Identity& newIdentity) const
     }
     ReferencePtr r = _instance->referenceFactory()->copy(this);
     r->_identity = newIdentity;
+    r->clearRequestHeader();
     return r;
 }
 
@@ -134,6 +141,7 @@ IceInternal::Reference::changeFacet(const string& newFacet) const
     }
     ReferencePtr r = _instance->referenceFactory()->copy(this);
     r->_facet = newFacet;
+    r->clearRequestHeader();
     return r;
 }
 
@@ -186,6 +194,79 @@ Reference::hash() const
     return _hashValue;
 }
 
+Ice::Long
+IceInternal::Reference::getMetricsCacheId() const
+{
+    Ice::Long id = _metricsCacheId.load();
+    if(id == 0)
+    {
+        //
+        // Another thread might assign the identifier concurrently, the
+        // first assigned identifier is used.
+        //
+        IceUtil::Int64 expected = 0;
+        id = newMetricsCacheId();
+        if(!_metricsCacheId.compare_exchange_strong(expected, id))
+        {
+            id = expected;
+        }
+    }
+    return id;
+}
+
+const Reference::RequestHeader&
+IceInternal::Reference::getRequestHeader() const
+{
+    //
+    // The header is encoded on first use, many references are never
+    // used for invocations. Once set it's immutable and can be read
+    // without locking.
+    //
+    if(_requestHeaderInitialized.load() == 0)
+    {
+        IceUtilInternal::MutexPtrLock<IceUtil::Mutex> lock(requestHeaderMutex);
+        if(!_requestHeader)
+        {
+            _requestHeader = createRequestHeader();
+            _requestHeaderInitialized.exchange(1);
+        }
+    }
+    return *_requestHeader;
+}
+
+void
+IceInternal::Reference::clearRequestHeader()
+{
+    // Only called on a new reference, before it's shared.
+    _requestHeader = 0;
+    _requestHeaderInitialized.exchange(0);
+}
+
+Reference::RequestHeaderPtr
+IceInternal::Reference::createRequestHeader() const
+{
+    OutputStream os(_instance.get(), Ice::currentProtocolEncoding);
+    os.write(_identity);
+
+    //
+    // For compatibility with the old FacetPath.
+    //
+    if(_facet.empty())
+    {
+        os.write(static_cast<string*>(0), static_cast<string*>(0));
+    }
+    else
+    {
+        os.write(&_facet, &_facet + 1);
+    }
+
+    RequestHeaderPtr header = new RequestHeader;
+    header->contextPos = os.b.size();
+    os.write(_context->getValue());
+    header->bytes.assign(os.b.begin(), os.b.end());
+    return header;
+}
+
 void
 IceInternal::Reference::streamWrite(OutputStream* s) const
 {
@@ -219,6 +300,27 @@ IceInternal::Reference::streamWrite(OutputStream* s) const
     // Derived class writes the remainder of the reference.
 }
 
+void
+IceInternal::Reference::writeRequestHeader(OutputStream* s, const string& operation, OperationMode mode,
+                                           bool writeContext) const
+{
+    const RequestHeader& header = getRequestHeader();
+    s->writeBlob(&header.bytes[0], header.contextPos);
+    s->write(operation, false);
+    s->write(static_cast<Byte>(mode));
+    if(writeContext)
+    {
+        s->writeBlob(&header.bytes[0] + header.contextPos, header.bytes.size() - header.contextPos);
+    }
+}
+
+void
+IceInternal::Reference::writeIdentityAndFacet(OutputStream* s) const
+{
+    const RequestHeader& header = getRequestHeader();
+    s->writeBlob(&header.bytes[0], header.contextPos);
+}
+
 string
 IceInternal::Reference::toString() const
 {
@@ -527,6 +629,8 @@ IceInternal::Reference::Reference(const InstancePtr& instance,
     _protocol(protocol),
     _encoding(encoding),
     _invocationTimeout(invocationTimeout),
+    _requestHeaderInitialized(0),
+    _metricsCacheId(0),
     _overrideCompress(false),
     _compress(false)
 {
@@ -544,9 +648,21 @@ IceInternal::Reference::Reference(const Reference& r) :
     _protocol(r._protocol),
     _encoding(r._encoding),
     _invocationTimeout(r._invocationTimeout),
+    _requestHeaderInitialized(0),
+    _metricsCacheId(0),
     _overrideCompress(r._overrideCompress),
     _compress(r._compress)
 {
+    //
+    // Share the request header if it's already encoded, the methods
+    // creating a reference with a different identity, facet or context
+    // clear it.
+    //
+    if(r._requestHeaderInitialized.load() > 0)
+    {
+        _requestHeader = r._requestHeader;
+        _requestHeaderInitialized.exchange(1);
+    }
 }
 
 int
@@ -635,6 +751,12 @@ IceInternal::FixedReference::getConnectionId() const
     return string();
 }
 
+int
+IceInternal::FixedReference::getHedgeDelay() const
+{
+    return 0;
+}
+
 ReferencePtr
 IceInternal::FixedReference::changeEndpoints(const vector<EndpointIPtr>& /*newEndpoints*/) const
 {
@@ -892,6 +1014,8 @@ IceInternal::RoutableReference::RoutableReference(const InstancePtr& instance,
                                                   EndpointSelectionType endpointSelection,
                                                   int locatorCacheTimeout,
                                                   int invocationTimeout,
+                                                  int connectionsPerEndpoint,
+                                                  int hedgeDelay,
                                                   const Ice::Context& ctx) :
     Reference(instance, communicator, id, facet, mode, secure, protocol, encoding, invocationTimeout, ctx),
     _endpoints(endpoints),
@@ -903,6 +1027,8 @@ IceInternal::RoutableReference::RoutableReference(const InstancePtr& instance,
     _preferSecure(preferSecure),
     _endpointSelection(endpointSelection),
     _locatorCacheTimeout(locatorCacheTimeout),
+    _connectionsPerEndpoint(connectionsPerEndpoint),
+    _hedgeDelay(hedgeDelay),
     _overrideTimeout(false),
     _timeout(-1)
 {
@@ -969,6 +1095,18 @@ IceInternal::RoutableReference::getConnectionId() const
     return _connectionId;
 }
 
+int
+IceInternal::RoutableReference::getConnectionsPerEndpoint() const
+{
+    return _connectionsPerEndpoint;
+}
+
+int
+IceInternal::RoutableReference::getHedgeDelay() const
+{
+    return _hedgeDelay;
+}
+
 ReferencePtr
 IceInternal::RoutableReference::changeEncoding(const Ice::EncodingVersion& encoding) const
 {
@@ -1157,6 +1295,30 @@ IceInternal::RoutableReference::changeConnectionId(const string& id) const
     return r;
 }
 
+ReferencePtr
+IceInternal::RoutableReference::changeConnectionsPerEndpoint(int count) const
+{
+    if(count == _connectionsPerEndpoint)
+    {
+        return RoutableReferencePtr(const_cast<RoutableReference*>(this));
+    }
+    RoutableReferencePtr r = RoutableReferencePtr::dynamicCast(getInstance()->referenceFactory()->copy(this));
+    r->_connectionsPerEndpoint = count;
+    return r;
+}
+
+ReferencePtr
+IceInternal::RoutableReference::changeHedgeDelay(int delay) const
+{
+    if(delay == _hedgeDelay)
+    {
+        return RoutableReferencePtr(const_cast<RoutableReference*>(this));
+    }
+    RoutableReferencePtr r = RoutableReferencePtr::dynamicCast(getInstance()->referenceFactory()->copy(this));
+    r->_hedgeDelay = delay;
+    return r;
+}
+
 bool
 IceInternal::RoutableReference::isIndirect() const
 {
@@ -1253,7 +1415,8 @@ IceInternal::RoutableReference::toProperty(const string& prefix) const
     properties[prefix + ".CollocationOptimized"] = _collocationOptimized ? "1" : "0";
     properties[prefix + ".ConnectionCached"] = _cacheConnection ? "1" : "0";
     properties[prefix + ".PreferSecure"] = _preferSecure ? "1" : "0";
-    properties[prefix + ".EndpointSelection"] = _endpointSelection == Random ? "Random" : "Ordered";
+    properties[prefix + ".EndpointSelection"] =
+        _endpointSelection == Random ? "Random" : (_endpointSelection == Ordered ? "Ordered" : "LatencyAware");
     {
         ostringstream s;
         s << _locatorCacheTimeout;
@@ -1264,6 +1427,18 @@ IceInternal::RoutableReference::toProperty(const string& prefix) const
         s << getInvocationTimeout();
         properties[prefix + ".InvocationTimeout"] = s.str();
     }
+    if(_connectionsPerEndpoint > 1)
+    {
+        ostringstream s;
+        s << _connectionsPerEndpoint;
+        properties[prefix + ".ConnectionsPerEndpoint"] = s.str();
+    }
+    if(_hedgeDelay != 0)
+    {
+        ostringstream s;
+        s << _hedgeDelay;
+        properties[prefix + ".HedgeDelay"] = s.str();
+    }
     if(_routerInfo)
     {
         PropertyDict routerProperties = _routerInfo->getRouter()->__reference()->toProperty(prefix + ".Router");
@@ -1362,6 +1537,14 @@ IceInternal::RoutableReference::operator==(const Reference& r) const
     {
         return false;
     }
+    if(_connectionsPerEndpoint != rhs->_connectionsPerEndpoint)
+    {
+        return false;
+    }
+    if(_hedgeDelay != rhs->_hedgeDelay)
+    {
+        return false;
+    }
     return true;
 }
 
@@ -1493,6 +1676,22 @@ IceInternal::RoutableReference::operator<(const Reference& r) const
     {
         return false;
     }
+    if(_connectionsPerEndpoint < rhs->_connectionsPerEndpoint)
+    {
+        return true;
+    }
+    else if(rhs->_connectionsPerEndpoint < _connectionsPerEndpoint)
+    {
+        return false;
+    }
+    if(_hedgeDelay < rhs->_hedgeDelay)
+    {
+        return true;
+    }
+    else if(rhs->_hedgeDelay < _hedgeDelay)
+    {
+        return false;
+    }
     return false;
 }
 
@@ -1732,7 +1931,8 @@ IceInternal::RoutableReference::createConnection(const vector<EndpointIPtr>& all
         // Get an existing connection or create one if there's no
         // existing connection to one of the given endpoints.
         //
-        factory->create(endpoints, false, getEndpointSelection(), new CB1(_routerInfo, callback));
+        factory->create(endpoints, false, getEndpointSelection(), trackEndpointLatency(),
+                        new CB1(_routerInfo, callback));
         return;
     }
     else
@@ -1775,7 +1975,8 @@ IceInternal::RoutableReference::createConnection(const vector<EndpointIPtr>& all
                 endpoint.push_back(_endpoints[_i]);
 
                 OutgoingConnectionFactoryPtr factory = _reference->getInstance()->outgoingConnectionFactory();
-                factory->create(endpoint, more, _reference->getEndpointSelection(), this);
+                factory->create(endpoint, more, _reference->getEndpointSelection(),
+                                _reference->trackEndpointLatency(), this);
             }
 
             CB2(const RoutableReferencePtr& reference, const vector<EndpointIPtr>& endpoints,
@@ -1807,11 +2008,18 @@ IceInternal::RoutableReference::createConnection(const vector<EndpointIPtr>& all
         vector<EndpointIPtr> endpt;
         endpt.push_back(endpoints[0]);
         RoutableReference* self = const_cast<RoutableReference*>(this);
-        factory->create(endpt, true, getEndpointSelection(), new CB2(self, endpoints, callback));
+        factory->create(endpt, true, getEndpointSelection(), trackEndpointLatency(),
+                        new CB2(self, endpoints, callback));
         return;
     }
 }
 
+bool
+IceInternal::RoutableReference::trackEndpointLatency() const
+{
+    return _endpointSelection == LatencyAware || _hedgeDelay < 0;
+}
+
 void
 IceInternal::RoutableReference::applyOverrides(vector<EndpointIPtr>& endpoints) const
 {
@@ -1840,6 +2048,8 @@ IceInternal::RoutableReference::RoutableReference(const RoutableReference& r) :
     _preferSecure(r._preferSecure),
     _endpointSelection(r._endpointSelection),
     _locatorCacheTimeout(r._locatorCacheTimeout),
+    _connectionsPerEndpoint(r._connectionsPerEndpoint),
+    _hedgeDelay(r._hedgeDelay),
     _overrideTimeout(r._overrideTimeout),
     _timeout(r._timeout),
     _connectionId(r._connectionId)
@@ -1918,6 +2128,11 @@ IceInternal::RoutableReference::filterEndpoints(const vector<EndpointIPtr>& allE
             // Nothing to do.
             break;
         }
+        case LatencyAware:
+        {
+            getInstance()->outgoingConnectionFactory()->endpointLatencies()->sort(endpoints);
+            break;
+        }
         default:
         {
             assert(false);
@@ -11,6 +11,7 @@
 #define ICE_REFERENCE_H
 
 #include <IceUtil/Shared.h>
+#include <IceUtil/Atomic.h>
 #include <Ice/ReferenceF.h>
 #include <Ice/ReferenceFactoryF.h>
 #include <Ice/EndpointIF.h>
@@ -24,6 +25,7 @@
 #include <Ice/BatchRequestQueue.h>
 #include <Ice/SharedContext.h>
 #include <Ice/Identity.h>
+#include <Ice/Current.h>
 #include <Ice/Protocol.h>
 #include <Ice/Properties.h>
 
@@ -86,6 +88,7 @@ public:
     virtual Ice::EndpointSelectionType getEndpointSelection() const = 0;
     virtual int getLocatorCacheTimeout() const = 0;
     virtual std::string getConnectionId() const = 0;
+    virtual int getHedgeDelay() const = 0;
 
     //
     // The change* methods (here and in derived classes) create
@@ -116,6 +119,12 @@ public:
 
     int hash() const; // Conceptually const.
 
+    //
+    // The identifier of the reference for the metrics entry cache, see
+    // IceInternal::MetricsCacheKey. It's assigned on first use.
+    //
+    Ice::Long getMetricsCacheId() const;
+
     //
     // Utility methods.
     //
@@ -127,6 +136,21 @@ public:
     //
     virtual void streamWrite(Ice::OutputStream*) const;
 
+    //
+    // Marshal the request header fields of an invocation on this
+    // reference: the identity, facet, operation and mode followed by
+    // the proxy context if the last parameter is true. The identity,
+    // facet and context only depend on the reference so their encoded
+    // bytes are computed once, on first use.
+    //
+    void writeRequestHeader(Ice::OutputStream*, const std::string&, Ice::OperationMode, bool) const;
+
+    //
+    // Marshal the identity and facet of the request header, for
+    // requests which are sent with a shared request body.
+    //
+    void writeIdentityAndFacet(Ice::OutputStream*) const;
+
     //
     // Convert the reference to its string form.
     //
@@ -173,6 +197,29 @@ private:
     Ice::EncodingVersion _encoding;
     int _invocationTimeout;
 
+    //
+    // The encoded identity and facet followed by the encoded context,
+    // immutable and shared with the copies of the reference which don't
+    // change these fields.
+    //
+    class RequestHeader : public IceUtil::Shared
+    {
+    public:
+
+        std::vector<Ice::Byte> bytes;
+        size_t contextPos;
+    };
+    typedef IceUtil::Handle<RequestHeader> RequestHeaderPtr;
+
+    const RequestHeader& getRequestHeader() const;
+    void clearRequestHeader();
+    RequestHeaderPtr createRequestHeader() const;
+
+    mutable RequestHeaderPtr _requestHeader;
+    mutable IceUtilInternal::Atomic _requestHeaderInitialized;
+
+    mutable IceUtilInternal::Atomic64 _metricsCacheId;
+
 protected:
 
     bool _overrideCompress;
@@ -194,6 +241,7 @@ public:
     virtual Ice::EndpointSelectionType getEndpointSelection() const;
     virtual int getLocatorCacheTimeout() const;
     virtual std::string getConnectionId() const;
+    virtual int getHedgeDelay() const;
 
     virtual ReferencePtr changeEndpoints(const std::vector<EndpointIPtr>&) const;
     virtual ReferencePtr changeAdapterId(const std::string&) const;
@@ -237,7 +285,7 @@ public:
     RoutableReference(const InstancePtr&, const Ice::CommunicatorPtr&, const Ice::Identity&, const std::string&, Mode,
                       bool, const Ice::ProtocolVersion&, const Ice::EncodingVersion&, const std::vector<EndpointIPtr>&,
                       const std::string&, const LocatorInfoPtr&, const RouterInfoPtr&, bool, bool, bool,
-                      Ice::EndpointSelectionType, int, int, const Ice::Context&);
+                      Ice::EndpointSelectionType, int, int, int, int, const Ice::Context&);
 
     virtual std::vector<EndpointIPtr> getEndpoints() const;
     virtual std::string getAdapterId() const;
@@ -249,6 +297,8 @@ public:
     virtual Ice::EndpointSelectionType getEndpointSelection() const;
     virtual int getLocatorCacheTimeout() const;
     virtual std::string getConnectionId() const;
+    int getConnectionsPerEndpoint() const;
+    virtual int getHedgeDelay() const;
 
     virtual ReferencePtr changeEncoding(const Ice::EncodingVersion&) const;
     virtual ReferencePtr changeCompress(bool) const;
@@ -264,6 +314,8 @@ public:
 
     virtual ReferencePtr changeTimeout(int) const;
     virtual ReferencePtr changeConnectionId(const std::string&) const;
+    ReferencePtr changeConnectionsPerEndpoint(int) const;
+    ReferencePtr changeHedgeDelay(int) const;
 
     virtual bool isIndirect() const;
     virtual bool isWellKnown() const;
@@ -286,6 +338,13 @@ public:
     void createConnection(const std::vector<EndpointIPtr>&, const GetConnectionCallbackPtr&) const;
     void applyOverrides(std::vector<EndpointIPtr>&) const;
 
+    //
+    // Whether the connections must measure the endpoint latency, used
+    // by the LatencyAware endpoint selection and the adaptive hedge
+    // delay.
+    //
+    bool trackEndpointLatency() const;
+
 protected:
 
     RoutableReference(const RoutableReference&);
@@ -306,6 +365,8 @@ private:
     bool _preferSecure;
     Ice::EndpointSelectionType _endpointSelection;
     int _locatorCacheTimeout;
+    int _connectionsPerEndpoint;
+    int _hedgeDelay;
 
     bool _overrideTimeout;
     int _timeout; // Only used if _overrideTimeout == true
@@ -715,6 +715,8 @@ IceInternal::ReferenceFactory::checkForUnknownProperties(const string& prefix)
         "PreferSecure",
         "LocatorCacheTimeout",
         "InvocationTimeout",
+        "ConnectionsPerEndpoint",
+        "HedgeDelay",
         "Locator",
         "Router",
         "CollocationOptimized",
@@ -799,6 +801,8 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
     Ice::EndpointSelectionType endpointSelection = defaultsAndOverrides->defaultEndpointSelection;
     int locatorCacheTimeout = defaultsAndOverrides->defaultLocatorCacheTimeout;
     int invocationTimeout = defaultsAndOverrides->defaultInvocationTimeout;
+    int connectionsPerEndpoint = defaultsAndOverrides->defaultConnectionsPerEndpoint;
+    int hedgeDelay = defaultsAndOverrides->defaultHedgeDelay;
     Ice::Context ctx;
 
     //
@@ -865,10 +869,14 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
             {
                 endpointSelection = Ordered;
             }
+            else if(type == "LatencyAware")
+            {
+                endpointSelection = LatencyAware;
+            }
             else
             {
                 EndpointSelectionTypeParseException ex(__FILE__, __LINE__);
-                ex.str = "illegal value `" + type + "'; expected `Random' or `Ordered'";
+                ex.str = "illegal value `" + type + "'; expected `Random', `Ordered' or `LatencyAware'";
                 throw ex;
             }
         }
@@ -903,6 +911,36 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
             }
         }
 
+        property = propertyPrefix + ".ConnectionsPerEndpoint";
+        value = properties->getProperty(property);
+        if(!value.empty())
+        {
+            connectionsPerEndpoint = properties->getPropertyAsIntWithDefault(property, connectionsPerEndpoint);
+            if(connectionsPerEndpoint < 1)
+            {
+                connectionsPerEndpoint = 1;
+
+                Warning out(_instance->initializationData().logger);
+                out << "invalid value for " << property << "`" << properties->getProperty(property) << "'"
+                    << ": defaulting to 1";
+            }
+        }
+
+        property = propertyPrefix + ".HedgeDelay";
+        value = properties->getProperty(property);
+        if(!value.empty())
+        {
+            hedgeDelay = properties->getPropertyAsIntWithDefault(property, hedgeDelay);
+            if(hedgeDelay < -1)
+            {
+                hedgeDelay = 0;
+
+                Warning out(_instance->initializationData().logger);
+                out << "invalid value for " << property << "`" << properties->getProperty(property) << "'"
+                    << ": defaulting to 0";
+            }
+        }
+
         property = propertyPrefix + ".Context.";
         PropertyDict contexts = properties->getPropertiesForPrefix(property);
         for(PropertyDict::const_iterator p = contexts.begin(); p != contexts.end(); ++p)
@@ -932,6 +970,8 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
                                  endpointSelection,
                                  locatorCacheTimeout,
                                  invocationTimeout,
+                                 connectionsPerEndpoint,
+                                 hedgeDelay,
                                  ctx);
 }
 
@@ -0,0 +1,36 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/RequestBody.h>
+#include <Ice/OutputStream.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceInternal::RequestBody::RequestBody(const CommunicatorPtr& communicator,
+                                      const string& operation,
+                                      OperationMode mode,
+                                      const pair<const Byte*, const Byte*>& inEncaps,
+                                      const Context& context) :
+    _operation(operation),
+    _mode(mode),
+    _context(context)
+{
+    OutputStream os(communicator, currentProtocolEncoding);
+    os.write(_operation, false);
+    os.write(static_cast<Byte>(_mode));
+    os.write(_context);
+    _encapsPos = os.b.size();
+    if(inEncaps.first != inEncaps.second)
+    {
+        os.writeEncapsulation(inEncaps.first, static_cast<Int>(inEncaps.second - inEncaps.first));
+    }
+    _bytes.assign(os.b.begin(), os.b.end());
+}
@@ -10,7 +10,7 @@
 #include <Ice/RequestHandlerFactory.h>
 #include <Ice/CollocatedRequestHandler.h>
 #include <Ice/ConnectRequestHandler.h>
-#include <Ice/CollocatedRequestHandler.h>
+#include <Ice/ConnectionPoolRequestHandler.h>
 #include <Ice/Reference.h>
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/Instance.h>
@@ -34,6 +34,22 @@ IceInternal::RequestHandlerFactory::getRequestHandler(const RoutableReferencePtr
         }
     }
 
+    //
+    // Twoway invocations are spread over the connections of the pool,
+    // other invocations use a single connection to preserve ordering.
+    //
+    if(ref->getConnectionsPerEndpoint() > 1 && ref->getCacheConnection() && ref->getMode() == Reference::ModeTwoway)
+    {
+        return proxy->__setRequestHandler(ICE_MAKE_SHARED(ConnectionPoolRequestHandler, ref, proxy));
+    }
+
+    return proxy->__setRequestHandler(getConnectRequestHandler(ref, proxy));
+}
+
+RequestHandlerPtr
+IceInternal::RequestHandlerFactory::getConnectRequestHandler(const RoutableReferencePtr& ref,
+                                                             const Ice::ObjectPrxPtr& proxy)
+{
     ConnectRequestHandlerPtr handler;
     bool connect = false;
     if(ref->getCacheConnection())
@@ -64,7 +80,7 @@ IceInternal::RequestHandlerFactory::getRequestHandler(const RoutableReferencePtr
         ref->getConnection(handler.get());
 #endif
     }
-    return proxy->__setRequestHandler(handler->connect(proxy));
+    return handler->connect(proxy);
 }
 
 void
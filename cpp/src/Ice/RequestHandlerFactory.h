@@ -29,6 +29,7 @@ public:
     RequestHandlerFactory(const InstancePtr&);
 
     RequestHandlerPtr getRequestHandler(const RoutableReferencePtr&, const Ice::ObjectPrxPtr&);
+    RequestHandlerPtr getConnectRequestHandler(const RoutableReferencePtr&, const Ice::ObjectPrxPtr&);
     void removeRequestHandler(const ReferencePtr&, const RequestHandlerPtr&);
 
 private:
@@ -46,6 +46,11 @@ public:
     Ice::ServantLocatorPtr removeServantLocator(const std::string&);
     Ice::ServantLocatorPtr findServantLocator(const std::string&) const;
 
+    const std::string& getAdapterName() const
+    {
+        return _adapterName; // Immutable
+    }
+
 private:
 
     ServantManager(const InstancePtr&, const std::string&);
@@ -0,0 +1,470 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/ThreadCache.h>
+#include <IceUtil/Mutex.h>
+#include <stdlib.h>
+
+#ifndef _WIN32
+#   include <pthread.h>
+#endif
+
+using namespace std;
+using namespace IceInternal;
+
+namespace
+{
+
+//
+// Blocks are cached in size classes of 16 bytes up to 1KB, this is
+// enough for the invocation objects of both mappings.
+//
+const size_t sizeClassGranularity = 16;
+const size_t sizeClassCount = 64;
+const size_t maxThreadBlocks = 32;
+const size_t transferBatchSize = 16;
+const size_t maxDepotBlocks = 1024;
+
+const size_t maxBufferCapacity = 32 * 1024;
+const size_t maxThreadBuffers = 8;
+const size_t maxDepotBuffers = 64;
+
+struct Block
+{
+    Block* next;
+};
+
+struct FreeList
+{
+    Block* head;
+    size_t count;
+};
+
+//
+// The header of a cached buffer, stored in the buffer itself.
+//
+struct BufferBlock
+{
+    BufferBlock* next;
+    size_t capacity;
+};
+
+IceUtil::Mutex* depotMutex = 0;
+FreeList depotBlocks[sizeClassCount];
+BufferBlock* depotBuffers = 0;
+size_t depotBufferCount = 0;
+
+inline size_t
+sizeClass(size_t size)
+{
+    return size ? (size - 1) / sizeClassGranularity : 0;
+}
+
+inline size_t
+classSize(size_t index)
+{
+    return (index + 1) * sizeClassGranularity;
+}
+
+void
+freeList(FreeList& l)
+{
+    while(l.head)
+    {
+        Block* b = l.head;
+        l.head = b->next;
+        ::free(b);
+    }
+    l.count = 0;
+}
+
+void
+freeBuffers(BufferBlock*& head, size_t& count)
+{
+    while(head)
+    {
+        BufferBlock* b = head;
+        head = b->next;
+        ::free(b);
+    }
+    count = 0;
+}
+
+class Cache : private IceUtil::noncopyable
+{
+public:
+
+    Cache() :
+        _buffers(0),
+        _bufferCount(0)
+    {
+        for(size_t i = 0; i < sizeClassCount; ++i)
+        {
+            _blocks[i].head = 0;
+            _blocks[i].count = 0;
+        }
+    }
+
+    ~Cache()
+    {
+        //
+        // Return the cached memory to the depot if it's still
+        // available, otherwise release it.
+        //
+        if(depotMutex)
+        {
+            IceUtil::Mutex::Lock sync(*depotMutex);
+            for(size_t i = 0; i < sizeClassCount; ++i)
+            {
+                transfer(_blocks[i], depotBlocks[i], _blocks[i].count, maxDepotBlocks);
+            }
+            while(_buffers && depotBufferCount < maxDepotBuffers)
+            {
+                BufferBlock* b = _buffers;
+                _buffers = b->next;
+                --_bufferCount;
+                b->next = depotBuffers;
+                depotBuffers = b;
+                ++depotBufferCount;
+            }
+        }
+        for(size_t i = 0; i < sizeClassCount; ++i)
+        {
+            freeList(_blocks[i]);
+        }
+        freeBuffers(_buffers, _bufferCount);
+    }
+
+    void* allocate(size_t size)
+    {
+        const size_t index = sizeClass(size);
+        FreeList& l = _blocks[index];
+        if(!l.head && depotMutex)
+        {
+            IceUtil::Mutex::Lock sync(*depotMutex);
+            transfer(depotBlocks[index], l, transferBatchSize, maxThreadBlocks);
+        }
+
+        if(l.head)
+        {
+            Block* b = l.head;
+            l.head = b->next;
+            --l.count;
+            return b;
+        }
+        return ::malloc(classSize(index));
+    }
+
+    void deallocate(void* p, size_t size)
+    {
+        const size_t index = sizeClass(size);
+        FreeList& l = _blocks[index];
+        if(l.count >= maxThreadBlocks)
+        {
+            //
+            // This thread releases more blocks than it allocates, give
+            // a batch to the depot for the threads which allocate them.
+            //
+            if(depotMutex)
+            {
+                IceUtil::Mutex::Lock sync(*depotMutex);
+                transfer(l, depotBlocks[index], transferBatchSize, maxDepotBlocks);
+            }
+
+            if(l.count >= maxThreadBlocks)
+            {
+                ::free(p);
+                return;
+            }
+        }
+
+        Block* b = static_cast<Block*>(p);
+        b->next = l.head;
+        l.head = b;
+        ++l.count;
+    }
+
+    void* allocateBuffer(size_t size, size_t& capacity)
+    {
+        //
+        // The depot count is checked without locking to avoid locking
+        // the mutex when the depot is empty, the worst case is a missed
+        // buffer.
+        //
+        void* p = takeBuffer(_buffers, _bufferCount, size, capacity);
+        if(!p && depotBufferCount > 0 && depotMutex)
+        {
+            IceUtil::Mutex::Lock sync(*depotMutex);
+            p = takeBuffer(depotBuffers, depotBufferCount, size, capacity);
+        }
+        return p;
+    }
+
+    bool deallocateBuffer(void* p, size_t capacity)
+    {
+        if(_bufferCount < maxThreadBuffers)
+        {
+            putBuffer(_buffers, _bufferCount, p, capacity);
+            return true;
+        }
+        else if(depotMutex)
+        {
+            IceUtil::Mutex::Lock sync(*depotMutex);
+            if(depotBufferCount < maxDepotBuffers)
+            {
+                putBuffer(depotBuffers, depotBufferCount, p, capacity);
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+
+    static void transfer(FreeList& from, FreeList& to, size_t count, size_t max)
+    {
+        while(from.head && count-- > 0 && to.count < max)
+        {
+            Block* b = from.head;
+            from.head = b->next;
+            --from.count;
+            b->next = to.head;
+            to.head = b;
+            ++to.count;
+        }
+    }
+
+    static void* takeBuffer(BufferBlock*& head, size_t& count, size_t size, size_t& capacity)
+    {
+        //
+        // Take the smallest buffer which is large enough.
+        //
+        BufferBlock** best = 0;
+        for(BufferBlock** q = &head; *q; q = &(*q)->next)
+        {
+            if((*q)->capacity >= size && (!best || (*q)->capacity < (*best)->capacity))
+            {
+                best = q;
+            }
+        }
+
+        if(!best)
+        {
+            return 0;
+        }
+
+        BufferBlock* b = *best;
+        *best = b->next;
+        --count;
+        capacity = b->capacity;
+        return b;
+    }
+
+    static void putBuffer(BufferBlock*& head, size_t& count, void* p, size_t capacity)
+    {
+        BufferBlock* b = static_cast<BufferBlock*>(p);
+        b->next = head;
+        b->capacity = capacity;
+        head = b;
+        ++count;
+    }
+
+    FreeList _blocks[sizeClassCount];
+    BufferBlock* _buffers;
+    size_t _bufferCount;
+};
+
+#ifdef _WIN32
+DWORD cacheKey = TLS_OUT_OF_INDEXES;
+#else
+pthread_key_t cacheKey;
+#endif
+bool cacheKeyInitialized = false;
+
+}
+
+#ifndef _WIN32
+extern "C"
+{
+
+static void
+iceThreadCacheDestructor(void* p)
+{
+    delete static_cast<Cache*>(p);
+}
+
+}
+#endif
+
+namespace
+{
+
+Cache*
+getCache()
+{
+    //
+    // Before static initialization (or after static destruction) we
+    // don't cache anything.
+    //
+    if(!cacheKeyInitialized)
+    {
+        return 0;
+    }
+
+#ifdef _WIN32
+    Cache* cache = static_cast<Cache*>(TlsGetValue(cacheKey));
+#else
+    Cache* cache = static_cast<Cache*>(pthread_getspecific(cacheKey));
+#endif
+    if(!cache)
+    {
+        cache = new (nothrow) Cache;
+        if(!cache)
+        {
+            return 0;
+        }
+#ifdef _WIN32
+        if(TlsSetValue(cacheKey, cache) == 0)
+#else
+        if(pthread_setspecific(cacheKey, cache) != 0)
+#endif
+        {
+            delete cache;
+            return 0;
+        }
+    }
+    return cache;
+}
+
+class Init
+{
+public:
+
+    Init()
+    {
+        depotMutex = new IceUtil::Mutex;
+
+        //
+        // Note that we never delete this key: other threads might still
+        // be running during static destruction.
+        //
+#ifdef _WIN32
+        cacheKey = TlsAlloc();
+        cacheKeyInitialized = cacheKey != TLS_OUT_OF_INDEXES;
+#else
+        cacheKeyInitialized = pthread_key_create(&cacheKey, &iceThreadCacheDestructor) == 0;
+#endif
+    }
+
+    ~Init()
+    {
+        if(cacheKeyInitialized)
+        {
+            //
+            // The key destructor isn't called for the main thread.
+            //
+            ThreadCache::cleanupThread();
+            cacheKeyInitialized = false;
+        }
+
+        IceUtil::Mutex* mutex = depotMutex;
+        {
+            IceUtil::Mutex::Lock sync(*mutex);
+            depotMutex = 0;
+            for(size_t i = 0; i < sizeClassCount; ++i)
+            {
+                freeList(depotBlocks[i]);
+            }
+            freeBuffers(depotBuffers, depotBufferCount);
+        }
+        delete mutex;
+    }
+};
+
+Init init;
+
+}
+
+void*
+IceInternal::ThreadCache::allocate(size_t size)
+{
+    void* p;
+    if(size <= classSize(sizeClassCount - 1))
+    {
+        //
+        // Always allocate the size of the class, the block might be
+        // released to a cache.
+        //
+        Cache* cache = getCache();
+        p = cache ? cache->allocate(size) : ::malloc(classSize(sizeClass(size)));
+    }
+    else
+    {
+        p = ::malloc(size);
+    }
+
+    if(!p)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void
+IceInternal::ThreadCache::deallocate(void* p, size_t size)
+{
+    if(!p)
+    {
+        return;
+    }
+
+    Cache* cache = size <= classSize(sizeClassCount - 1) ? getCache() : 0;
+    if(cache)
+    {
+        cache->deallocate(p, size);
+    }
+    else
+    {
+        ::free(p);
+    }
+}
+
+void*
+IceInternal::ThreadCache::allocateBuffer(size_t size, size_t& capacity)
+{
+    Cache* cache = size <= maxBufferCapacity ? getCache() : 0;
+    return cache ? cache->allocateBuffer(size, capacity) : 0;
+}
+
+bool
+IceInternal::ThreadCache::deallocateBuffer(void* p, size_t capacity)
+{
+    if(capacity < sizeof(BufferBlock) || capacity > maxBufferCapacity)
+    {
+        return false;
+    }
+
+    Cache* cache = getCache();
+    return cache ? cache->deallocateBuffer(p, capacity) : false;
+}
+
+void
+IceInternal::ThreadCache::cleanupThread()
+{
+    if(cacheKeyInitialized)
+    {
+#ifdef _WIN32
+        delete static_cast<Cache*>(TlsGetValue(cacheKey));
+        TlsSetValue(cacheKey, 0);
+#else
+        delete static_cast<Cache*>(pthread_getspecific(cacheKey));
+        pthread_setspecific(cacheKey, 0);
+#endif
+    }
+}
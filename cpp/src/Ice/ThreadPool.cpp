@@ -8,6 +8,8 @@
 // **********************************************************************
 
 #include <Ice/ThreadPool.h>
+#include <Ice/WorkStealingExecutor.h>
+#include <Ice/Executor.h>
 #include <Ice/EventHandler.h>
 #include <Ice/Network.h>
 #include <Ice/LocalException.h>
@@ -115,8 +117,57 @@ class ThreadPoolDestroyedException
 {
 };
 
+class ExecuteWorkItem : public DispatchWorkItem
+{
+public:
+
+#ifdef ICE_CPP11_MAPPING
+    ExecuteWorkItem(function<void()> call) : _call(move(call))
+    {
+    }
+
+    virtual void
+    run()
+    {
+        _call();
+    }
+
+private:
+
+    const function<void()> _call;
+#else
+    ExecuteWorkItem(const DispatcherCallPtr& call) : _call(call)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        _call->run();
+    }
+
+private:
+
+    const DispatcherCallPtr _call;
+#endif
+};
+
 }
 
+#ifdef ICE_CPP11_MAPPING
+void
+Ice::executeInClientThreadPool(const CommunicatorPtr& communicator, function<void()> call)
+{
+    getInstance(communicator)->clientThreadPool()->dispatch(new ExecuteWorkItem(move(call)));
+}
+#else
+void
+Ice::executeInClientThreadPool(const CommunicatorPtr& communicator, const DispatcherCallPtr& call)
+{
+    getInstance(communicator)->clientThreadPool()->dispatch(new ExecuteWorkItem(call));
+}
+#endif
+
 Ice::DispatcherCall::~DispatcherCall()
 {
     // Out of line to avoid weak vtable
@@ -366,6 +417,36 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
     _workQueue = ICE_MAKE_SHARED(ThreadPoolWorkQueue, *this);
     _selector.initialize(_workQueue.get());
 
+    //
+    // With a work-stealing executor, the dispatch work items are
+    // executed by the executor threads instead of the work queue.
+    //
+    int workStealing = properties->getPropertyAsInt(_prefix + ".WorkStealing");
+#ifndef ICE_OS_WINRT
+    if(workStealing == -1)
+    {
+        workStealing = nProcessors;
+    }
+#endif
+    if(workStealing > 0)
+    {
+        //
+        // The executor threads run the work items concurrently and in
+        // any order, which breaks the ordering guarantees of a pool with
+        // a single thread or with serialized dispatch.
+        //
+        if(_sizeMax == 1 || _serialize)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << _prefix << ".WorkStealing ignored, the thread pool executes the work items in order ("
+                << _prefix << (_serialize ? ".Serialize > 0)" : ".SizeMax = 1)");
+        }
+        else
+        {
+            _executor = new WorkStealingExecutor(_instance, *this, _prefix, workStealing);
+        }
+    }
+
     if(_instance->traceLevels()->threadPool >= 1)
     {
         Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
@@ -425,6 +506,10 @@ IceInternal::ThreadPool::destroy()
     }
     _destroyed = true;
     _workQueue->destroy();
+    if(_executor)
+    {
+        _executor->destroy();
+    }
 }
 
 void
@@ -435,6 +520,10 @@ IceInternal::ThreadPool::updateObservers()
     {
         (*p)->updateObserver();
     }
+    if(_executor)
+    {
+        _executor->updateObservers();
+    }
 }
 
 void
@@ -565,6 +654,12 @@ IceInternal::ThreadPool::dispatchFromThisThread(const DispatchWorkItemPtr& workI
 void
 IceInternal::ThreadPool::dispatch(const DispatchWorkItemPtr& workItem)
 {
+    if(_executor)
+    {
+        _executor->execute(workItem);
+        return;
+    }
+
     Lock sync(*this);
     if(_destroyed)
     {
@@ -588,6 +683,10 @@ IceInternal::ThreadPool::joinWithAllThreads()
     {
         (*p)->getThreadControl().join();
     }
+    if(_executor)
+    {
+        _executor->joinWithAllThreads();
+    }
     _selector.destroy();
 }
 
@@ -18,6 +18,7 @@
 #include <Ice/Config.h>
 #include <Ice/Dispatcher.h>
 #include <Ice/ThreadPoolF.h>
+#include <Ice/WorkStealingExecutorF.h>
 #include <Ice/InstanceF.h>
 #include <Ice/LoggerF.h>
 #include <Ice/PropertiesF.h>
@@ -138,6 +139,7 @@ private:
     const Ice::DispatcherPtr _dispatcher;
 #endif
     ThreadPoolWorkQueuePtr _workQueue;
+    WorkStealingExecutorPtr _executor;
     bool _destroyed;
     const std::string _prefix;
     Selector _selector;
@@ -0,0 +1,437 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/WorkStealingExecutor.h>
+#include <Ice/Instance.h>
+#include <Ice/LocalException.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/Properties.h>
+#include <IceUtil/ThreadException.h>
+
+#ifndef _WIN32
+#   include <pthread.h>
+#endif
+
+using namespace std;
+using namespace Ice;
+using namespace Ice::Instrumentation;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(WorkStealingExecutor* p) { return p; }
+
+namespace
+{
+
+//
+// The executor thread running on the calling thread, if any.
+//
+#ifdef _WIN32
+DWORD workerKey = TLS_OUT_OF_INDEXES;
+#else
+pthread_key_t workerKey;
+bool workerKeyInitialized = false;
+#endif
+
+class Init
+{
+public:
+
+    Init()
+    {
+#ifdef _WIN32
+        workerKey = TlsAlloc();
+#else
+        workerKeyInitialized = pthread_key_create(&workerKey, 0) == 0;
+#endif
+    }
+};
+
+Init init;
+
+void*
+getWorker()
+{
+#ifdef _WIN32
+    return workerKey != TLS_OUT_OF_INDEXES ? TlsGetValue(workerKey) : 0;
+#else
+    return workerKeyInitialized ? pthread_getspecific(workerKey) : 0;
+#endif
+}
+
+void
+setWorker(void* worker)
+{
+#ifdef _WIN32
+    if(workerKey != TLS_OUT_OF_INDEXES && TlsSetValue(workerKey, worker) == 0)
+    {
+        throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, GetLastError());
+    }
+#else
+    if(workerKeyInitialized)
+    {
+        if(int err = pthread_setspecific(workerKey, worker))
+        {
+            throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, err);
+        }
+    }
+#endif
+}
+
+}
+
+IceInternal::WorkStealingExecutor::WorkStealingExecutor(const InstancePtr& instance, ThreadPool& threadPool,
+                                                        const string& prefix, int size) :
+    _instance(instance),
+    _threadPool(threadPool),
+    _prefix(prefix),
+    _next(0),
+    _idle(0),
+    _executing(0),
+    _destroyed(0),
+    _wakeups(0)
+{
+    assert(size > 0);
+    PropertiesPtr properties = _instance->initializationData().properties;
+    int stackSize = properties->getPropertyAsInt(_prefix + ".StackSize");
+    bool hasPriority = properties->getProperty(_prefix + ".ThreadPriority") != "";
+    int priority = properties->getPropertyAsInt(_prefix + ".ThreadPriority");
+    if(!hasPriority)
+    {
+        hasPriority = properties->getProperty("Ice.ThreadPriority") != "";
+        priority = properties->getPropertyAsInt("Ice.ThreadPriority");
+    }
+
+    //
+    // All the threads are created before any is started, they access
+    // the queues of each other.
+    //
+    for(int i = 0; i < size; ++i)
+    {
+        ostringstream os;
+        os << _prefix << "-executor-" << i;
+        _workers.push_back(new Worker(this, static_cast<size_t>(i), os.str()));
+    }
+
+    vector<WorkerPtr>::const_iterator p = _workers.begin();
+    try
+    {
+        for(; p != _workers.end(); ++p)
+        {
+            if(hasPriority)
+            {
+                (*p)->start(stackSize > 0 ? static_cast<size_t>(stackSize) : 0, priority);
+            }
+            else
+            {
+                (*p)->start(stackSize > 0 ? static_cast<size_t>(stackSize) : 0);
+            }
+        }
+    }
+    catch(const IceUtil::Exception& ex)
+    {
+        {
+            Error out(_instance->initializationData().logger);
+            out << "cannot create executor thread for `" << _prefix << "':\n" << ex;
+        }
+
+        destroy();
+        for(vector<WorkerPtr>::const_iterator q = _workers.begin(); q != p; ++q)
+        {
+            (*q)->getThreadControl().join();
+        }
+        throw;
+    }
+}
+
+IceInternal::WorkStealingExecutor::~WorkStealingExecutor()
+{
+    assert(_destroyed);
+}
+
+void
+IceInternal::WorkStealingExecutor::execute(const DispatchWorkItemPtr& workItem)
+{
+    //
+    // The executor threads don't exit until the work items queued by
+    // the threads which checked _destroyed are executed.
+    //
+    ++_executing;
+    if(_destroyed)
+    {
+        --_executing;
+        throw CommunicatorDestroyedException(__FILE__, __LINE__);
+    }
+
+    Worker* worker = static_cast<Worker*>(getWorker());
+    if(!worker || worker->_executor != this)
+    {
+        worker = _workers[static_cast<size_t>(_next++ & 0x7fffffff) % _workers.size()].get();
+    }
+    {
+        IceUtil::Mutex::Lock sync(*worker);
+        worker->_workItems.push_back(workItem);
+    }
+    --_executing;
+
+    if(_idle > 0)
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        ++_wakeups;
+        _monitor.notify();
+    }
+}
+
+void
+IceInternal::WorkStealingExecutor::destroy()
+{
+    _destroyed = 1;
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+    _monitor.notifyAll();
+}
+
+void
+IceInternal::WorkStealingExecutor::updateObservers()
+{
+    for(vector<WorkerPtr>::const_iterator p = _workers.begin(); p != _workers.end(); ++p)
+    {
+        IceUtil::Mutex::Lock sync(**p);
+        (*p)->updateObserver();
+    }
+}
+
+void
+IceInternal::WorkStealingExecutor::joinWithAllThreads()
+{
+    assert(_destroyed);
+    for(vector<WorkerPtr>::const_iterator p = _workers.begin(); p != _workers.end(); ++p)
+    {
+        (*p)->getThreadControl().join();
+    }
+}
+
+bool
+IceInternal::WorkStealingExecutor::next(size_t index, DispatchWorkItemPtr& workItem)
+{
+    while(true)
+    {
+        if(take(index, workItem))
+        {
+            return true;
+        }
+
+        if(_destroyed)
+        {
+            //
+            // Exit once the work items queued before the destruction
+            // are executed.
+            //
+            if(_executing == 0 && !take(index, workItem))
+            {
+                return false;
+            }
+            else if(workItem)
+            {
+                return true;
+            }
+            IceUtil::ThreadControl::yield();
+            continue;
+        }
+
+        //
+        // Check the queues again once the thread is counted as idle,
+        // a work item queued before the thread is counted might have
+        // been missed.
+        //
+        ++_idle;
+        if(take(index, workItem))
+        {
+            --_idle;
+            return true;
+        }
+
+        {
+            IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+            while(_wakeups == 0 && !_destroyed)
+            {
+                _monitor.wait();
+            }
+            if(_wakeups > 0)
+            {
+                --_wakeups;
+            }
+        }
+        --_idle;
+    }
+}
+
+bool
+IceInternal::WorkStealingExecutor::take(size_t index, DispatchWorkItemPtr& workItem)
+{
+    //
+    // Take the next work item of the thread queue or steal the oldest
+    // work item of another queue.
+    //
+    for(size_t i = 0; i < _workers.size(); ++i)
+    {
+        Worker* worker = _workers[(index + i) % _workers.size()].get();
+        IceUtil::Mutex::Lock sync(*worker);
+        if(!worker->_workItems.empty())
+        {
+            workItem = worker->_workItems.front();
+            worker->_workItems.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+IceInternal::WorkStealingExecutor::run(Worker* worker, const DispatchWorkItemPtr& workItem)
+{
+    {
+        IceUtil::Mutex::Lock sync(*worker);
+        worker->setState(ThreadStateInUseForUser);
+    }
+
+    try
+    {
+        _threadPool.dispatchFromThisThread(workItem);
+    }
+    catch(const exception& ex)
+    {
+        Error out(_instance->initializationData().logger);
+        out << "exception in `" << _prefix << "' executor:\n" << ex;
+    }
+    catch(...)
+    {
+        Error out(_instance->initializationData().logger);
+        out << "unknown exception in `" << _prefix << "' executor";
+    }
+
+    {
+        IceUtil::Mutex::Lock sync(*worker);
+        worker->setState(ThreadStateIdle);
+    }
+}
+
+IceInternal::WorkStealingExecutor::Worker::Worker(WorkStealingExecutor* executor, size_t index,
+                                                  const string& name) :
+    IceUtil::Thread(name),
+    _executor(executor),
+    _index(index),
+    _state(ThreadStateIdle)
+{
+    updateObserver();
+}
+
+void
+IceInternal::WorkStealingExecutor::Worker::updateObserver()
+{
+    // Must be called with the worker mutex locked
+    const CommunicatorObserverPtr& obsv = _executor->_instance->initializationData().observer;
+    if(obsv)
+    {
+        _observer.attach(obsv->getThreadObserver(_executor->_prefix, name(), _state, _observer.get()));
+    }
+}
+
+void
+IceInternal::WorkStealingExecutor::Worker::setState(ThreadState s)
+{
+    // Must be called with the worker mutex locked
+    if(_observer)
+    {
+        if(_state != s)
+        {
+            _observer->stateChanged(_state, s);
+        }
+    }
+    _state = s;
+}
+
+void
+IceInternal::WorkStealingExecutor::Worker::run()
+{
+    const InitializationData& initData = _executor->_instance->initializationData();
+#ifdef ICE_CPP11_MAPPING
+    if(initData.threadStart)
+#else
+    if(initData.threadHook)
+#endif
+    {
+        try
+        {
+#ifdef ICE_CPP11_MAPPING
+            initData.threadStart();
+#else
+            initData.threadHook->start();
+#endif
+        }
+        catch(const exception& ex)
+        {
+            Error out(initData.logger);
+            out << "thread hook start() method raised an unexpected exception in `" << _executor->_prefix << "':\n"
+                << ex;
+        }
+        catch(...)
+        {
+            Error out(initData.logger);
+            out << "thread hook start() method raised an unexpected exception in `" << _executor->_prefix << "'";
+        }
+    }
+
+    try
+    {
+        setWorker(this);
+        DispatchWorkItemPtr workItem;
+        while(_executor->next(_index, workItem))
+        {
+            _executor->run(this, workItem);
+            workItem = 0;
+        }
+        setWorker(0);
+    }
+    catch(const exception& ex)
+    {
+        Error out(initData.logger);
+        out << "exception in `" << _executor->_prefix << "' executor:\n" << ex;
+    }
+
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        _observer.detach();
+    }
+
+#ifdef ICE_CPP11_MAPPING
+    if(initData.threadStop)
+#else
+    if(initData.threadHook)
+#endif
+    {
+        try
+        {
+#ifdef ICE_CPP11_MAPPING
+            initData.threadStop();
+#else
+            initData.threadHook->stop();
+#endif
+        }
+        catch(const exception& ex)
+        {
+            Error out(initData.logger);
+            out << "thread hook stop() method raised an unexpected exception in `" << _executor->_prefix << "':\n"
+                << ex;
+        }
+        catch(...)
+        {
+            Error out(initData.logger);
+            out << "thread hook stop() method raised an unexpected exception in `" << _executor->_prefix << "'";
+        }
+    }
+}
@@ -0,0 +1,100 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_WORK_STEALING_EXECUTOR_H
+#define ICE_WORK_STEALING_EXECUTOR_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Monitor.h>
+#include <IceUtil/Thread.h>
+#include <IceUtil/Atomic.h>
+#include <Ice/ThreadPool.h>
+#include <Ice/WorkStealingExecutorF.h>
+#include <Ice/ObserverHelper.h>
+
+#include <deque>
+
+namespace IceInternal
+{
+
+//
+// Executes the dispatch work items of a thread pool with its own
+// threads. Each thread has its own queue: the work items queued by
+// an executor thread are added to its queue and the others are
+// distributed over the queues in turn. An idle thread first runs the
+// work items of its queue and then steals the oldest work items of
+// the other queues, so work items are queued and dequeued without
+// contending for the thread pool mutex.
+//
+// The work items of a queue run in order but work items queued by
+// different threads or stolen by an idle thread can run concurrently.
+//
+class WorkStealingExecutor : public IceUtil::Shared
+{
+    class Worker : public IceUtil::Thread, public IceUtil::Mutex
+    {
+    public:
+
+        Worker(WorkStealingExecutor*, size_t, const std::string&);
+        virtual void run();
+
+        void updateObserver();
+        void setState(Ice::Instrumentation::ThreadState);
+
+    private:
+
+        friend class WorkStealingExecutor;
+
+        WorkStealingExecutor* const _executor;
+        const size_t _index;
+        std::deque<DispatchWorkItemPtr> _workItems;
+        ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
+        Ice::Instrumentation::ThreadState _state;
+    };
+    typedef IceUtil::Handle<Worker> WorkerPtr;
+
+public:
+
+    WorkStealingExecutor(const InstancePtr&, ThreadPool&, const std::string&, int);
+    virtual ~WorkStealingExecutor();
+
+    //
+    // Queue the work item, this throws CommunicatorDestroyedException
+    // if the executor is destroyed.
+    //
+    void execute(const DispatchWorkItemPtr&);
+
+    void destroy();
+    void updateObservers();
+    void joinWithAllThreads();
+
+private:
+
+    bool next(size_t, DispatchWorkItemPtr&);
+    bool take(size_t, DispatchWorkItemPtr&);
+    void run(Worker*, const DispatchWorkItemPtr&);
+
+    const InstancePtr _instance;
+    ThreadPool& _threadPool;
+    const std::string _prefix;
+
+    std::vector<WorkerPtr> _workers;
+    IceUtilInternal::Atomic _next;
+    IceUtilInternal::Atomic _idle;
+    IceUtilInternal::Atomic _executing;
+    IceUtilInternal::Atomic _destroyed;
+
+    IceUtil::Monitor<IceUtil::Mutex> _monitor;
+    int _wakeups;
+};
+
+}
+
+#endif
@@ -0,0 +1,24 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_WORK_STEALING_EXECUTOR_F_H
+#define ICE_WORK_STEALING_EXECUTOR_F_H
+
+#include <Ice/Handle.h>
+
+namespace IceInternal
+{
+
+class WorkStealingExecutor;
+IceUtil::Shared* upCast(WorkStealingExecutor*);
+typedef Handle<WorkStealingExecutor> WorkStealingExecutorPtr;
+
+}
+
+#endif
@@ -0,0 +1,123 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <IceStorm/EventFilter.h>
+
+using namespace std;
+using namespace IceStorm;
+
+namespace
+{
+
+const string filterPrefix = "filter.";
+const string contextPrefix = "filter.context.";
+
+}
+
+EventFilterPtr
+EventFilter::create(const QoS& qos)
+{
+    EventFilterPtr filter;
+    for(QoS::const_iterator p = qos.lower_bound(filterPrefix);
+        p != qos.end() && p->first.compare(0, filterPrefix.size(), filterPrefix) == 0; ++p)
+    {
+        Clause clause;
+        if(p->first == "filter.operation")
+        {
+            clause.operation = true;
+        }
+        else if(p->first.compare(0, contextPrefix.size(), contextPrefix) == 0 &&
+                p->first.size() > contextPrefix.size())
+        {
+            clause.operation = false;
+            clause.key = p->first.substr(contextPrefix.size());
+        }
+        else
+        {
+            throw BadQoS("invalid filter: " + p->first);
+        }
+
+        string::size_type beg = 0;
+        while(true)
+        {
+            string::size_type end = p->second.find(',', beg);
+            string value = p->second.substr(beg, end == string::npos ? string::npos : end - beg);
+            if(value.empty())
+            {
+                throw BadQoS("invalid " + p->first + " QoS: empty value");
+            }
+            else if(value[value.size() - 1] == '*')
+            {
+                clause.prefixes.push_back(value.substr(0, value.size() - 1));
+            }
+            else
+            {
+                clause.values.insert(value);
+            }
+
+            if(end == string::npos)
+            {
+                break;
+            }
+            beg = end + 1;
+        }
+
+        if(!filter)
+        {
+            filter = new EventFilter();
+        }
+        filter->_clauses.push_back(clause);
+    }
+    return filter;
+}
+
+bool
+EventFilter::match(const EventData& event) const
+{
+    for(vector<Clause>::const_iterator p = _clauses.begin(); p != _clauses.end(); ++p)
+    {
+        if(p->operation)
+        {
+            if(!p->match(event.op))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            Ice::Context::const_iterator q = event.context.find(p->key);
+            if(q == event.context.end() || !p->match(q->second))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool
+EventFilter::Clause::match(const string& value) const
+{
+    if(values.find(value) != values.end())
+    {
+        return true;
+    }
+    for(vector<string>::const_iterator p = prefixes.begin(); p != prefixes.end(); ++p)
+    {
+        if(value.compare(0, p->size(), *p) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+EventFilter::EventFilter()
+{
+}
@@ -0,0 +1,65 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef EVENT_FILTER_H
+#define EVENT_FILTER_H
+
+#include <IceStorm/IceStormInternal.h>
+#include <set>
+
+namespace IceStorm
+{
+
+class EventFilter;
+typedef IceUtil::Handle<EventFilter> EventFilterPtr;
+
+//
+// The filter of the events queued for a subscriber, compiled from the
+// filter entries of the subscriber QoS:
+//
+// filter.operation=<values>
+// filter.context.<key>=<values>
+//
+// The values are a comma separated list, a value ending with `*'
+// matches the values starting with this prefix. An event is queued if
+// its operation and each of the filtered context entries match one of
+// the values, events without a filtered context entry are discarded.
+//
+class EventFilter : public IceUtil::Shared
+{
+public:
+
+    //
+    // Returns a null filter if the QoS has no filter entries, raises
+    // BadQoS if a filter entry is invalid.
+    //
+    static EventFilterPtr create(const QoS&);
+
+    bool match(const EventData&) const;
+
+private:
+
+    struct Clause
+    {
+        bool operation;
+        std::string key;
+        std::set<std::string> values;
+        std::vector<std::string> prefixes;
+
+        bool match(const std::string&) const;
+    };
+
+    EventFilter();
+
+    std::vector<Clause> _clauses;
+};
+
+} // End namespace IceStorm
+
+#endif
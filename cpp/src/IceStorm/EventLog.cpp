@@ -0,0 +1,282 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <IceStorm/EventLog.h>
+#include <IceStorm/Subscriber.h>
+#include <IceUtil/FileUtil.h>
+#include <IceUtil/StringConverter.h>
+#include <Ice/LocalException.h>
+#include <Ice/OutputStream.h>
+#include <Ice/InputStream.h>
+
+#ifndef _WIN32
+#   include <sys/mman.h>
+#   include <unistd.h>
+#   include <fcntl.h>
+#endif
+
+using namespace std;
+using namespace IceStorm;
+
+namespace
+{
+
+//
+// The size of the segments, a larger segment is created for the events
+// which don't fit in a segment.
+//
+const size_t segmentSize = 1024 * 1024;
+
+class PrepareSegmentTask : public IceUtil::TimerTask
+{
+public:
+
+    PrepareSegmentTask(const EventLogPtr& log) :
+        _log(log)
+    {
+    }
+
+    virtual void
+    runTimerTask()
+    {
+        _log->prepareSegment();
+    }
+
+private:
+
+    const EventLogPtr _log;
+};
+
+}
+
+EventLog::EventLog(const Ice::CommunicatorPtr& communicator, const IceUtil::TimerPtr& timer, const string& path) :
+    _communicator(communicator),
+    _timer(timer),
+    _path(path),
+    _size(0),
+    _preparing(false),
+    _files(0)
+{
+    _segments.push_back(createSegment(segmentSize));
+}
+
+void
+EventLog::push(const EventDataPtr& event)
+{
+    Ice::OutputStream os(_communicator);
+    os.write(event->op, false);
+    os.write(static_cast<Ice::Byte>(event->mode));
+    os.write(event->data);
+    os.write(event->context);
+
+    const size_t sz = sizeof(Ice::Int) + os.b.size();
+    if(_segments.back()->tail + sz > _segments.back()->capacity)
+    {
+        _segments.push_back(nextSegment(sz));
+    }
+
+    Segment* segment = _segments.back().get();
+    Ice::Int encaps = static_cast<Ice::Int>(os.b.size());
+    memcpy(segment->base + segment->tail, &encaps, sizeof(Ice::Int));
+    memcpy(segment->base + segment->tail + sizeof(Ice::Int), os.b.begin(), os.b.size());
+    segment->tail += sz;
+    ++_size;
+
+    //
+    // Let the timer thread create the next segment once the last one
+    // is half full.
+    //
+    if(segment->tail > segment->capacity / 2)
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(!_next && !_preparing)
+        {
+            try
+            {
+                _timer->schedule(new PrepareSegmentTask(this), IceUtil::Time());
+                _preparing = true;
+            }
+            catch(const IceUtil::IllegalArgumentException&)
+            {
+                // The timer is destroyed, the segment is created when needed.
+            }
+        }
+    }
+}
+
+EventDataPtr
+EventLog::pop()
+{
+    assert(_size > 0);
+    Segment* segment = _segments.front().get();
+    Ice::Int sz;
+    memcpy(&sz, segment->base + segment->head, sizeof(Ice::Int));
+    const Ice::Byte* p = segment->base + segment->head + sizeof(Ice::Int);
+
+    Ice::InputStream is(_communicator, make_pair(p, p + sz));
+    EventData event;
+    is.read(event.op, false);
+    Ice::Byte mode;
+    is.read(mode);
+    event.mode = static_cast<Ice::OperationMode>(mode);
+    is.read(event.data);
+    is.read(event.context);
+
+    segment->head += sizeof(Ice::Int) + sz;
+    --_size;
+    if(segment->head == segment->tail)
+    {
+        segment->head = segment->tail = 0;
+        if(_segments.size() > 1)
+        {
+            //
+            // Keep the segment to reuse it once the last segment is full.
+            //
+            SegmentPtr read = _segments.front();
+            _segments.pop_front();
+
+            IceUtil::Mutex::Lock sync(_mutex);
+            if(!_next || _next->capacity < read->capacity)
+            {
+                _next = read;
+            }
+        }
+    }
+    return new Event(_communicator, event);
+}
+
+void
+EventLog::prepareSegment()
+{
+    SegmentPtr segment;
+    try
+    {
+        segment = createSegment(segmentSize);
+    }
+    catch(const Ice::LocalException&)
+    {
+        // Ignore, the segment is created again by push() which reports the failure.
+    }
+
+    IceUtil::Mutex::Lock sync(_mutex);
+    _preparing = false;
+    if(!_next)
+    {
+        _next = segment;
+    }
+}
+
+EventLog::SegmentPtr
+EventLog::nextSegment(size_t sz)
+{
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(_next && _next->capacity >= sz)
+        {
+            SegmentPtr segment = _next;
+            _next = 0;
+            return segment;
+        }
+    }
+    return createSegment(max(segmentSize, sz));
+}
+
+EventLog::SegmentPtr
+EventLog::createSegment(size_t capacity)
+{
+    ostringstream os;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        os << _path << "-" << _files++ << ".spill";
+    }
+    return new Segment(os.str(), capacity);
+}
+
+EventLog::Segment::Segment(const string& path, size_t sz) :
+    base(0),
+    capacity(sz),
+    head(0),
+    tail(0)
+{
+#ifdef _WIN32
+    _file = ::CreateFileW(IceUtil::stringToWstring(path, IceUtil::getProcessStringConverter()).c_str(),
+                          GENERIC_READ | GENERIC_WRITE, 0, 0, CREATE_NEW,
+                          FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, 0);
+    if(_file == INVALID_HANDLE_VALUE)
+    {
+        throw Ice::FileException(__FILE__, __LINE__, GetLastError(), path);
+    }
+
+    ULARGE_INTEGER size;
+    size.QuadPart = capacity;
+    _mapping = ::CreateFileMappingW(_file, 0, PAGE_READWRITE, size.HighPart, size.LowPart, 0);
+    if(_mapping == 0)
+    {
+        DWORD error = GetLastError();
+        ::CloseHandle(_file);
+        throw Ice::FileException(__FILE__, __LINE__, error, path);
+    }
+    base = static_cast<Ice::Byte*>(::MapViewOfFile(_mapping, FILE_MAP_ALL_ACCESS, 0, 0, capacity));
+    if(base == 0)
+    {
+        DWORD error = GetLastError();
+        ::CloseHandle(_mapping);
+        ::CloseHandle(_file);
+        throw Ice::FileException(__FILE__, __LINE__, error, path);
+    }
+#else
+    _fd = IceUtilInternal::open(path, O_RDWR | O_CREAT | O_EXCL);
+    if(_fd < 0)
+    {
+        throw Ice::FileException(__FILE__, __LINE__, IceInternal::getSystemErrno(), path);
+    }
+    IceUtilInternal::unlink(path);
+
+    //
+    // Allocate the disk blocks of the file, writing to the pages of a
+    // sparse file raises SIGBUS if the disk is full.
+    //
+#   ifdef __APPLE__
+    fstore_t store = { F_ALLOCATEALL, F_PEOFPOSMODE, 0, static_cast<off_t>(capacity), 0 };
+    if(::fcntl(_fd, F_PREALLOCATE, &store) == -1 || ::ftruncate(_fd, static_cast<off_t>(capacity)) != 0)
+    {
+        int error = IceInternal::getSystemErrno();
+        IceUtilInternal::close(_fd);
+        throw Ice::FileException(__FILE__, __LINE__, error, path);
+    }
+#   else
+    int error = ::posix_fallocate(_fd, 0, static_cast<off_t>(capacity));
+    if(error != 0)
+    {
+        IceUtilInternal::close(_fd);
+        throw Ice::FileException(__FILE__, __LINE__, error, path);
+    }
+#   endif
+    void* addr = ::mmap(0, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if(addr == MAP_FAILED)
+    {
+        int error = IceInternal::getSystemErrno();
+        IceUtilInternal::close(_fd);
+        throw Ice::FileException(__FILE__, __LINE__, error, path);
+    }
+    base = static_cast<Ice::Byte*>(addr);
+#endif
+}
+
+EventLog::Segment::~Segment()
+{
+#ifdef _WIN32
+    ::UnmapViewOfFile(base);
+    ::CloseHandle(_mapping);
+    ::CloseHandle(_file);
+#else
+    ::munmap(base, capacity);
+    IceUtilInternal::close(_fd);
+#endif
+}
@@ -0,0 +1,104 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include <IceStorm/IceStormInternal.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Timer.h>
+#include <deque>
+
+#ifdef _WIN32
+#   include <windows.h>
+#endif
+
+namespace IceStorm
+{
+
+class EventLog;
+typedef IceUtil::Handle<EventLog> EventLogPtr;
+
+//
+// An append-only log of the events spilled to disk by a subscriber
+// queue. The events are appended to memory-mapped files and read back
+// in the same order. The files are removed once created, they only live
+// as long as the log and don't survive a crash of the service.
+//
+// The log is a list of fixed-size segments: a segment is never grown or
+// compacted, a new segment is added when the last one is full and the
+// segments are reused once read. The next segment is created by the
+// timer thread once the last segment is half full, so the subscriber
+// doesn't allocate and map the file while holding its lock.
+//
+class EventLog : public IceUtil::Shared, private IceUtil::noncopyable
+{
+public:
+
+    EventLog(const Ice::CommunicatorPtr&, const IceUtil::TimerPtr&, const std::string&);
+
+    void push(const EventDataPtr&);
+    EventDataPtr pop();
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    // Called by the timer thread.
+    void prepareSegment();
+
+private:
+
+    class Segment : public IceUtil::Shared, private IceUtil::noncopyable
+    {
+    public:
+
+        Segment(const std::string&, size_t);
+        ~Segment();
+
+        Ice::Byte* base;
+        const size_t capacity;
+        size_t head; // The offset of the first event.
+        size_t tail; // The offset of the end of the last event.
+
+    private:
+
+#ifdef _WIN32
+        HANDLE _file;
+        HANDLE _mapping;
+#else
+        int _fd;
+#endif
+    };
+    typedef IceUtil::Handle<Segment> SegmentPtr;
+
+    SegmentPtr nextSegment(size_t);
+    SegmentPtr createSegment(size_t);
+
+    const Ice::CommunicatorPtr _communicator;
+    const IceUtil::TimerPtr _timer;
+    const std::string _path;
+    std::deque<SegmentPtr> _segments;
+    size_t _size; // The number of events.
+
+    IceUtil::Mutex _mutex; // Protects the members below, used by the timer thread.
+    SegmentPtr _next; // The segment to use once the last segment is full.
+    bool _preparing;
+    int _files;
+};
+
+} // End namespace IceStorm
+
+#endif
@@ -0,0 +1,317 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <IceStorm/GroupCommit.h>
+#include <IceStorm/TopicI.h>
+#include <IceStorm/Instance.h>
+#include <IceStorm/Observers.h>
+#include <IceStorm/TraceLevels.h>
+#include <Ice/LoggerUtil.h>
+#include <algorithm>
+#include <set>
+
+using namespace std;
+using namespace IceStorm;
+using namespace IceStormElection;
+using namespace IceStormInternal;
+
+namespace
+{
+
+//
+// The maximum number of updates committed together, it bounds the size
+// of the updateSubscribers requests sent to the replicas.
+//
+const size_t maxBatchSize = 1000;
+
+void
+logError(const Ice::CommunicatorPtr& com, const IceDB::LMDBException& ex)
+{
+    Ice::Error error(com->getLogger());
+    error << "LMDB error: " << ex;
+}
+
+void
+destroySubscribers(const vector<GroupCommit::UpdatePtr>& updates)
+{
+    for(vector<GroupCommit::UpdatePtr>::const_iterator p = updates.begin(); p != updates.end(); ++p)
+    {
+        for(vector<SubscriberPtr>::const_iterator q = (*p)->subscribers.begin(); q != (*p)->subscribers.end(); ++q)
+        {
+            (*q)->destroy();
+        }
+        (*p)->subscribers.clear();
+    }
+}
+
+}
+
+GroupCommit::Update::Update(const TopicImplPtr& t, const SubscriberRecordSeq& a, const Ice::IdentitySeq& r) :
+    topic(t),
+    added(a),
+    removed(r),
+    written(false),
+    _done(false)
+{
+}
+
+GroupCommit::GroupCommit(PersistentInstance* instance) :
+    _instance(instance),
+    _committing(false)
+{
+}
+
+void
+GroupCommit::commit(const UpdatePtr& update)
+{
+    Lock sync(*this);
+    _pending.push_back(update);
+    while(!update->_done)
+    {
+        if(_committing)
+        {
+            wait();
+            continue;
+        }
+
+        //
+        // No commit in progress, commit the pending updates up to the
+        // maximum batch size.
+        //
+        _committing = true;
+        size_t sz = min(_pending.size(), maxBatchSize);
+        vector<UpdatePtr> batch(_pending.begin(), _pending.begin() + sz);
+        _pending.erase(_pending.begin(), _pending.begin() + sz);
+
+        sync.release();
+        try
+        {
+            commitBatch(batch);
+        }
+        catch(const std::exception& ex)
+        {
+            for(vector<UpdatePtr>::const_iterator p = batch.begin(); p != batch.end(); ++p)
+            {
+                if(!(*p)->_exception.get())
+                {
+                    (*p)->_exception.reset(new Ice::UnknownException(__FILE__, __LINE__, ex.what()));
+                }
+            }
+        }
+        sync.acquire();
+
+        for(vector<UpdatePtr>::const_iterator p = batch.begin(); p != batch.end(); ++p)
+        {
+            (*p)->_done = true;
+        }
+        _committing = false;
+        notifyAll();
+    }
+
+    if(update->_exception.get())
+    {
+        update->_exception->ice_throw();
+    }
+}
+
+void
+GroupCommit::observerCommit(const LogUpdate& llu, const vector<UpdatePtr>& updates)
+{
+    vector<TopicImplPtr> topics = lockTopics(updates);
+    try
+    {
+        try
+        {
+            IceDB::ReadWriteTxn txn(_instance->dbEnv());
+
+            map<TopicImpl*, set<Ice::Identity> > added;
+            for(vector<UpdatePtr>::const_iterator p = updates.begin(); p != updates.end(); ++p)
+            {
+                (*p)->topic->writeUpdate(txn, **p, added[(*p)->topic.get()], false);
+            }
+
+            LLUMap lluMap = _instance->lluMap();
+            lluMap.put(txn, lluDbKey, llu);
+
+            txn.commit();
+        }
+        catch(const IceDB::LMDBException& ex)
+        {
+            logError(_instance->communicator(), ex);
+            destroySubscribers(updates);
+            throw; // will become UnknownException in caller
+        }
+        catch(...)
+        {
+            destroySubscribers(updates);
+            throw;
+        }
+
+        for(vector<UpdatePtr>::const_iterator p = updates.begin(); p != updates.end(); ++p)
+        {
+            (*p)->topic->applyUpdate(**p);
+        }
+        for(vector<TopicImplPtr>::const_iterator p = topics.begin(); p != topics.end(); ++p)
+        {
+            (*p)->updateSubscriberList();
+        }
+    }
+    catch(...)
+    {
+        unlockTopics(topics);
+        throw;
+    }
+    unlockTopics(topics);
+}
+
+void
+GroupCommit::commitBatch(const vector<UpdatePtr>& batch)
+{
+    vector<TopicImplPtr> topics = lockTopics(batch);
+    try
+    {
+        //
+        // First write the updates with a single transaction and log
+        // update. An update which fails doesn't prevent the commit of
+        // the others.
+        //
+        LogUpdate llu;
+        bool written = false;
+        try
+        {
+            IceDB::ReadWriteTxn txn(_instance->dbEnv());
+
+            map<TopicImpl*, set<Ice::Identity> > added;
+            for(vector<UpdatePtr>::const_iterator p = batch.begin(); p != batch.end(); ++p)
+            {
+                try
+                {
+                    (*p)->topic->writeUpdate(txn, **p, added[(*p)->topic.get()], true);
+                    written = written || (*p)->written;
+                }
+                catch(const Ice::Exception& ex)
+                {
+                    (*p)->_exception.reset(ex.ice_clone());
+                }
+            }
+
+            if(written)
+            {
+                LLUMap lluMap = _instance->lluMap();
+                llu = getIncrementedLLU(txn, lluMap);
+                txn.commit();
+            }
+            else
+            {
+                txn.rollback();
+            }
+        }
+        catch(const IceDB::LMDBException& ex)
+        {
+            logError(_instance->communicator(), ex);
+            destroySubscribers(batch);
+            for(vector<UpdatePtr>::const_iterator p = batch.begin(); p != batch.end(); ++p)
+            {
+                if(!(*p)->_exception.get())
+                {
+                    (*p)->_exception.reset(ex.ice_clone());
+                }
+            }
+            unlockTopics(topics);
+            return;
+        }
+
+        //
+        // Then apply the updates and replicate them. The topics remain
+        // locked until the replicas applied the updates, so they
+        // receive the updates of a topic in the order of the log
+        // updates.
+        //
+        SubscriberUpdateSeq updates;
+        for(vector<UpdatePtr>::const_iterator p = batch.begin(); p != batch.end(); ++p)
+        {
+            if((*p)->written)
+            {
+                (*p)->topic->applyUpdate(**p);
+
+                SubscriberUpdate update;
+                update.topic = (*p)->topic->getName();
+                update.added = (*p)->added;
+                update.removed = (*p)->removed;
+                updates.push_back(update);
+            }
+        }
+        for(vector<TopicImplPtr>::const_iterator p = topics.begin(); p != topics.end(); ++p)
+        {
+            (*p)->updateSubscriberList();
+        }
+
+        if(!updates.empty())
+        {
+            TraceLevelsPtr traceLevels = _instance->traceLevels();
+            if(traceLevels->topic > 1)
+            {
+                Ice::Trace out(traceLevels->logger, traceLevels->topicCat);
+                out << "commit " << updates.size() << " subscriber updates of " << topics.size() << " topics"
+                    << " llu: " << llu.generation << "/" << llu.iteration;
+            }
+
+            try
+            {
+                _instance->observers()->updateSubscribers(llu, updates);
+            }
+            catch(const Ice::Exception& ex)
+            {
+                for(vector<UpdatePtr>::const_iterator p = batch.begin(); p != batch.end(); ++p)
+                {
+                    if((*p)->written)
+                    {
+                        (*p)->_exception.reset(ex.ice_clone());
+                    }
+                }
+            }
+        }
+    }
+    catch(...)
+    {
+        unlockTopics(topics);
+        throw;
+    }
+    unlockTopics(topics);
+}
+
+vector<TopicImplPtr>
+GroupCommit::lockTopics(const vector<UpdatePtr>& updates)
+{
+    //
+    // Lock the topics in the order of their address to not deadlock
+    // with another group commit.
+    //
+    set<TopicImpl*> ordered;
+    for(vector<UpdatePtr>::const_iterator p = updates.begin(); p != updates.end(); ++p)
+    {
+        ordered.insert((*p)->topic.get());
+    }
+
+    vector<TopicImplPtr> topics(ordered.begin(), ordered.end());
+    for(vector<TopicImplPtr>::const_iterator p = topics.begin(); p != topics.end(); ++p)
+    {
+        (*p)->_subscribersMutex.lock();
+    }
+    return topics;
+}
+
+void
+GroupCommit::unlockTopics(const vector<TopicImplPtr>& topics)
+{
+    for(vector<TopicImplPtr>::const_reverse_iterator p = topics.rbegin(); p != topics.rend(); ++p)
+    {
+        (*p)->_subscribersMutex.unlock();
+    }
+}
@@ -0,0 +1,99 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef GROUP_COMMIT_H
+#define GROUP_COMMIT_H
+
+#include <IceStorm/Election.h>
+#include <IceUtil/Monitor.h>
+#include <IceUtil/UniquePtr.h>
+#include <deque>
+
+namespace IceStorm
+{
+
+class PersistentInstance;
+
+class TopicImpl;
+typedef IceUtil::Handle<TopicImpl> TopicImplPtr;
+
+class Subscriber;
+typedef IceUtil::Handle<Subscriber> SubscriberPtr;
+
+//
+// Commits the subscriber changes of concurrent requests together. The
+// request which finds no commit in progress commits its change along
+// with the changes queued by the other requests in the meantime: the
+// changes are written with a single LMDB transaction and a single log
+// update, and sent to the replicas with a single updateSubscribers
+// call. The other requests wait for the commit of their change. A
+// request only returns once its change is replicated, like when it's
+// committed on its own.
+//
+class GroupCommit : public IceUtil::Shared, private IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    class Update : public IceUtil::Shared
+    {
+    public:
+
+        Update(const TopicImplPtr&, const SubscriberRecordSeq&, const Ice::IdentitySeq&);
+
+        const TopicImplPtr topic;
+        const SubscriberRecordSeq added;
+        const Ice::IdentitySeq removed;
+
+        // The subscribers created for the added records.
+        std::vector<SubscriberPtr> subscribers;
+
+        // True if the update changed the database.
+        bool written;
+
+    private:
+
+        friend class GroupCommit;
+
+        bool _done;
+        IceUtil::UniquePtr<IceUtil::Exception> _exception;
+    };
+    typedef IceUtil::Handle<Update> UpdatePtr;
+
+    //
+    // The instance isn't a handle since it owns the group commit.
+    //
+    GroupCommit(PersistentInstance*);
+
+    //
+    // Commit the update of the master and replicate it. Raises the
+    // exception raised by the update, if any.
+    //
+    void commit(const UpdatePtr&);
+
+    //
+    // Commit the updates received by a replica from the master with
+    // the given log update.
+    //
+    void observerCommit(const IceStormElection::LogUpdate&, const std::vector<UpdatePtr>&);
+
+private:
+
+    void commitBatch(const std::vector<UpdatePtr>&);
+    std::vector<TopicImplPtr> lockTopics(const std::vector<UpdatePtr>&);
+    void unlockTopics(const std::vector<TopicImplPtr>&);
+
+    PersistentInstance* const _instance;
+    std::deque<UpdatePtr> _pending;
+    bool _committing;
+};
+typedef IceUtil::Handle<GroupCommit> GroupCommitPtr;
+
+} // End namespace IceStorm
+
+#endif
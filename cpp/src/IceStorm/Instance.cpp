@@ -12,7 +12,11 @@
 #include <IceStorm/Observers.h>
 #include <IceStorm/NodeI.h>
 #include <IceStorm/InstrumentationI.h>
+#include <IceStorm/PublishPool.h>
+#include <IceStorm/GroupCommit.h>
 #include <IceUtil/Timer.h>
+#include <IceUtil/FileUtil.h>
+#include <IceUtil/StringUtil.h>
 
 #include <Ice/InstrumentationI.h>
 #include <Ice/Communicator.h>
@@ -70,6 +74,8 @@ PersistentInstance::PersistentInstance(
         _subscriberMap = SubscriberMap(txn, "subscribers", dbContext, MDB_CREATE, compareSubscriberRecordKey);
 
         txn.commit();
+
+        _groupCommit = new GroupCommit(this);
     }
     catch(...)
     {
@@ -80,6 +86,16 @@ PersistentInstance::PersistentInstance(
     }
 }
 
+PersistentInstance::~PersistentInstance()
+{
+}
+
+GroupCommitPtr
+PersistentInstance::groupCommit() const
+{
+    return _groupCommit;
+}
+
 void
 PersistentInstance::destroy()
 {
@@ -113,6 +129,16 @@ Instance::Instance(
     _sendTimeout(communicator->getProperties()->getPropertyAsIntWithDefault(name + ".Send.Timeout", 60 * 1000)),
     _sendQueueSizeMax(communicator->getProperties()->getPropertyAsIntWithDefault(name + ".Send.QueueSizeMax", -1)),
     _sendQueueSizeMaxPolicy(RemoveSubscriber),
+    _sendSpillThreshold(communicator->getProperties()->getPropertyAsInt(name + ".Send.SpillThreshold")),
+    _sendSpillPath(communicator->getProperties()->getPropertyWithDefault(
+                       name + ".Send.SpillPath",
+                       communicator->getProperties()->getPropertyWithDefault(name + ".LMDB.Path", name))),
+    _sendSpillOffline(_sendSpillThreshold > 0 &&
+                      communicator->getProperties()->getPropertyAsInt(name + ".Send.SpillOffline") > 0),
+    _linkLinger(IceUtil::Time::milliSeconds(communicator->getProperties()->getPropertyAsInt(name + ".Link.Linger"))),
+    _linkMaxBatchSize(communicator->getProperties()->getPropertyAsInt(name + ".Link.MaxBatchSize")),
+    _linkMaxOutstanding(communicator->getProperties()->getPropertyAsIntWithDefault(name + ".Link.MaxOutstanding", 1)),
+    _linkCompress(communicator->getProperties()->getPropertyAsInt(name + ".Link.Compress") > 0),
     _topicReaper(new TopicReaper())
 {
     try
@@ -137,6 +163,20 @@ Instance::Instance(
         _batchFlusher = new IceUtil::Timer();
         _timer = new IceUtil::Timer();
 
+        //
+        // The events of the topics with many subscribers are queued
+        // with the subscribers by a pool of threads, if enabled.
+        //
+        int publishThreads = properties->getPropertyAsInt(name + ".Publish.Threads");
+        if(publishThreads > 0)
+        {
+            _publishPool = new PublishPool(this, publishThreads,
+                                           properties->getPropertyAsIntWithDefault(name + ".Publish.MinSubscribers",
+                                                                                   100),
+                                           properties->getPropertyAsIntWithDefault(name + ".Publish.QueueSizeMax",
+                                                                                   1000));
+        }
+
         string policy = properties->getProperty(name + ".Send.QueueSizeMaxPolicy");
         if(policy == "RemoveSubscriber")
         {
@@ -152,6 +192,20 @@ Instance::Instance(
             warn << "invalid value `" << policy << "' for `" << name << ".Send.QueueSizeMaxPolicy'";
         }
 
+        //
+        // The subscriber queues spill their events to files in this
+        // directory once they exceed the spill threshold.
+        //
+        if(_sendSpillThreshold > 0 && !IceUtilInternal::directoryExists(_sendSpillPath))
+        {
+            if(IceUtilInternal::mkdir(_sendSpillPath, 0777) != 0)
+            {
+                Ice::Warning warn(_traceLevels->logger);
+                warn << "unable to create the `" << _sendSpillPath << "' directory for `" << name
+                     << ".Send.SpillPath':\n" << IceUtilInternal::lastErrorToString();
+            }
+        }
+
         //
         // If an Ice metrics observer is setup on the communicator, also
         // enable metrics for IceStorm.
@@ -287,6 +341,12 @@ Instance::topicReaper() const
     return _topicReaper;
 }
 
+PublishPoolPtr
+Instance::publishPool() const
+{
+    return _publishPool;
+}
+
 IceUtil::Time
 Instance::discardInterval() const
 {
@@ -317,6 +377,48 @@ Instance::sendQueueSizeMaxPolicy() const
     return _sendQueueSizeMaxPolicy;
 }
 
+int
+Instance::sendSpillThreshold() const
+{
+    return _sendSpillThreshold;
+}
+
+string
+Instance::sendSpillPath() const
+{
+    return _sendSpillPath;
+}
+
+bool
+Instance::sendSpillOffline() const
+{
+    return _sendSpillOffline;
+}
+
+IceUtil::Time
+Instance::linkLinger() const
+{
+    return _linkLinger;
+}
+
+int
+Instance::linkMaxBatchSize() const
+{
+    return _linkMaxBatchSize;
+}
+
+int
+Instance::linkMaxOutstanding() const
+{
+    return _linkMaxOutstanding;
+}
+
+bool
+Instance::linkCompress() const
+{
+    return _linkCompress;
+}
+
 void
 Instance::shutdown()
 {
@@ -330,6 +432,15 @@ Instance::shutdown()
     _topicAdapter->destroy();
     _publishAdapter->destroy();
 
+    //
+    // Wait for the publish pool to queue the pending events, the
+    // subscribers use the timer.
+    //
+    if(_publishPool)
+    {
+        _publishPool->destroy();
+    }
+
     if(_timer)
     {
         _timer->destroy();
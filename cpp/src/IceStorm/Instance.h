@@ -44,6 +44,12 @@ namespace IceStorm
 class TraceLevels;
 typedef IceUtil::Handle<TraceLevels> TraceLevelsPtr;
 
+class PublishPool;
+typedef IceUtil::Handle<PublishPool> PublishPoolPtr;
+
+class GroupCommit;
+typedef IceUtil::Handle<GroupCommit> GroupCommitPtr;
+
 class TopicReaper : public IceUtil::Shared, private IceUtil::Mutex
 {
 public:
@@ -90,12 +96,20 @@ public:
     Ice::ObjectPrx publisherReplicaProxy() const;
     IceStorm::Instrumentation::TopicManagerObserverPtr observer() const;
     TopicReaperPtr topicReaper() const;
+    PublishPoolPtr publishPool() const;
 
     IceUtil::Time discardInterval() const;
     IceUtil::Time flushInterval() const;
     int sendTimeout() const;
     int sendQueueSizeMax() const;
     SendQueueSizeMaxPolicy sendQueueSizeMaxPolicy() const;
+    int sendSpillThreshold() const;
+    std::string sendSpillPath() const;
+    bool sendSpillOffline() const;
+    IceUtil::Time linkLinger() const;
+    int linkMaxBatchSize() const;
+    int linkMaxOutstanding() const;
+    bool linkCompress() const;
 
     void shutdown();
     virtual void destroy();
@@ -115,6 +129,13 @@ private:
     const int _sendTimeout;
     const int _sendQueueSizeMax;
     const SendQueueSizeMaxPolicy _sendQueueSizeMaxPolicy;
+    const int _sendSpillThreshold;
+    const std::string _sendSpillPath;
+    const bool _sendSpillOffline;
+    const IceUtil::Time _linkLinger;
+    const int _linkMaxBatchSize;
+    const int _linkMaxOutstanding;
+    const bool _linkCompress;
     const Ice::ObjectPrx _topicReplicaProxy;
     const Ice::ObjectPrx _publisherReplicaProxy;
     const TopicReaperPtr _topicReaper;
@@ -122,6 +143,7 @@ private:
     IceStormElection::ObserversPtr _observers;
     IceUtil::TimerPtr _batchFlusher;
     IceUtil::TimerPtr _timer;
+    PublishPoolPtr _publishPool;
     IceStorm::Instrumentation::TopicManagerObserverPtr _observer;
 
 
@@ -138,10 +160,12 @@ public:
     PersistentInstance(const std::string&, const std::string&, const Ice::CommunicatorPtr&,
                        const Ice::ObjectAdapterPtr&, const Ice::ObjectAdapterPtr&, const Ice::ObjectAdapterPtr& = 0,
                        const IceStormElection::NodePrx& = 0);
+    ~PersistentInstance();
 
     const IceDB::Env& dbEnv() const { return _dbEnv; }
     LLUMap lluMap() const { return _lluMap; }
     SubscriberMap subscriberMap() const { return _subscriberMap; }
+    GroupCommitPtr groupCommit() const;
 
     virtual void destroy();
 
@@ -151,6 +175,7 @@ private:
     IceDB::Env _dbEnv;
     LLUMap _lluMap;
     SubscriberMap _subscriberMap;
+    GroupCommitPtr _groupCommit;
 };
 typedef IceUtil::Handle<PersistentInstance> PersistentInstancePtr;
 
@@ -227,13 +227,13 @@ SubscriberHelper::Attributes SubscriberHelper::attributes;
 void
 TopicObserverI::published()
 {
-    forEach(inc(&TopicMetrics::published));
+    forEachShard(inc(&TopicMetrics::published));
 }
 
 void
 TopicObserverI::forwarded()
 {
-    forEach(inc(&TopicMetrics::forwarded));
+    forEachShard(inc(&TopicMetrics::forwarded));
 }
 
 namespace
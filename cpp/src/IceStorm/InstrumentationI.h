@@ -15,6 +15,45 @@
 #include <IceStorm/Instrumentation.h>
 #include <IceStorm/Metrics.h>
 
+namespace IceMX
+{
+
+inline void
+mergeMetrics(TopicMetrics* m, const TopicMetrics* shard)
+{
+    mergeMetrics(static_cast<Metrics*>(m), shard);
+    m->published += shard->published;
+    m->forwarded += shard->forwarded;
+}
+
+inline void
+mergeMetrics(SubscriberMetrics* m, const SubscriberMetrics* shard)
+{
+    mergeMetrics(static_cast<Metrics*>(m), shard);
+    m->queued += shard->queued;
+    m->outstanding += shard->outstanding;
+    m->delivered += shard->delivered;
+}
+
+inline void
+writeOpenMetrics(IceInternal::OpenMetricsWriter& writer, const TopicMetrics* m)
+{
+    writeOpenMetrics(writer, static_cast<const Metrics*>(m));
+    writer.counter("published", m->published);
+    writer.counter("forwarded", m->forwarded);
+}
+
+inline void
+writeOpenMetrics(IceInternal::OpenMetricsWriter& writer, const SubscriberMetrics* m)
+{
+    writeOpenMetrics(writer, static_cast<const Metrics*>(m));
+    writer.gauge("queued", m->queued);
+    writer.gauge("outstanding", m->outstanding);
+    writer.counter("delivered", m->delivered);
+}
+
+}
+
 namespace IceStorm
 {
 
@@ -16,10 +16,14 @@ $(project)_dependencies		:= IceStorm Ice
 IceStormService_targetdir	:= $(libdir)
 IceStormService_dependencies 	:= IceGrid Glacier2 IceBox IceDB
 IceStormService_cppflags	:= $(if $(lmdb_includedir),-I$(lmdb_includedir))
-IceStormService_sources   	:= $(addprefix $(currentdir)/,Instance.cpp \
+IceStormService_sources   	:= $(addprefix $(currentdir)/,EventFilter.cpp \
+							     EventLog.cpp \
+							     GroupCommit.cpp \
+							     Instance.cpp \
 							     InstrumentationI.cpp \
 							     NodeI.cpp \
 							     Observers.cpp \
+							     PublishPool.cpp \
 							     Service.cpp \
 							     Subscriber.cpp \
 							     TopicI.cpp \
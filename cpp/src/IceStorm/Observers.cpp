@@ -178,6 +178,96 @@ Observers::removeSubscriber(const LogUpdate& llu, const string& name, const Ice:
     wait("removeSubscriber");
 }
 
+void
+Observers::updateSubscribers(const LogUpdate& llu, const SubscriberUpdateSeq& updates)
+{
+    Lock sync(*this);
+    for(vector<ObserverInfo>::iterator p = _observers.begin(); p != _observers.end(); ++p)
+    {
+        if(p->batchUpdates)
+        {
+            p->result = p->observer->begin_updateSubscribers(llu, updates);
+        }
+    }
+
+    //
+    // The replicas running an older version don't implement
+    // updateSubscribers, they receive the changes one at a time with
+    // addSubscriber and removeSubscriber instead. This allows to upgrade
+    // the replicas one at a time.
+    //
+    for(vector<ObserverInfo>::iterator p = _observers.begin(); p != _observers.end(); ++p)
+    {
+        if(p->batchUpdates)
+        {
+            p->result->waitForCompleted();
+            try
+            {
+                p->result->throwLocalException();
+                continue;
+            }
+            catch(const Ice::OperationNotExistException&)
+            {
+                p->batchUpdates = false;
+            }
+            catch(const Ice::Exception&)
+            {
+                continue; // Reported by wait()
+            }
+        }
+        p->result = updateSubscribersOneByOne(p->observer, llu, updates);
+    }
+    wait("updateSubscribers");
+}
+
+Ice::AsyncResultPtr
+Observers::updateSubscribersOneByOne(const ReplicaObserverPrx& observer, const LogUpdate& llu,
+                                     const SubscriberUpdateSeq& updates)
+{
+    //
+    // Send the changes in order, each request is sent once the previous
+    // one succeeded. The result of the last request sent is returned,
+    // the caller waits for it and reports its failure.
+    //
+    Ice::AsyncResultPtr result;
+    for(SubscriberUpdateSeq::const_iterator p = updates.begin(); p != updates.end(); ++p)
+    {
+        if(!p->removed.empty())
+        {
+            if(result && !succeeded(result))
+            {
+                return result;
+            }
+            result = observer->begin_removeSubscriber(llu, p->topic, p->removed);
+        }
+        for(SubscriberRecordSeq::const_iterator q = p->added.begin(); q != p->added.end(); ++q)
+        {
+            if(result && !succeeded(result))
+            {
+                return result;
+            }
+            result = observer->begin_addSubscriber(llu, p->topic, *q);
+        }
+    }
+    assert(result); // The changes aren't empty.
+    return result;
+}
+
+bool
+Observers::succeeded(const Ice::AsyncResultPtr& result)
+{
+    result->waitForCompleted();
+    try
+    {
+        result->throwLocalException();
+    }
+    catch(const Ice::Exception&)
+    {
+        return false;
+    }
+    return true;
+}
+
 void
 Observers::wait(const string& op)
 {
@@ -47,10 +47,14 @@ public:
     void destroyTopic(const LogUpdate&, const std::string&);
     void addSubscriber(const LogUpdate&, const std::string&, const IceStorm::SubscriberRecord&);
     void removeSubscriber(const LogUpdate&, const std::string&, const Ice::IdentitySeq&);
+    void updateSubscribers(const LogUpdate&, const SubscriberUpdateSeq&);
     void getReapedSlaves(std::vector<int>&);
 
 private:
 
+    Ice::AsyncResultPtr updateSubscribersOneByOne(const ReplicaObserverPrx&, const LogUpdate&,
+                                                  const SubscriberUpdateSeq&);
+    bool succeeded(const Ice::AsyncResultPtr&);
     void wait(const std::string&);
 
     const IceStorm::TraceLevelsPtr _traceLevels;
@@ -58,10 +62,11 @@ private:
     struct ObserverInfo
     {
         ObserverInfo(int i, const ReplicaObserverPrx& o, const Ice::AsyncResultPtr& r = 0) :
-            id(i), observer(o), result (r) {}
+            id(i), observer(o), result (r), batchUpdates(true) {}
         int id;
         ReplicaObserverPrx observer;
         ::Ice::AsyncResultPtr result;
+        bool batchUpdates; // False if the replica doesn't implement updateSubscribers.
     };
     std::vector<ObserverInfo> _observers;
     IceUtil::Mutex _reapedMutex;
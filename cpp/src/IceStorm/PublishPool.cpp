@@ -0,0 +1,230 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <IceStorm/PublishPool.h>
+#include <IceStorm/Instance.h>
+#include <IceStorm/TraceLevels.h>
+#include <Ice/LoggerUtil.h>
+
+using namespace std;
+using namespace IceStorm;
+
+PublishPool::PublishPool(const InstancePtr& instance, int threads, int minSubscribers, int sizeMax) :
+    _logger(instance->traceLevels()->logger),
+    _minSubscribers(minSubscribers > 0 ? static_cast<size_t>(minSubscribers) : 0)
+{
+    assert(threads > 0);
+    for(int i = 0; i < threads; ++i)
+    {
+        ostringstream os;
+        os << instance->serviceName() << "-Publish-" << i;
+        _workers.push_back(new Worker(this, os.str(), sizeMax > 0 ? static_cast<size_t>(sizeMax) : 1));
+    }
+
+    vector<WorkerPtr>::const_iterator p = _workers.begin();
+    try
+    {
+        for(; p != _workers.end(); ++p)
+        {
+            (*p)->start();
+        }
+    }
+    catch(const IceUtil::Exception&)
+    {
+        for(vector<WorkerPtr>::const_iterator q = _workers.begin(); q != p; ++q)
+        {
+            (*q)->destroy();
+            (*q)->getThreadControl().join();
+        }
+        throw;
+    }
+}
+
+size_t
+PublishPool::size() const
+{
+    return _workers.size();
+}
+
+size_t
+PublishPool::minSubscribers() const
+{
+    return _minSubscribers;
+}
+
+void
+PublishPool::queue(const vector<SubscriberShardPtr>& shards, bool forwarded, const EventDataSeq& events,
+                   const PublishCallbackPtr& callback)
+{
+    assert(!shards.empty());
+    PublishPtr publish = new Publish(forwarded, events, callback, shards.size());
+    for(vector<SubscriberShardPtr>::const_iterator p = shards.begin(); p != shards.end(); ++p)
+    {
+        Task task;
+        task.publish = publish;
+        task.shard = *p;
+
+        //
+        // The events are queued by the calling thread once the thread
+        // of the shard queued its pending events and exited, after the
+        // pool is destroyed.
+        //
+        if(!_workers[(*p)->index % _workers.size()]->queue(task))
+        {
+            execute(task);
+        }
+    }
+}
+
+void
+PublishPool::throttle()
+{
+    //
+    // Called by the publishers without any lock held: the pool threads
+    // might wait for the locks of the topic or of the replica node to
+    // reap subscribers.
+    //
+    for(vector<WorkerPtr>::const_iterator p = _workers.begin(); p != _workers.end(); ++p)
+    {
+        (*p)->throttle();
+    }
+}
+
+void
+PublishPool::destroy()
+{
+    //
+    // The threads queue the pending events with the subscribers before
+    // exiting, the events published meanwhile are queued after them.
+    // The workers are kept, queue() can still be called concurrently
+    // and queues the events with the calling thread once the threads
+    // exited.
+    //
+    for(vector<WorkerPtr>::const_iterator p = _workers.begin(); p != _workers.end(); ++p)
+    {
+        (*p)->destroy();
+    }
+    for(vector<WorkerPtr>::const_iterator p = _workers.begin(); p != _workers.end(); ++p)
+    {
+        (*p)->getThreadControl().join();
+    }
+}
+
+void
+PublishPool::execute(const Task& task)
+{
+    const PublishPtr& publish = task.publish;
+    try
+    {
+        Ice::IdentitySeq reap;
+        const vector<SubscriberPtr>& subscribers = task.shard->subscribers;
+        for(vector<SubscriberPtr>::const_iterator p = subscribers.begin(); p != subscribers.end(); ++p)
+        {
+            if(!(*p)->queue(publish->forwarded, publish->events) && (*p)->reap())
+            {
+                reap.push_back((*p)->id());
+            }
+        }
+
+        if(!reap.empty())
+        {
+            publish->callback->reap(reap);
+        }
+    }
+    catch(const exception& ex)
+    {
+        Ice::Error out(_logger);
+        out << "exception while publishing events:\n" << ex;
+    }
+
+    if(publish->remaining.fetch_sub(1) == 1)
+    {
+        try
+        {
+            publish->callback->completed();
+        }
+        catch(const exception& ex)
+        {
+            Ice::Error out(_logger);
+            out << "exception while publishing events:\n" << ex;
+        }
+    }
+}
+
+PublishPool::Worker::Worker(PublishPool* pool, const string& name, size_t sizeMax) :
+    IceUtil::Thread(name),
+    _pool(pool),
+    _sizeMax(sizeMax),
+    _destroyed(false),
+    _finished(false)
+{
+}
+
+bool
+PublishPool::Worker::queue(const Task& task)
+{
+    Lock sync(*this);
+    if(_finished)
+    {
+        return false;
+    }
+    if(_tasks.empty())
+    {
+        notifyAll();
+    }
+    _tasks.push_back(task);
+    return true;
+}
+
+void
+PublishPool::Worker::throttle()
+{
+    Lock sync(*this);
+    while(_tasks.size() > _sizeMax && !_finished)
+    {
+        wait();
+    }
+}
+
+void
+PublishPool::Worker::destroy()
+{
+    Lock sync(*this);
+    _destroyed = true;
+    notifyAll();
+}
+
+void
+PublishPool::Worker::run()
+{
+    while(true)
+    {
+        Task task;
+        {
+            Lock sync(*this);
+            while(_tasks.empty() && !_destroyed)
+            {
+                wait();
+            }
+            if(_tasks.empty())
+            {
+                _finished = true;
+                notifyAll();
+                return;
+            }
+            task = _tasks.front();
+            _tasks.pop_front();
+            if(_tasks.size() == _sizeMax)
+            {
+                notifyAll();
+            }
+        }
+        _pool->execute(task);
+    }
+}
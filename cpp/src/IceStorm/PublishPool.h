@@ -0,0 +1,117 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef PUBLISH_POOL_H
+#define PUBLISH_POOL_H
+
+#include <IceStorm/IceStormInternal.h>
+#include <IceStorm/Subscriber.h>
+#include <IceUtil/Thread.h>
+#include <IceUtil/Monitor.h>
+#include <Ice/LoggerF.h>
+#include <deque>
+
+namespace IceStorm
+{
+
+class Instance;
+typedef IceUtil::Handle<Instance> InstancePtr;
+
+//
+// Notified by the publish pool once the events of a publish are queued
+// with the subscribers.
+//
+class PublishCallback : public IceUtil::Shared
+{
+public:
+
+    // Called for each shard with subscribers which must be reaped.
+    virtual void reap(const Ice::IdentitySeq&) = 0;
+
+    // Called once the events are queued with all the shards.
+    virtual void completed() = 0;
+};
+typedef IceUtil::Handle<PublishCallback> PublishCallbackPtr;
+
+//
+// The threads queuing the events of the topics with many subscribers.
+// Each thread queues the events with the subscribers of a shard, in
+// the order the events are published. The publishers call throttle()
+// once they no longer hold any lock to wait for the threads which
+// have more than the maximum number of pending tasks.
+//
+class PublishPool : public IceUtil::Shared
+{
+public:
+
+    PublishPool(const InstancePtr&, int, int, int);
+
+    size_t size() const;
+    size_t minSubscribers() const;
+
+    void queue(const std::vector<SubscriberShardPtr>&, bool, const EventDataSeq&, const PublishCallbackPtr&);
+    void throttle();
+
+    void destroy();
+
+private:
+
+    struct Publish : public IceUtil::Shared
+    {
+        Publish(bool forwarded, const EventDataSeq& events, const PublishCallbackPtr& callback, size_t shards) :
+            forwarded(forwarded), events(events), callback(callback), remaining(static_cast<int>(shards))
+        {
+        }
+
+        const bool forwarded;
+        const EventDataSeq events;
+        const PublishCallbackPtr callback;
+        IceUtilInternal::Atomic remaining;
+    };
+    typedef IceUtil::Handle<Publish> PublishPtr;
+
+    struct Task
+    {
+        PublishPtr publish;
+        SubscriberShardPtr shard;
+    };
+
+    class Worker : public IceUtil::Thread, public IceUtil::Monitor<IceUtil::Mutex>
+    {
+    public:
+
+        Worker(PublishPool*, const std::string&, size_t);
+
+        bool queue(const Task&);
+        void throttle();
+        void destroy();
+
+        virtual void run();
+
+    private:
+
+        PublishPool* _pool;
+        const size_t _sizeMax;
+        std::deque<Task> _tasks;
+        bool _destroyed;
+        bool _finished;
+    };
+    typedef IceUtil::Handle<Worker> WorkerPtr;
+
+    void execute(const Task&);
+
+    const Ice::LoggerPtr _logger;
+    const size_t _minSubscribers;
+    std::vector<WorkerPtr> _workers;
+};
+typedef IceUtil::Handle<PublishPool> PublishPoolPtr;
+
+} // End namespace IceStorm
+
+#endif
@@ -501,6 +501,9 @@ ServiceI::validateProperties(const string& name, const PropertiesPtr& properties
         "Publish.ThreadPool.SizeMax",
         "Publish.ThreadPool.SizeWarn",
         "Publish.ThreadPool.StackSize",
+        "Publish.ThreadPool.Serialize",
+        "Publish.Threads",
+        "Publish.MinSubscribers",
         "Node.AdapterId",
         "Node.Endpoints",
         "Node.Locator",
@@ -537,6 +540,13 @@ ServiceI::validateProperties(const string& name, const PropertiesPtr& properties
         "Send.Timeout",
         "Send.QueueSizeMax",
         "Send.QueueSizeMaxPolicy",
+        "Send.SpillThreshold",
+        "Send.SpillPath",
+        "Send.SpillOffline",
+        "Link.Linger",
+        "Link.MaxBatchSize",
+        "Link.MaxOutstanding",
+        "Link.Compress",
         "Discard.Interval",
         "LMDB.Path",
         "LMDB.MapSize"
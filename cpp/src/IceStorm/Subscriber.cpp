@@ -13,6 +13,8 @@
 #include <IceStorm/NodeI.h>
 #include <IceStorm/Util.h>
 #include <Ice/LoggerUtil.h>
+#include <Ice/HashUtil.h>
+#include <IceUtil/UUID.h>
 #include <iterator>
 
 using namespace std;
@@ -52,18 +54,8 @@ public:
         // Use cached reads.
         CachedReadHelper unlock(_instance->node(), __FILE__, __LINE__);
 
-        EventDataPtr event = new EventData(
-            current.operation,
-            current.mode,
-            Ice::ByteSeq(),
-            current.ctx);
-
-        //
-        // COMPILERBUG: gcc 4.0.1 doesn't like this.
-        //
-        //event->data.swap(Ice::ByteSeq(inParams.first, inParams.second));
-        Ice::ByteSeq data(inParams.first, inParams.second);
-        event->data.swap(data);
+        EventDataPtr event = new Event(current.adapter->getCommunicator(), current.operation, current.mode, inParams,
+                                       current.ctx);
 
         EventDataSeq e;
         e.push_back(event);
@@ -96,6 +88,34 @@ toSubscriberState(Subscriber::SubscriberState s)
     }
 }
 
+//
+// Returns the request body of the event. The events created by the
+// service carry the request body encoded when they were published.
+//
+IceInternal::RequestBodyPtr
+getRequestBody(const InstancePtr& instance, const EventDataPtr& e)
+{
+    EventPtr event = EventPtr::dynamicCast(e);
+    if(event)
+    {
+        return event->body;
+    }
+    const Ice::Byte* p = e->data.empty() ? 0 : &e->data[0];
+    return new IceInternal::RequestBody(instance->communicator(), e->op, e->mode, make_pair(p, p + e->data.size()),
+                                        e->context);
+}
+
+//
+// Returns the context key of the events conflated with the "conflate"
+// QoS, an empty string if the events aren't conflated.
+//
+string
+getConflateKey(const QoS& qos)
+{
+    QoS::const_iterator p = qos.find("conflate");
+    return p != qos.end() ? p->second : string();
+}
+
 }
 
 // Each of the various Subscriber types.
@@ -161,6 +181,54 @@ private:
     const Ice::ObjectPrx _obj;
 };
 
+//
+// A subscriber with the batched reliability. Once events are queued
+// while events are being sent, the queued events are sent together in
+// a batch message. The last event of a batch sent to a twoway
+// subscriber is sent as a twoway request after the batch, over the
+// same connection. Its reply acknowledges the receipt of the batch
+// but not its dispatch: unless the subscriber serializes its
+// dispatches, the batched events can be dispatched after the reply. A
+// failure to send the batch is reported like a twoway failure, the
+// dispatch failures of the batched events are only reported if they
+// also fail the twoway request (for example, if the subscriber object
+// doesn't exist).
+//
+class SubscriberBatched : public Subscriber
+{
+public:
+
+    SubscriberBatched(const InstancePtr&, const SubscriberRecord&, const Ice::ObjectPrx&, int, const Ice::ObjectPrx&);
+
+    virtual void flush();
+
+    void exception(const Ice::Exception& ex)
+    {
+        error(true, ex);
+    }
+    void sent(bool);
+
+    //
+    // The batch sent before the twoway request isn't counted as an
+    // outstanding request.
+    //
+    void batchException(const Ice::Exception& ex)
+    {
+        error(false, ex);
+    }
+
+private:
+
+    const Ice::ObjectPrx _obj;
+    const Ice::ObjectPrx _batchObj; // The batch proxy of a oneway subscriber.
+};
+
+//
+// A link to another topic. The queued events are forwarded in batches
+// of up to Link.MaxBatchSize bytes with up to Link.MaxOutstanding
+// forward requests at a time. With a Link.Linger time, a batch smaller
+// than the maximum size is only forwarded once this time elapsed.
+//
 class SubscriberLink : public Subscriber
 {
 public:
@@ -169,10 +237,34 @@ public:
 
     virtual void flush();
 
+    void forwarded(const Ice::AsyncResultPtr&);
+    void lingered();
+
 private:
 
     const TopicLinkPrx _obj;
+    const IceUtil::Time _linger;
+    const size_t _maxBatchSize;
+    bool _lingering; // True if a linger timer task is scheduled.
+    bool _lingered; // True if the linger time elapsed.
 };
+typedef IceUtil::Handle<SubscriberLink> SubscriberLinkPtr;
+
+//
+// The cookie of a forward request, the number of forwarded events.
+//
+class ForwardCookie : public Ice::LocalObject
+{
+public:
+
+    ForwardCookie(Ice::Int c) :
+        count(c)
+    {
+    }
+
+    const Ice::Int count;
+};
+typedef IceUtil::Handle<ForwardCookie> ForwardCookiePtr;
 
 class FlushTimerTask : public IceUtil::TimerTask
 {
@@ -194,6 +286,54 @@ private:
     const SubscriberBatchPtr _subscriber;
 };
 
+class LingerTimerTask : public IceUtil::TimerTask
+{
+public:
+
+    LingerTimerTask(const SubscriberLinkPtr& subscriber) :
+        _subscriber(subscriber)
+    {
+    }
+
+    virtual void
+    runTimerTask()
+    {
+        _subscriber->lingered();
+    }
+
+private:
+
+    const SubscriberLinkPtr _subscriber;
+};
+
+//
+// Returns the approximate size of the marshaled event.
+//
+size_t
+eventSize(const EventDataPtr& e)
+{
+    size_t sz = e->op.size() + e->data.size() + 1;
+    for(Ice::Context::const_iterator p = e->context.begin(); p != e->context.end(); ++p)
+    {
+        sz += p->first.size() + p->second.size();
+    }
+    return sz;
+}
+
+//
+// Returns the proxy of the linked topic used to forward the events.
+//
+TopicLinkPrx
+getLinkProxy(const InstancePtr& instance, const SubscriberRecord& rec)
+{
+    Ice::ObjectPrx obj = rec.obj->ice_collocationOptimized(false)->ice_timeout(instance->sendTimeout());
+    if(instance->linkCompress())
+    {
+        obj = obj->ice_compress(true);
+    }
+    return TopicLinkPrx::uncheckedCast(obj);
+}
+
 }
 
 SubscriberBatch::SubscriberBatch(
@@ -239,6 +379,7 @@ SubscriberBatch::doFlush()
     EventDataSeq v;
     v.swap(_events);
     assert(!v.empty());
+    loadSpilledEvents();
 
     if(_observer)
     {
@@ -352,6 +493,7 @@ SubscriberOneway::flush()
         //
         EventDataPtr e = _events.front();
         _events.erase(_events.begin());
+        loadSpilledEvents();
         if(_observer)
         {
             _observer->outstanding(1);
@@ -360,9 +502,9 @@ SubscriberOneway::flush()
         try
         {
             Ice::AsyncResultPtr result = _obj->begin_ice_invoke(
-                e->op, e->mode, e->data, e->context, Ice::newCallback_Object_ice_invoke(this,
-                                                                                        &SubscriberOneway::exception,
-                                                                                        &SubscriberOneway::sent));
+                getRequestBody(_instance, e), Ice::newCallback_Object_ice_invoke(this,
+                                                                                 &SubscriberOneway::exception,
+                                                                                 &SubscriberOneway::sent));
             if(!result->sentSynchronously())
             {
                 ++_outstanding;
@@ -447,6 +589,7 @@ SubscriberTwoway::flush()
         //
         EventDataPtr e = _events.front();
         _events.erase(_events.begin());
+        loadSpilledEvents();
         ++_outstanding;
         if(_observer)
         {
@@ -455,7 +598,7 @@ SubscriberTwoway::flush()
 
         try
         {
-            _obj->begin_ice_invoke(e->op, e->mode, e->data, e->context,
+            _obj->begin_ice_invoke(getRequestBody(_instance, e),
                                    Ice::newCallback(static_cast<Subscriber*>(this), &Subscriber::completed));
         }
         catch(const Ice::Exception& ex)
@@ -466,14 +609,172 @@ SubscriberTwoway::flush()
     }
 }
 
+SubscriberBatched::SubscriberBatched(
+    const InstancePtr& instance,
+    const SubscriberRecord& rec,
+    const Ice::ObjectPrx& proxy,
+    int retryCount,
+    const Ice::ObjectPrx& obj) :
+    Subscriber(instance, rec, proxy, retryCount, 1),
+    _obj(obj),
+    _batchObj(obj->ice_isTwoway() ? Ice::ObjectPrx() :
+              (obj->ice_isDatagram() ? obj->ice_batchDatagram() : obj->ice_batchOneway()))
+{
+}
+
+void
+SubscriberBatched::flush()
+{
+    IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(_lock);
+
+    //
+    // If the subscriber isn't online or if a batch is being sent, we're
+    // done. The events queued in the meantime are sent with the next
+    // batch.
+    //
+    if(_state != SubscriberStateOnline || _events.empty() || _outstanding > 0)
+    {
+        return;
+    }
+
+    try
+    {
+        vector<Ice::Byte> dummy;
+        if(!_batchObj)
+        {
+            //
+            // The batch must be sent over the connection of the twoway
+            // request which acknowledges it. Events are sent one at a
+            // time until the connection is established.
+            //
+            Ice::ConnectionPtr connection = _obj->ice_getCachedConnection();
+            EventDataSeq v;
+            if(connection)
+            {
+                v.swap(_events);
+            }
+            else
+            {
+                v.push_back(_events.front());
+                _events.erase(_events.begin());
+            }
+            loadSpilledEvents();
+            EventDataPtr e = v.back();
+            v.pop_back();
+
+            ++_outstanding;
+            if(_observer)
+            {
+                _outstandingCount = static_cast<Ice::Int>(v.size() + 1);
+                _observer->outstanding(_outstandingCount);
+            }
+
+            Ice::ObjectPrx obj = _obj;
+            if(!v.empty())
+            {
+                //
+                // The twoway request is sent with a proxy bound to the
+                // connection of the batch, it fails if the batch is lost
+                // with the connection instead of being sent over a new
+                // connection.
+                //
+                obj = connection->createProxy(_obj->ice_getIdentity())->ice_facet(_obj->ice_getFacet());
+                Ice::ObjectPrx batch = obj->ice_batchOneway();
+                for(EventDataSeq::const_iterator p = v.begin(); p != v.end(); ++p)
+                {
+                    batch->ice_invoke(getRequestBody(_instance, *p), dummy);
+                }
+                batch->begin_ice_flushBatchRequests(
+                    Ice::newCallback_Object_ice_flushBatchRequests(this, &SubscriberBatched::batchException));
+            }
+
+            obj->begin_ice_invoke(getRequestBody(_instance, e),
+                                  Ice::newCallback(static_cast<Subscriber*>(this), &Subscriber::completed));
+        }
+        else
+        {
+            EventDataSeq v;
+            v.swap(_events);
+            loadSpilledEvents();
+
+            ++_outstanding;
+            if(_observer)
+            {
+                _outstandingCount = static_cast<Ice::Int>(v.size());
+                _observer->outstanding(_outstandingCount);
+            }
+
+            for(EventDataSeq::const_iterator p = v.begin(); p != v.end(); ++p)
+            {
+                _batchObj->ice_invoke(getRequestBody(_instance, *p), dummy);
+            }
+
+            Ice::AsyncResultPtr result = _batchObj->begin_ice_flushBatchRequests(
+                Ice::newCallback_Object_ice_flushBatchRequests(this,
+                                                               &SubscriberBatched::exception,
+                                                               &SubscriberBatched::sent));
+            if(result->sentSynchronously())
+            {
+                --_outstanding;
+                if(_observer)
+                {
+                    _observer->delivered(_outstandingCount);
+                }
+            }
+        }
+    }
+    catch(const Ice::Exception& ex)
+    {
+        error(true, ex);
+        return;
+    }
+
+    if(_events.empty() && _outstanding == 0 && _shutdown)
+    {
+        _lock.notify();
+    }
+}
+
+void
+SubscriberBatched::sent(bool sentSynchronously)
+{
+    if(sentSynchronously)
+    {
+        return;
+    }
+
+    IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(_lock);
+
+    // Decrement the _outstanding count.
+    --_outstanding;
+    assert(_outstanding == 0);
+    if(_observer)
+    {
+        _observer->delivered(_outstandingCount);
+    }
+
+    if(_events.empty() && _outstanding == 0 && _shutdown)
+    {
+        _lock.notify();
+    }
+    else if(!_events.empty())
+    {
+        flush();
+    }
+}
+
 namespace
 {
 
 SubscriberLink::SubscriberLink(
     const InstancePtr& instance,
     const SubscriberRecord& rec) :
-    Subscriber(instance, rec, 0, -1, 1),
-    _obj(TopicLinkPrx::uncheckedCast(rec.obj->ice_collocationOptimized(false)->ice_timeout(instance->sendTimeout())))
+    Subscriber(instance, rec, 0, -1, max(instance->linkMaxOutstanding(), 1)),
+    _obj(getLinkProxy(instance, rec)),
+    _linger(instance->linkLinger()),
+    _maxBatchSize(static_cast<size_t>(max(instance->linkMaxBatchSize(), 0))),
+    _lingering(false),
+    _lingered(false)
 {
 }
 
@@ -482,53 +783,140 @@ SubscriberLink::flush()
 {
     IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(_lock);
 
-    if(_state != SubscriberStateOnline || _outstanding > 0)
+    if(_state != SubscriberStateOnline)
     {
         return;
     }
 
-    EventDataSeq v;
-    v.swap(_events);
-
-    EventDataSeq::iterator p = v.begin();
-    while(p != v.end())
+    //
+    // The forward requests are sent in order over the link connection.
+    // The linked topic dispatches them in the same order if the thread
+    // pool of its publish adapter serializes the dispatch.
+    //
+    while(_outstanding < _maxOutstanding && !_events.empty())
     {
-        if(_rec.cost != 0)
+        EventDataSeq::iterator last = _events.end();
+        bool full = false;
+        if(_maxBatchSize > 0)
         {
-            int cost = 0;
-            Ice::Context::const_iterator q = (*p)->context.find("cost");
-            if(q != (*p)->context.end())
+            size_t size = 0;
+            last = _events.begin();
+            while(last != _events.end() && size < _maxBatchSize)
             {
-                cost = atoi(q->second.c_str());
+                size += eventSize(*last);
+                ++last;
             }
-            if(cost > _rec.cost)
+            full = size >= _maxBatchSize;
+        }
+
+        if(!full && _linger > IceUtil::Time() && !_lingered)
+        {
+            if(!_lingering)
             {
-                p = v.erase(p);
-                continue;
+                _lingering = true;
+                _instance->batchFlusher()->schedule(new LingerTimerTask(this), _linger);
             }
+            return;
         }
-        ++p;
-    }
 
-    if(!v.empty())
-    {
-        try
+        EventDataSeq v(_events.begin(), last);
+        _events.erase(_events.begin(), last);
+        loadSpilledEvents();
+
+        EventDataSeq::iterator p = v.begin();
+        while(p != v.end())
         {
-            ++_outstanding;
-            if(_observer)
+            if(_rec.cost != 0)
             {
-                _outstandingCount = static_cast<Ice::Int>(v.size());
-                _observer->outstanding(_outstandingCount);
+                int cost = 0;
+                Ice::Context::const_iterator q = (*p)->context.find("cost");
+                if(q != (*p)->context.end())
+                {
+                    cost = atoi(q->second.c_str());
+                }
+                if(cost > _rec.cost)
+                {
+                    p = v.erase(p);
+                    continue;
+                }
             }
-            _obj->begin_forward(v, Ice::newCallback(static_cast<Subscriber*>(this), &Subscriber::completed));
+            ++p;
         }
-        catch(const Ice::Exception& ex)
+
+        if(!v.empty())
         {
-            error(true, ex);
+            try
+            {
+                ++_outstanding;
+                Ice::Int count = static_cast<Ice::Int>(v.size());
+                if(_observer)
+                {
+                    _observer->outstanding(count);
+                }
+                _obj->begin_forward(v, Ice::newCallback(this, &SubscriberLink::forwarded), new ForwardCookie(count));
+            }
+            catch(const Ice::Exception& ex)
+            {
+                error(true, ex);
+                return;
+            }
         }
     }
 }
 
+void
+SubscriberLink::forwarded(const Ice::AsyncResultPtr& result)
+{
+    try
+    {
+        result->throwLocalException();
+
+        IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(_lock);
+
+        // Decrement the _outstanding count.
+        --_outstanding;
+        assert(_outstanding >= 0 && _outstanding < _maxOutstanding);
+        if(_observer)
+        {
+            _observer->delivered(ForwardCookiePtr::dynamicCast(result->getCookie())->count);
+        }
+
+        //
+        // A successful response means we're no longer retrying, we're
+        // back active.
+        //
+        _currentRetry = 0;
+
+        if(_events.empty() && _outstanding == 0 && _shutdown)
+        {
+            _lock.notify();
+        }
+        else
+        {
+            flush();
+        }
+    }
+    catch(const Ice::LocalException& ex)
+    {
+        error(true, ex);
+    }
+}
+
+void
+SubscriberLink::lingered()
+{
+    IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(_lock);
+
+    //
+    // The linger time elapsed, forward the queued events even if the
+    // batch is smaller than the maximum size.
+    //
+    _lingering = false;
+    _lingered = true;
+    flush();
+    _lingered = false;
+}
+
 }
 
 SubscriberPtr
@@ -566,11 +954,17 @@ Subscriber::create(
             {
                 reliability = p->second;
             }
-            if(!reliability.empty() && reliability != "ordered")
+            if(!reliability.empty() && reliability != "ordered" && reliability != "batched")
             {
                 throw BadQoS("invalid reliability: " + reliability);
             }
 
+            p = rec.theQoS.find("conflate");
+            if(p != rec.theQoS.end() && p->second.empty())
+            {
+                throw BadQoS("conflate QoS requires a context key");
+            }
+
             //
             // Override the timeout.
             //
@@ -596,6 +990,18 @@ Subscriber::create(
                 }
                 subscriber = new SubscriberTwoway(instance, rec, proxy, retryCount, 1, newObj);
             }
+            else if(reliability == "batched")
+            {
+                if(newObj->ice_isBatchOneway() || newObj->ice_isBatchDatagram())
+                {
+                    throw BadQoS("batched reliability requires a twoway, oneway or datagram proxy");
+                }
+                if(retryCount > 0 && !newObj->ice_isTwoway())
+                {
+                    throw BadQoS("non-zero retryCount QoS requires a twoway proxy");
+                }
+                subscriber = new SubscriberBatched(instance, rec, proxy, retryCount, newObj);
+            }
             else if(newObj->ice_isOneway() || newObj->ice_isDatagram())
             {
                 if(retryCount > 0)
@@ -671,21 +1077,60 @@ Subscriber::queue(bool forwarded, const EventDataSeq& events)
     {
         if(IceUtil::Time::now(IceUtil::Time::Monotonic) < _next)
         {
-            break;
+            //
+            // The events are discarded unless they're kept for the
+            // subscriber until it's back online.
+            //
+            if(!spillOffline())
+            {
+                break;
+            }
+        }
+        else
+        {
+            //
+            // State transition to online.
+            //
+            setState(SubscriberStateOnline);
         }
-
-        //
-        // State transition to online.
-        //
-        setState(SubscriberStateOnline);
         // fall through
     }
 
     case SubscriberStateOnline:
     {
+        int queued = 0;
         for(EventDataSeq::const_iterator p = events.begin(); p != events.end(); ++p)
         {
-            if(static_cast<int>(_events.size()) == _instance->sendQueueSizeMax())
+            if(_filter && !_filter->match(**p))
+            {
+                continue;
+            }
+
+            map<pair<string, string>, Ice::Long>::iterator c = _conflated.end();
+            if(!_conflate.empty())
+            {
+                Ice::Context::const_iterator q = (*p)->context.find(_conflate);
+                if(q != (*p)->context.end())
+                {
+                    c = _conflated.insert(make_pair(make_pair((*p)->op, q->second), Ice::Long(-1))).first;
+
+                    //
+                    // Replace the queued event with the same key if it's
+                    // not sent yet. Spilled events can't be replaced, the
+                    // event is queued after them instead.
+                    //
+                    Ice::Long first = _queued - static_cast<Ice::Long>(_events.size()) -
+                        static_cast<Ice::Long>(_spilled ? _spilled->size() : 0);
+                    if(c->second >= first && c->second - first < static_cast<Ice::Long>(_events.size()))
+                    {
+                        _events[static_cast<size_t>(c->second - first)] = *p;
+                        continue;
+                    }
+                }
+            }
+
+            size_t size = _events.size() + (_spilled ? _spilled->size() : 0);
+            if(static_cast<int>(size) == _instance->sendQueueSizeMax())
             {
                 if(_instance->sendQueueSizeMaxPolicy() == Instance::RemoveSubscriber)
                 {
@@ -695,16 +1140,61 @@ Subscriber::queue(bool forwarded, const EventDataSeq& events)
                 else // DropEvents
                 {
                     _events.pop_front();
+                    loadSpilledEvents();
                 }
             }
-            _events.push_back(*p);
+
+            //
+            // Only the appended or spilled events are reported as queued,
+            // conflated events replace an event already reported.
+            //
+            int threshold = _instance->sendSpillThreshold();
+            if(threshold > 0 && !_spillFailed && (_spilled || static_cast<int>(_events.size()) >= threshold))
+            {
+                spill(*p);
+            }
+            else
+            {
+                _events.push_back(*p);
+            }
+            ++queued;
+            if(c != _conflated.end())
+            {
+                c->second = _queued;
+            }
+            ++_queued;
         }
 
-        if(_observer)
+        //
+        // Remove the keys of the events which are no longer queued once
+        // they outnumber the queued events.
+        //
+        if(_conflated.size() > 2 * _events.size() + 16)
         {
-            _observer->queued(static_cast<Ice::Int>(events.size()));
+            Ice::Long first = _queued - static_cast<Ice::Long>(_events.size()) -
+                static_cast<Ice::Long>(_spilled ? _spilled->size() : 0);
+            map<pair<string, string>, Ice::Long>::iterator q = _conflated.begin();
+            while(q != _conflated.end())
+            {
+                if(q->second < first)
+                {
+                    _conflated.erase(q++);
+                }
+                else
+                {
+                    ++q;
+                }
+            }
+        }
+
+        if(_observer && queued > 0)
+        {
+            _observer->queued(queued);
+        }
+        if(_state == SubscriberStateOnline)
+        {
+            flush();
         }
-        flush();
         break;
     }
     case SubscriberStateError:
@@ -835,7 +1325,8 @@ Subscriber::error(bool dec, const Ice::Exception& e)
                 warn << " endpoints: " << IceStormInternal::describeEndpoints(_rec.obj);
             }
             warn << " subscriber offline: " << e
-                 << " discarding events: " << _instance->discardInterval() << "s retryCount: " << _retryCount;
+                 << (spillOffline() ? " keeping events: " : " discarding events: ")
+                 << _instance->discardInterval() << "s retryCount: " << _retryCount;
         }
         else
         {
@@ -848,22 +1339,28 @@ Subscriber::error(bool dec, const Ice::Exception& e)
                     out << " endpoints: " << IceStormInternal::describeEndpoints(_rec.obj);
                 }
                 out << " subscriber offline: " << e
-                    << " discarding events: " << _instance->discardInterval() << "s retry: "
-                    << _currentRetry << "/" << _retryCount;
+                    << (spillOffline() ? " keeping events: " : " discarding events: ")
+                    << _instance->discardInterval() << "s retry: " << _currentRetry << "/" << _retryCount;
             }
         }
 
         // Transition to offline state, increment the retry count and
-        // clear all queued events.
+        // clear all queued events unless they're kept until the
+        // subscriber is back online. The events already sent are lost.
         _next = now + _instance->discardInterval();
         ++_currentRetry;
-        _events.clear();
+        if(!spillOffline())
+        {
+            _events.clear();
+            _spilled = 0;
+        }
         setState(SubscriberStateOffline);
     }
     // Errored out.
     else if(_state < SubscriberStateError)
     {
         _events.clear();
+        _spilled = 0;
         setState(SubscriberStateError);
 
         TraceLevelsPtr traceLevels = _instance->traceLevels();
@@ -967,10 +1464,14 @@ Subscriber::Subscriber(
     _maxOutstanding(maxOutstanding),
     _proxy(proxy),
     _proxyReplica(proxy),
+    _conflate(getConflateKey(rec.theQoS)),
+    _filter(EventFilter::create(rec.theQoS)),
     _shutdown(false),
     _state(SubscriberStateOnline),
     _outstanding(0),
     _outstandingCount(1),
+    _spillFailed(false),
+    _queued(0),
     _currentRetry(0)
 {
     if(_proxy && _instance->publisherReplicaProxy())
@@ -1041,6 +1542,74 @@ Subscriber::setState(Subscriber::SubscriberState state)
     }
 }
 
+void
+Subscriber::loadSpilledEvents()
+{
+    //
+    // Refill the queue once half of its events are sent, the queue
+    // therefore only becomes empty once the log is empty.
+    //
+    int threshold = _instance->sendSpillThreshold();
+    if(!_spilled || static_cast<int>(_events.size()) > threshold / 2)
+    {
+        return;
+    }
+
+    while(!_spilled->empty() && static_cast<int>(_events.size()) < threshold)
+    {
+        _events.push_back(_spilled->pop());
+    }
+    if(_spilled->empty())
+    {
+        _spilled = 0;
+    }
+}
+
+//
+// Offline subscribers keep their events if enabled and if the events
+// can be spilled, they're discarded otherwise.
+//
+bool
+Subscriber::spillOffline() const
+{
+    return _instance->sendSpillOffline() && !_spillFailed;
+}
+
+void
+Subscriber::spill(const EventDataPtr& event)
+{
+    try
+    {
+        if(!_spilled)
+        {
+            _spilled = new EventLog(_instance->communicator(), _instance->timer(),
+                                    _instance->sendSpillPath() + "/" + IceUtil::generateUUID());
+        }
+        _spilled->push(event);
+    }
+    catch(const Ice::LocalException& ex)
+    {
+        //
+        // Keep the events of this subscriber in memory if they can't be
+        // spilled to disk.
+        //
+        Ice::Warning warn(_instance->traceLevels()->logger);
+        warn << _instance->traceLevels()->subscriberCat << ":" << identityToString(_rec.id)
+             << " unable to spill events to `" << _instance->sendSpillPath() << "':\n" << ex;
+
+        _spillFailed = true;
+        if(_spilled)
+        {
+            while(!_spilled->empty())
+            {
+                _events.push_back(_spilled->pop());
+            }
+            _spilled = 0;
+        }
+        _events.push_back(event);
+    }
+}
+
 bool
 IceStorm::operator==(const SubscriberPtr& subscriber, const Ice::Identity& id)
 {
@@ -1064,3 +1633,89 @@ IceStorm::operator<(const Subscriber& s1, const Subscriber& s2)
 {
     return &s1 < &s2;
 }
+
+IceStorm::SubscriberList::SubscriberList(size_t shards) :
+    _shards(shards),
+    _current(0)
+{
+    _slots[0].snapshot = new Snapshot;
+}
+
+IceStorm::SubscriberList::~SubscriberList()
+{
+    delete _slots[0].snapshot;
+    delete _slots[1].snapshot;
+}
+
+void
+IceStorm::SubscriberList::update(const vector<SubscriberPtr>& subscribers,
+                                 const IceStorm::Instrumentation::TopicObserverPtr& observer)
+{
+    Snapshot* snapshot = new Snapshot;
+    snapshot->subscribers = subscribers;
+    snapshot->observer = observer;
+    if(_shards > 0)
+    {
+        vector<SubscriberShardPtr> shards(_shards);
+        for(vector<SubscriberPtr>::const_iterator p = subscribers.begin(); p != subscribers.end(); ++p)
+        {
+            Ice::Identity id = (*p)->id();
+            Ice::Int h = 5381;
+            IceInternal::hashAdd(h, id.name);
+            IceInternal::hashAdd(h, id.category);
+            size_t index = static_cast<size_t>(static_cast<unsigned int>(h) % _shards);
+            if(!shards[index])
+            {
+                shards[index] = new SubscriberShard(index);
+            }
+            shards[index]->subscribers.push_back(*p);
+        }
+        for(vector<SubscriberShardPtr>::const_iterator p = shards.begin(); p != shards.end(); ++p)
+        {
+            if(*p)
+            {
+                snapshot->shards.push_back(*p);
+            }
+        }
+    }
+
+    //
+    // Wait for the readers of the previous snapshot to be done with it
+    // before replacing it. Readers only hold a slot while queuing an
+    // event with the subscribers.
+    //
+    int next = 1 - _current.load();
+    Slot& slot = _slots[next];
+    while(slot.readers.load() > 0)
+    {
+        IceUtil::ThreadControl::yield();
+    }
+    delete slot.snapshot;
+    slot.snapshot = snapshot;
+    _current.exchange(next);
+}
+
+IceStorm::SubscriberList::Reader::Reader(const SubscriberList& list)
+{
+    //
+    // Register with the slot of the current snapshot, retry if the
+    // current slot changed in the meantime since its snapshot might
+    // have been replaced before we registered.
+    //
+    while(true)
+    {
+        int current = list._current.load();
+        _slot = &list._slots[current];
+        _slot->readers.fetch_add(1);
+        if(list._current.load() == current)
+        {
+            break;
+        }
+        _slot->readers.fetch_sub(1);
+    }
+}
+
+IceStorm::SubscriberList::Reader::~Reader()
+{
+    _slot->readers.fetch_sub(1);
+}
@@ -13,8 +13,12 @@
 #include <IceStorm/IceStormInternal.h>
 #include <IceStorm/SubscriberRecord.h>
 #include <IceStorm/Instrumentation.h>
+#include <IceStorm/EventFilter.h>
+#include <IceStorm/EventLog.h>
 #include <Ice/ObserverHelper.h>
+#include <Ice/RequestBody.h>
 #include <IceUtil/RecMutex.h>
+#include <IceUtil/Atomic.h>
 
 namespace IceStorm
 {
@@ -22,6 +26,52 @@ namespace IceStorm
 class Instance;
 typedef IceUtil::Handle<Instance> InstancePtr;
 
+//
+// An event along with its request body. The request body is encoded
+// once when the event is published and sent as is to each subscriber,
+// the event data is still used to forward the event to linked topics.
+//
+class Event : public EventData
+{
+public:
+
+    Event(const Ice::CommunicatorPtr& communicator, const std::string& op, Ice::OperationMode mode,
+          const std::pair<const Ice::Byte*, const Ice::Byte*>& inParams, const Ice::Context& ctx) :
+        EventData(op, mode, Ice::ByteSeq(), ctx),
+        body(new IceInternal::RequestBody(communicator, op, mode, inParams, ctx))
+    {
+        //
+        // COMPILERBUG: gcc 4.0.1 doesn't like this.
+        //
+        //data.swap(Ice::ByteSeq(inParams.first, inParams.second));
+        Ice::ByteSeq tmp(inParams.first, inParams.second);
+        data.swap(tmp);
+    }
+
+    //
+    // Creates the event from an event forwarded by a linked topic, the
+    // data of the forwarded event is moved to the new event.
+    //
+    Event(const Ice::CommunicatorPtr& communicator, EventData& event) :
+        EventData(event.op, event.mode, Ice::ByteSeq(), event.context),
+        body(new IceInternal::RequestBody(communicator, event.op, event.mode, params(event.data), event.context))
+    {
+        data.swap(event.data);
+    }
+
+    const IceInternal::RequestBodyPtr body;
+
+private:
+
+    static std::pair<const Ice::Byte*, const Ice::Byte*>
+    params(const Ice::ByteSeq& data)
+    {
+        const Ice::Byte* p = data.empty() ? 0 : &data[0];
+        return std::pair<const Ice::Byte*, const Ice::Byte*>(p, p + data.size());
+    }
+};
+typedef IceUtil::Handle<Event> EventPtr;
+
 class Subscriber;
 typedef IceUtil::Handle<Subscriber> SubscriberPtr;
 
@@ -67,6 +117,11 @@ protected:
 
     void setState(SubscriberState);
 
+    // Must be called after removing events from the front of the queue.
+    void loadSpilledEvents();
+    void spill(const EventDataPtr&);
+    bool spillOffline() const;
+
     Subscriber(const InstancePtr&, const IceStorm::SubscriberRecord&, const Ice::ObjectPrx&, int, int);
 
     // Immutable
@@ -76,6 +131,8 @@ protected:
     const int _maxOutstanding; // The maximum number of oustanding events.
     const Ice::ObjectPrx _proxy; // The per subscriber object proxy, if any.
     const Ice::ObjectPrx _proxyReplica; // The replicated per subscriber object proxy, if any.
+    const std::string _conflate; // The context key of the conflated events, if any.
+    const EventFilterPtr _filter; // The filter of the queued events, if any.
 
     IceUtil::Monitor<IceUtil::RecMutex> _lock;
 
@@ -87,6 +144,26 @@ protected:
     int _outstandingCount; // The current number of outstanding events when batching events (only used for metrics).
     EventDataSeq _events; // The queue of events to send.
 
+    //
+    // The events queued once the queue exceeds the spill threshold, if
+    // any. The log is only kept while it has events and the queue is
+    // refilled from the log before it's empty.
+    //
+    EventLogPtr _spilled;
+    bool _spillFailed;
+
+    //
+    // The position of the last queued event of each conflation key, that
+    // is the operation and the value of the conflation context entry.
+    // The positions count the events queued since the subscriber was
+    // created, events are only removed from the front of the queue so
+    // the position of the first queued event is the number of queued
+    // events minus the number of events in the queue and in the spill
+    // log.
+    //
+    std::map<std::pair<std::string, std::string>, Ice::Long> _conflated;
+    Ice::Long _queued;
+
     // The next time to try sending a new event if we're offline.
     IceUtil::Time _next;
     int _currentRetry;
@@ -99,6 +176,104 @@ bool operator==(const IceStorm::Subscriber&, const IceStorm::Subscriber&);
 bool operator!=(const IceStorm::Subscriber&, const IceStorm::Subscriber&);
 bool operator<(const IceStorm::Subscriber&, const IceStorm::Subscriber&);
 
+//
+// A shard of the subscribers of a topic. The subscribers are assigned
+// to the shards based on their identity, the events of a subscriber
+// are therefore always queued by the same thread of the publish pool.
+//
+class SubscriberShard : public IceUtil::Shared
+{
+public:
+
+    SubscriberShard(size_t index) :
+        index(index)
+    {
+    }
+
+    const size_t index;
+    std::vector<SubscriberPtr> subscribers;
+};
+typedef IceUtil::Handle<SubscriberShard> SubscriberShardPtr;
+
+//
+// The subscribers of a topic read by the publishers. Each update of
+// the subscribers publishes an immutable snapshot of the subscriber
+// vector and of the topic observer, publishers read the current
+// snapshot without locking and without copying the vector. When
+// created with a number of shards, the snapshot also provides the
+// non-empty shards of the subscribers.
+//
+class SubscriberList : private IceUtil::noncopyable
+{
+    struct Snapshot
+    {
+        std::vector<SubscriberPtr> subscribers;
+        std::vector<SubscriberShardPtr> shards;
+        IceStorm::Instrumentation::TopicObserverPtr observer;
+    };
+
+    //
+    // The snapshots are stored in two slots. Readers register with the
+    // slot of the current snapshot and updates publish the new snapshot
+    // in the other slot once its readers are gone.
+    //
+    struct Slot
+    {
+        Slot() : snapshot(0), readers(0)
+        {
+        }
+
+        Snapshot* snapshot;
+        mutable IceUtilInternal::Atomic readers;
+    };
+
+public:
+
+    SubscriberList(size_t = 0);
+    ~SubscriberList();
+
+    //
+    // The updates must be serialized by the topic, publishers hold a
+    // snapshot while queuing an event so they must not wait for the
+    // topic mutex.
+    //
+    void update(const std::vector<SubscriberPtr>&, const IceStorm::Instrumentation::TopicObserverPtr& = 0);
+
+    class Reader : private IceUtil::noncopyable
+    {
+    public:
+
+        Reader(const SubscriberList&);
+        ~Reader();
+
+        const std::vector<SubscriberPtr>& subscribers() const
+        {
+            return _slot->snapshot->subscribers;
+        }
+
+        const std::vector<SubscriberShardPtr>& shards() const
+        {
+            return _slot->snapshot->shards;
+        }
+
+        const IceStorm::Instrumentation::TopicObserverPtr& observer() const
+        {
+            return _slot->snapshot->observer;
+        }
+
+    private:
+
+        const Slot* _slot;
+    };
+    friend class Reader;
+
+private:
+
+    const size_t _shards;
+    Slot _slots[2];
+    IceUtilInternal::Atomic _current;
+};
+
 }
 
 #endif // SUBSCRIBER_H
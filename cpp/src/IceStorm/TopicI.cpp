@@ -10,6 +10,7 @@
 #include <IceStorm/TopicI.h>
 #include <IceStorm/Instance.h>
 #include <IceStorm/Subscriber.h>
+#include <IceStorm/PublishPool.h>
 #include <IceStorm/TraceLevels.h>
 #include <IceStorm/NodeI.h>
 #include <IceStorm/Observers.h>
@@ -51,14 +52,8 @@ public:
                const Ice::Current& current)
     {
         // The publish call does a cached read.
-        EventDataPtr event = new EventData(current.operation, current.mode, Ice::ByteSeq(), current.ctx);
-
-        //
-        // COMPILERBUG: gcc 4.0.1 doesn't like this.
-        //
-        //event->data.swap(Ice::ByteSeq(inParams.first, inParams.second));
-        Ice::ByteSeq data(inParams.first, inParams.second);
-        event->data.swap(data);
+        EventDataPtr event = new Event(current.adapter->getCommunicator(), current.operation, current.mode, inParams,
+                                       current.ctx);
 
         EventDataSeq v;
         v.push_back(event);
@@ -87,10 +82,16 @@ public:
     }
 
     virtual void
-    forward(const EventDataSeq& v, const Ice::Current& /*current*/)
+    forward(const EventDataSeq& v, const Ice::Current& current)
     {
+        EventDataSeq events;
+        for(EventDataSeq::const_iterator p = v.begin(); p != v.end(); ++p)
+        {
+            events.push_back(new Event(current.adapter->getCommunicator(), **p));
+        }
+
         // The publish call does a cached read.
-        _impl->publish(true, v);
+        _impl->publish(true, events);
     }
 
 private:
@@ -346,6 +347,8 @@ TopicImpl::TopicImpl(
     _instance(instance),
     _name(name),
     _id(id),
+    _subscriberList(instance->publishPool() ? instance->publishPool()->size() : 0),
+    _pendingPublishes(0),
     _destroyed(false),
     _lluMap(_instance->lluMap()),
     _subscriberMap(_instance->subscriberMap())
@@ -431,6 +434,7 @@ TopicImpl::TopicImpl(
         {
             _observer.attach(_instance->observer()->getTopicObserver(_instance->serviceName(), _name, 0));
         }
+        updateSubscriberList();
     }
     catch(...)
     {
@@ -535,8 +539,6 @@ TopicImpl::subscribeAndGetPublisher(const QoS& qos, const Ice::ObjectPrx& obj)
         }
     }
 
-    IceUtil::Mutex::Lock sync(_subscribersMutex);
-
     SubscriberRecord record;
     record.id = id;
     record.obj = obj;
@@ -545,40 +547,15 @@ TopicImpl::subscribeAndGetPublisher(const QoS& qos, const Ice::ObjectPrx& obj)
     record.link = false;
     record.cost = 0;
 
-    vector<SubscriberPtr>::iterator p = find(_subscribers.begin(), _subscribers.end(), record.id);
-    if(p != _subscribers.end())
-    {
-        throw AlreadySubscribed();
-    }
-
-    LogUpdate llu;
-
-    SubscriberPtr subscriber = Subscriber::create(_instance, record);
-    try
-    {
-        IceDB::ReadWriteTxn txn(_instance->dbEnv());
-
-        SubscriberRecordKey key;
-        key.topic = _id;
-        key.id = subscriber->id();
-
-        _subscriberMap.put(txn, key, record);
-
-        llu = getIncrementedLLU(txn, _lluMap);
-
-        txn.commit();
-    }
-    catch(const IceDB::LMDBException& ex)
-    {
-        logError(_instance->communicator(), ex);
-        throw; // will become UnknownException in caller
-    }
-
-    _subscribers.push_back(subscriber);
-
-    _instance->observers()->addSubscriber(llu, _name, record);
+    //
+    // The subscriber is added by a group commit with the subscriber
+    // changes of the concurrent requests.
+    //
+    GroupCommit::UpdatePtr update = new GroupCommit::Update(this, SubscriberRecordSeq(1, record), Ice::IdentitySeq());
+    _instance->groupCommit()->commit(update);
 
-    return subscriber->proxy();
+    assert(update->subscribers.size() == 1);
+    return update->subscribers.back()->proxy();
 }
 
 void
@@ -609,7 +586,6 @@ TopicImpl::unsubscribe(const Ice::ObjectPrx& subscriber)
         }
     }
 
-    IceUtil::Mutex::Lock sync(_subscribersMutex);
     Ice::IdentitySeq ids;
     ids.push_back(id);
     removeSubscribers(ids);
@@ -687,6 +663,7 @@ TopicImpl::link(const TopicPrx& topic, Ice::Int cost)
     }
 
     _subscribers.push_back(subscriber);
+    updateSubscriberList();
 
     _instance->observers()->addSubscriber(llu, _name, record);
 }
@@ -733,8 +710,6 @@ TopicImpl::unlink(const TopicPrx& topic)
 void
 TopicImpl::reap(const Ice::IdentitySeq& ids)
 {
-    IceUtil::Mutex::Lock sync(_subscribersMutex);
-
     TraceLevelsPtr traceLevels = _instance->traceLevels();
     if(traceLevels->topic > 0)
     {
@@ -766,6 +741,7 @@ TopicImpl::shutdown()
     }
 
     _observer.detach();
+    updateSubscriberList();
 }
 
 LinkInfoSeq
@@ -825,6 +801,7 @@ TopicImpl::destroy()
     _instance->observers()->destroyTopic(destroyInternal(llu, true), _name);
 
     _observer.detach();
+    updateSubscriberList();
 }
 
 TopicContent
@@ -901,6 +878,7 @@ TopicImpl::update(const SubscriberRecordSeq& records)
             _subscribers.push_back(subscriber);
         }
     }
+    updateSubscriberList();
 }
 
 bool
@@ -962,59 +940,117 @@ private:
     const Ice::Long _generation;
 };
 
+class TopicPublishCB : public PublishCallback
+{
+public:
+
+    TopicPublishCB(const TopicImplPtr& topic) :
+        _topic(topic)
+    {
+    }
+
+    virtual void reap(const Ice::IdentitySeq& ids)
+    {
+        _topic->reapSubscribers(ids);
+    }
+
+    virtual void completed()
+    {
+        _topic->publishCompleted();
+    }
+
+private:
+
+    const TopicImplPtr _topic;
+};
+
 }
 
 void
 TopicImpl::publish(bool forwarded, const EventDataSeq& events)
 {
-    TopicInternalPrx masterInternal;
-    Ice::Long generation = -1;
     Ice::IdentitySeq reap;
+    PublishPoolPtr throttle;
     {
         // Use cached reads.
         CachedReadHelper unlock(_instance->node(), __FILE__, __LINE__);
 
         //
-        // Copy of the subscriber list so that event publishing can occur
-        // in parallel.
+        // Read the current snapshot of the subscriber list so that event
+        // publishing can occur in parallel, without locking the
+        // subscribers mutex or copying the list.
         //
-        vector<SubscriberPtr> copy;
+        SubscriberList::Reader reader(_subscriberList);
+        if(reader.observer())
         {
-            IceUtil::Mutex::Lock sync(_subscribersMutex);
-            if(_observer)
+            if(forwarded)
             {
-                if(forwarded)
-                {
-                    _observer->forwarded();
-                }
-                else
-                {
-                    _observer->published();
-                }
+                reader.observer()->forwarded();
+            }
+            else
+            {
+                reader.observer()->published();
             }
-            copy = _subscribers;
         }
 
         //
-        // Queue each event, gathering a list of those subscribers that
-        // must be reaped.
+        // Let the publish pool queue the events with the subscribers of
+        // large topics. The events are also queued by the pool while it
+        // still queues previous events, to preserve their order.
         //
-        for(vector<SubscriberPtr>::const_iterator p = copy.begin(); p != copy.end(); ++p)
+        PublishPoolPtr pool = _instance->publishPool();
+        const vector<SubscriberShardPtr>& shards = reader.shards();
+        if(pool && !shards.empty() &&
+           (reader.subscribers().size() >= pool->minSubscribers() || _pendingPublishes.load() > 0))
+        {
+            _pendingPublishes.fetch_add(1);
+            pool->queue(shards, forwarded, events, new TopicPublishCB(this));
+            throttle = pool;
+        }
+        else
         {
-            if(!(*p)->queue(forwarded, events) && (*p)->reap())
+            //
+            // Queue each event, gathering a list of those subscribers that
+            // must be reaped.
+            //
+            const vector<SubscriberPtr>& subscribers = reader.subscribers();
+            for(vector<SubscriberPtr>::const_iterator p = subscribers.begin(); p != subscribers.end(); ++p)
             {
-                reap.push_back((*p)->id());
+                if(!(*p)->queue(forwarded, events) && (*p)->reap())
+                {
+                    reap.push_back((*p)->id());
+                }
             }
         }
+    }
 
-        // If there are no subscribers in error then we're done.
-        if(reap.empty())
-        {
-            return;
-        }
+    //
+    // Wait for the publish pool to catch up with the events once the
+    // cached read and the subscriber list snapshot are released, the
+    // pool threads need them to reap subscribers.
+    //
+    if(throttle)
+    {
+        throttle->throttle();
+    }
+
+    // If there are no subscribers in error then we're done.
+    if(!reap.empty())
+    {
+        reapSubscribers(reap);
+    }
+}
+
+void
+TopicImpl::reapSubscribers(const Ice::IdentitySeq& reap)
+{
+    TopicInternalPrx masterInternal;
+    Ice::Long generation = -1;
+    {
+        // Use cached reads.
+        CachedReadHelper unlock(_instance->node(), __FILE__, __LINE__);
         if(!unlock.getMaster())
         {
-            IceUtil::Mutex::Lock sync(_subscribersMutex);
             removeSubscribers(reap);
             return;
         }
@@ -1022,7 +1058,6 @@ TopicImpl::publish(bool forwarded, const EventDataSeq& events)
         generation = unlock.generation();
     }
 
-
     // Tell the master to reap this set of subscribers. This is an
     // AMI invocation so it shouldn't block the caller (in the
     // typical case) we do it outside of the mutex lock for
@@ -1036,6 +1071,12 @@ TopicImpl::publish(bool forwarded, const EventDataSeq& events)
                                                                     &TopicInternalReapCB::exception));
 }
 
+void
+TopicImpl::publishCompleted()
+{
+    _pendingPublishes.fetch_sub(1);
+}
+
 void
 TopicImpl::observerAddSubscriber(const LogUpdate& llu, const SubscriberRecord& record)
 {
@@ -1100,6 +1141,7 @@ TopicImpl::observerAddSubscriber(const LogUpdate& llu, const SubscriberRecord& r
     }
 
     _subscribers.push_back(subscriber);
+    updateSubscriberList();
 }
 
 void
@@ -1160,6 +1202,7 @@ TopicImpl::observerRemoveSubscriber(const LogUpdate& llu, const Ice::IdentitySeq
             _subscribers.erase(p);
         }
     }
+    updateSubscriberList();
 }
 
 void
@@ -1196,6 +1239,7 @@ TopicImpl::updateObserver()
     if(_instance->observer())
     {
         _observer.attach(_instance->observer()->getTopicObserver(_instance->serviceName(), _name, _observer.get()));
+        updateSubscriberList();
     }
 }
 
@@ -1209,6 +1253,13 @@ TopicImpl::updateSubscriberObservers()
     }
 }
 
+void
+TopicImpl::updateSubscriberList()
+{
+    // Must be called with the subscribers mutex locked
+    _subscriberList.update(_subscribers, _observer.get());
+}
+
 LogUpdate
 TopicImpl::destroyInternal(const LogUpdate& origLLU, bool master)
 {
@@ -1265,6 +1316,7 @@ TopicImpl::destroyInternal(const LogUpdate& origLLU, bool master)
         (*p)->destroy();
     }
     _subscribers.clear();
+    updateSubscriberList();
 
     _instance->topicAdapter()->remove(_id);
 
@@ -1276,60 +1328,93 @@ TopicImpl::destroyInternal(const LogUpdate& origLLU, bool master)
 void
 TopicImpl::removeSubscribers(const Ice::IdentitySeq& ids)
 {
-    // First update the database
+    //
+    // The subscribers are removed by a group commit with the
+    // subscriber changes of the concurrent requests.
+    //
+    _instance->groupCommit()->commit(new GroupCommit::Update(this, SubscriberRecordSeq(), ids));
+}
 
-    LogUpdate llu;
-    bool found = false;
-    try
+void
+TopicImpl::writeUpdate(const IceDB::ReadWriteTxn& txn, GroupCommit::Update& update, set<Ice::Identity>& added,
+                       bool master)
+{
+    // Must be called with the subscribers mutex locked
+
+    //
+    // First remove the subscribers from the database. Its possible
+    // that some of these subscribers have already been removed
+    // (consider, for example, a concurrent reap call from two replicas
+    // on the same subscriber).
+    //
+    for(Ice::IdentitySeq::const_iterator id = update.removed.begin(); id != update.removed.end(); ++id)
     {
-        IceDB::ReadWriteTxn txn(_instance->dbEnv());
+        SubscriberRecordKey key;
+        key.topic = _id;
+        key.id = *id;
 
-        for(Ice::IdentitySeq::const_iterator id = ids.begin(); id != ids.end(); ++id)
+        if(_subscriberMap.del(txn, key))
         {
-            SubscriberRecordKey key;
-            key.topic = _id;
-            key.id = *id;
+            update.written = true;
+        }
+        added.erase(*id);
+    }
 
-            if(_subscriberMap.del(txn, key))
+    //
+    // Then add the new subscribers. A subscriber is already subscribed
+    // if it's still in the database or if it was added by a previous
+    // update of this commit.
+    //
+    for(SubscriberRecordSeq::const_iterator p = update.added.begin(); p != update.added.end(); ++p)
+    {
+        SubscriberRecordKey key;
+        key.topic = _id;
+        key.id = p->id;
+
+        if(added.find(p->id) != added.end() ||
+           (find(_subscribers.begin(), _subscribers.end(), p->id) != _subscribers.end() &&
+            _subscriberMap.find(txn, key)))
+        {
+            if(master)
             {
-                found = true;
+                throw AlreadySubscribed();
             }
-        }
 
-        if(found)
-        {
-            llu = getIncrementedLLU(txn, _lluMap);
-            txn.commit();
-        }
-        else
-        {
-            txn.rollback();
+            // If the subscriber is already in the database display a
+            // diagnostic.
+            TraceLevelsPtr traceLevels = _instance->traceLevels();
+            if(traceLevels->topic > 0)
+            {
+                Ice::Trace out(traceLevels->logger, traceLevels->topicCat);
+                out << identityToString(p->id) << ": already subscribed";
+            }
+            continue;
         }
+
+        update.subscribers.push_back(Subscriber::create(_instance, *p));
+        _subscriberMap.put(txn, key, *p);
+        added.insert(p->id);
+        update.written = true;
     }
-    catch(const IceDB::LMDBException& ex)
-    {
-        logError(_instance->communicator(), ex);
-        throw; // will become UnknownException in caller
-    }
+}
 
-    if(found)
+void
+TopicImpl::applyUpdate(const GroupCommit::Update& update)
+{
+    // Must be called with the subscribers mutex locked
+
+    //
+    // If the subscriber had a local failure and was removed from the
+    // subscriber list it could already be gone. That's not a problem.
+    //
+    for(Ice::IdentitySeq::const_iterator id = update.removed.begin(); id != update.removed.end(); ++id)
     {
-        // Then remove the subscriber from the subscribers list. Its
-        // possible that some of these subscribers have already been
-        // removed (consider, for example, a concurrent reap call from two
-        // replicas on the same subscriber). To avoid sending unnecessary
-        // observer updates keep track of the observers that are actually
-        // removed.
-        for(Ice::IdentitySeq::const_iterator id = ids.begin(); id != ids.end(); ++id)
+        vector<SubscriberPtr>::iterator p = find(_subscribers.begin(), _subscribers.end(), *id);
+        if(p != _subscribers.end())
         {
-            vector<SubscriberPtr>::iterator p = find(_subscribers.begin(), _subscribers.end(), *id);
-            if(p != _subscribers.end())
-            {
-                (*p)->destroy();
-                _subscribers.erase(p);
-            }
+            (*p)->destroy();
+            _subscribers.erase(p);
         }
-
-        _instance->observers()->removeSubscriber(llu, _name, ids);
     }
+    _subscribers.insert(_subscribers.end(), update.subscribers.begin(), update.subscribers.end());
 }
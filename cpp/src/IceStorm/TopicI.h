@@ -14,8 +14,11 @@
 #include <IceStorm/Election.h>
 #include <IceStorm/Instrumentation.h>
 #include <IceStorm/Util.h>
+#include <IceStorm/Subscriber.h>
+#include <IceStorm/GroupCommit.h>
 #include <Ice/ObserverHelper.h>
 #include <list>
+#include <set>
 
 namespace IceStorm
 {
@@ -24,9 +27,6 @@ namespace IceStorm
 class PersistentInstance;
 typedef IceUtil::Handle<PersistentInstance> PersistentInstancePtr;
 
-class Subscriber;
-typedef IceUtil::Handle<Subscriber> SubscriberPtr;
-
 class TopicImpl : public IceUtil::Shared
 {
 public:
@@ -57,6 +57,8 @@ public:
     TopicPrx proxy() const;
     void shutdown();
     void publish(bool, const EventDataSeq&);
+    void reapSubscribers(const Ice::IdentitySeq&);
+    void publishCompleted();
 
     // Observer methods.
     void observerAddSubscriber(const IceStormElection::LogUpdate&, const SubscriberRecord&);
@@ -70,8 +72,15 @@ public:
 
 private:
 
+    friend class GroupCommit;
+
+    // Group commit methods, called with the subscribers mutex locked.
+    void writeUpdate(const IceDB::ReadWriteTxn&, GroupCommit::Update&, std::set<Ice::Identity>&, bool);
+    void applyUpdate(const GroupCommit::Update&);
+
     IceStormElection::LogUpdate destroyInternal(const IceStormElection::LogUpdate&, bool);
     void removeSubscribers(const Ice::IdentitySeq&);
+    void updateSubscriberList();
 
     //
     // Immutable members.
@@ -100,6 +109,15 @@ private:
     //
     std::vector<SubscriberPtr> _subscribers;
 
+    //
+    // The snapshot of the subscribers and of the topic observer read by
+    // the publishers, updated with the subscribers mutex locked.
+    //
+    SubscriberList _subscriberList;
+
+    // The number of publishes whose events are being queued by the publish pool.
+    IceUtilInternal::Atomic _pendingPublishes;
+
     bool _destroyed; // Has this Topic been destroyed?
 
     LLUMap _lluMap;
@@ -216,6 +216,22 @@ public:
         }
     }
 
+    virtual void updateSubscribers(const LogUpdate& llu, const SubscriberUpdateSeq& updates, const Ice::Current&)
+    {
+        try
+        {
+            ObserverUpdateHelper unlock(_instance->node(), llu.generation, __FILE__, __LINE__);
+            _impl->observerUpdateSubscribers(llu, updates);
+        }
+        catch(const ObserverInconsistencyException& e)
+        {
+            Ice::Warning warn(_instance->traceLevels()->logger);
+            warn << "ReplicaObserverI::updateSubscribers: ObserverInconsistencyException: " << e.reason;
+            _instance->node()->recovery(llu.generation);
+            throw;
+        }
+    }
+
 private:
 
     const PersistentInstancePtr _instance;
@@ -613,6 +629,46 @@ TopicManagerImpl::observerRemoveSubscriber(const LogUpdate& llu, const string& n
     topic->observerRemoveSubscriber(llu, id);
 }
 
+void
+TopicManagerImpl::observerUpdateSubscribers(const LogUpdate& llu, const SubscriberUpdateSeq& updates)
+{
+    TraceLevelsPtr traceLevels = _instance->traceLevels();
+    if(traceLevels->topicMgr > 0)
+    {
+        Ice::Trace out(traceLevels->logger, traceLevels->topicMgrCat);
+        out << "update subscribers:";
+        for(SubscriberUpdateSeq::const_iterator p = updates.begin(); p != updates.end(); ++p)
+        {
+            out << " topic: " << p->topic;
+            if(!p->removed.empty())
+            {
+                out << " removed: " << p->removed.size();
+            }
+            if(!p->added.empty())
+            {
+                out << " added: " << p->added.size();
+            }
+        }
+        out << " llu: " << llu.generation << "/" << llu.iteration;
+    }
+
+    vector<GroupCommit::UpdatePtr> v;
+    {
+        Lock sync(*this);
+
+        for(SubscriberUpdateSeq::const_iterator p = updates.begin(); p != updates.end(); ++p)
+        {
+            map<string, TopicImplPtr>::iterator q = _topics.find(p->topic);
+            if(q == _topics.end())
+            {
+                throw ObserverInconsistencyException("no topic: " + p->topic);
+            }
+            v.push_back(new GroupCommit::Update(q->second, p->added, p->removed));
+        }
+    }
+    _instance->groupCommit()->observerCommit(llu, v);
+}
+
 void
 TopicManagerImpl::getContent(LogUpdate& llu, TopicContentSeq& content)
 {
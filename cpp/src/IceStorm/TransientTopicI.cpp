@@ -10,6 +10,7 @@
 #include <IceStorm/TransientTopicI.h>
 #include <IceStorm/Instance.h>
 #include <IceStorm/Subscriber.h>
+#include <IceStorm/PublishPool.h>
 #include <IceStorm/TraceLevels.h>
 #include <IceStorm/Util.h>
 
@@ -43,18 +44,8 @@ public:
                const Ice::Current& current)
     {
         // Use cached reads.
-        EventDataPtr event = new EventData(
-            current.operation,
-            current.mode,
-            Ice::ByteSeq(),
-            current.ctx);
-
-        //
-        // COMPILERBUG: gcc 4.0.1 doesn't like this.
-        //
-        //event->data.swap(Ice::ByteSeq(inParams.first, inParams.second));
-        Ice::ByteSeq data(inParams.first, inParams.second);
-        event->data.swap(data);
+        EventDataPtr event = new Event(current.adapter->getCommunicator(), current.operation, current.mode, inParams,
+                                       current.ctx);
 
         EventDataSeq v;
         v.push_back(event);
@@ -82,9 +73,38 @@ public:
     }
 
     virtual void
-    forward(const EventDataSeq& v, const Ice::Current& /*current*/)
+    forward(const EventDataSeq& v, const Ice::Current& current)
+    {
+        EventDataSeq events;
+        for(EventDataSeq::const_iterator p = v.begin(); p != v.end(); ++p)
+        {
+            events.push_back(new Event(current.adapter->getCommunicator(), **p));
+        }
+        _impl->publish(true, events);
+    }
+
+private:
+
+    const TransientTopicImplPtr _impl;
+};
+
+class TransientTopicPublishCB : public PublishCallback
+{
+public:
+
+    TransientTopicPublishCB(const TransientTopicImplPtr& impl) :
+        _impl(impl)
+    {
+    }
+
+    virtual void reap(const Ice::IdentitySeq& ids)
     {
-        _impl->publish(true, v);
+        _impl->reapSubscribers(ids);
+    }
+
+    virtual void completed()
+    {
+        _impl->publishCompleted();
     }
 
 private:
@@ -101,6 +121,8 @@ TransientTopicImpl::TransientTopicImpl(
     _instance(instance),
     _name(name),
     _id(id),
+    _subscriberList(instance->publishPool() ? instance->publishPool()->size() : 0),
+    _pendingPublishes(0),
     _destroyed(false)
 {
     //
@@ -259,6 +281,7 @@ TransientTopicImpl::subscribe(const QoS& origQoS, const Ice::ObjectPrx& obj, con
 
     SubscriberPtr subscriber = Subscriber::create(_instance, record);
     _subscribers.push_back(subscriber);
+    _subscriberList.update(_subscribers);
 }
 
 Ice::ObjectPrx
@@ -315,6 +338,7 @@ TransientTopicImpl::subscribeAndGetPublisher(const QoS& qos, const Ice::ObjectPr
 
     SubscriberPtr subscriber = Subscriber::create(_instance, record);
     _subscribers.push_back(subscriber);
+    _subscriberList.update(_subscribers);
 
     return subscriber->proxy();
 }
@@ -354,6 +378,7 @@ TransientTopicImpl::unsubscribe(const Ice::ObjectPrx& subscriber, const Ice::Cur
     {
         (*p)->destroy();
         _subscribers.erase(p);
+        _subscriberList.update(_subscribers);
     }
 }
 
@@ -401,6 +426,7 @@ TransientTopicImpl::link(const TopicPrx& topic, Ice::Int cost, const Ice::Curren
 
     SubscriberPtr subscriber = Subscriber::create(_instance, record);
     _subscribers.push_back(subscriber);
+    _subscriberList.update(_subscribers);
 }
 
 void
@@ -445,6 +471,7 @@ TransientTopicImpl::unlink(const TopicPrx& topic, const Ice::Current&)
     {
         (*p)->destroy();
         _subscribers.erase(p);
+        _subscriberList.update(_subscribers);
     }
 }
 
@@ -515,6 +542,7 @@ TransientTopicImpl::destroy(const Ice::Current&)
         (*p)->destroy();
     }
     _subscribers.clear();
+    _subscriberList.update(_subscribers);
 }
 
 void
@@ -540,63 +568,103 @@ void
 TransientTopicImpl::publish(bool forwarded, const EventDataSeq& events)
 {
     //
-    // Copy of the subscriber list so that event publishing can occur
-    // in parallel.
-    //
-    vector<SubscriberPtr> copy;
-    {
-        Lock sync(*this);
-        copy = _subscribers;
-    }
-
+    // Read the current snapshot of the subscriber list so that event
+    // publishing can occur in parallel, without locking the topic or
+    // copying the list.
     //
     // Queue each event, gathering a list of those subscribers that
     // must be reaped.
     //
-    vector<Ice::Identity> e;
-    for(vector<SubscriberPtr>::const_iterator p = copy.begin(); p != copy.end(); ++p)
+    Ice::IdentitySeq e;
+    PublishPoolPtr throttle;
     {
-        if(!(*p)->queue(forwarded, events) && (*p)->reap())
+        SubscriberList::Reader reader(_subscriberList);
+
+        //
+        // Let the publish pool queue the events with the subscribers of
+        // large topics. The events are also queued by the pool while it
+        // still queues previous events, to preserve their order.
+        //
+        PublishPoolPtr pool = _instance->publishPool();
+        const vector<SubscriberShardPtr>& shards = reader.shards();
+        if(pool && !shards.empty() &&
+           (reader.subscribers().size() >= pool->minSubscribers() || _pendingPublishes.load() > 0))
         {
-            e.push_back((*p)->id());
+            _pendingPublishes.fetch_add(1);
+            pool->queue(shards, forwarded, events, new TransientTopicPublishCB(this));
+            throttle = pool;
+        }
+        else
+        {
+            const vector<SubscriberPtr>& subscribers = reader.subscribers();
+            for(vector<SubscriberPtr>::const_iterator p = subscribers.begin(); p != subscribers.end(); ++p)
+            {
+                if(!(*p)->queue(forwarded, events) && (*p)->reap())
+                {
+                    e.push_back((*p)->id());
+                }
+            }
         }
     }
 
+    //
+    // Wait for the publish pool to catch up with the events once the
+    // subscriber list snapshot is released, the pool threads might
+    // update the list to reap subscribers.
+    //
+    if(throttle)
+    {
+        throttle->throttle();
+    }
+
+    if(!e.empty())
+    {
+        reapSubscribers(e);
+    }
+}
+
+void
+TransientTopicImpl::reapSubscribers(const Ice::IdentitySeq& e)
+{
     //
     // Run through the error list removing those subscribers that are
     // in error from the subscriber list.
     //
-    if(!e.empty())
+    Lock sync(*this);
+    for(Ice::IdentitySeq::const_iterator ep = e.begin(); ep != e.end(); ++ep)
     {
-        Lock sync(*this);
-        for(vector<Ice::Identity>::const_iterator ep = e.begin(); ep != e.end(); ++ep)
+        //
+        // Its possible for the subscriber to already have been
+        // removed since the snapshot is iterated over outside of
+        // mutex protection.
+        //
+        // Note that although this could be quicker if we used a
+        // map, the most optimal case should be pushing around
+        // events not searching for a particular subscriber.
+        //
+        // The subscriber is immediately destroyed & removed from
+        // the _subscribers list. Add the subscriber to a list of
+        // error'd subscribers and remove it from the database on
+        // the next reap.
+        //
+        vector<SubscriberPtr>::iterator q = find(_subscribers.begin(), _subscribers.end(), *ep);
+        if(q != _subscribers.end())
         {
+            SubscriberPtr subscriber = *q;
             //
-            // Its possible for the subscriber to already have been
-            // removed since the copy is iterated over outside of
-            // mutex protection.
-            //
-            // Note that although this could be quicker if we used a
-            // map, the most optimal case should be pushing around
-            // events not searching for a particular subscriber.
+            // Destroy the subscriber.
             //
-            // The subscriber is immediately destroyed & removed from
-            // the _subscribers list. Add the subscriber to a list of
-            // error'd subscribers and remove it from the database on
-            // the next reap.
-            //
-            vector<SubscriberPtr>::iterator q = find(_subscribers.begin(), _subscribers.end(), *ep);
-            if(q != _subscribers.end())
-            {
-                SubscriberPtr subscriber = *q;
-                //
-                // Destroy the subscriber.
-                //
-                subscriber->destroy();
-                _subscribers.erase(q);
-            }
+            subscriber->destroy();
+            _subscribers.erase(q);
         }
     }
+    _subscriberList.update(_subscribers);
+}
+
+void
+TransientTopicImpl::publishCompleted()
+{
+    _pendingPublishes.fetch_sub(1);
 }
 
 void
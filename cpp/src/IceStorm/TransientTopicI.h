@@ -11,6 +11,7 @@
 #define TRANSIENT_TOPIC_I_H
 
 #include <IceStorm/IceStormInternal.h>
+#include <IceStorm/Subscriber.h>
 
 namespace IceStorm
 {
@@ -19,9 +20,6 @@ namespace IceStorm
 class Instance;
 typedef IceUtil::Handle<Instance> InstancePtr;
 
-class Subscriber;
-typedef IceUtil::Handle<Subscriber> SubscriberPtr;
-
 class TransientTopicImpl : public TopicInternal, public IceUtil::Mutex
 {
 public:
@@ -47,6 +45,8 @@ public:
     bool destroyed() const;
     Ice::Identity id() const;
     void publish(bool, const EventDataSeq&);
+    void reapSubscribers(const Ice::IdentitySeq&);
+    void publishCompleted();
 
     void shutdown();
 
@@ -71,6 +71,15 @@ private:
     //
     std::vector<SubscriberPtr> _subscribers;
 
+    //
+    // The snapshot of the subscribers read by the publishers, updated
+    // with the topic locked.
+    //
+    SubscriberList _subscriberList;
+
+    // The number of publishes whose events are being queued by the publish pool.
+    IceUtilInternal::Atomic _pendingPublishes;
+
     bool _destroyed; // Has this Topic been destroyed?
 };
 
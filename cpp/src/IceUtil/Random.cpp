@@ -15,9 +15,15 @@
 #include <IceUtil/Mutex.h>
 #include <IceUtil/MutexPtrLock.h>
 
+#include <cstring>
+
 #ifndef _WIN32
 #   include <unistd.h>
 #   include <fcntl.h>
+#   include <pthread.h>
+#   ifdef __linux__
+#      include <sys/syscall.h>
+#   endif
 #endif
 
 using namespace std;
@@ -38,13 +44,27 @@ namespace
 // platforms is usually a port from Linux, this problem could be
 // widespread. Therefore, we serialize access to /dev/urandom using a
 // static mutex.
-// 
+//
+// /dev/urandom (or getrandom when available) is now only used to seed
+// the per-thread generators below, so this mutex is no longer acquired
+// on the hot path.
+//
 Mutex* staticMutex = 0;
 int fd = -1;
 
 //
-// Callback to use with pthread_atfork to reset the "/dev/urandom"  
-// fd state. We don't need to close the fd here as that is done 
+// Incremented in the child after fork, so that the per-thread
+// generators inherited from the parent are reseeded instead of
+// producing the same stream in both processes.
+//
+volatile int forkGeneration = 0;
+
+pthread_key_t generatorKey;
+bool generatorKeyInitialized = false;
+
+//
+// Callback to use with pthread_atfork to reset the "/dev/urandom"
+// fd state. We don't need to close the fd here as that is done
 // during static destruction.
 //
 extern "C"
@@ -56,10 +76,258 @@ void childAtFork()
     {
         fd = -1;
     }
+    ++forkGeneration;
+}
+
+}
+
+void
+readDevURandom(char* buffer, size_t size)
+{
+    //
+    // Serialize access to /dev/urandom; see comment above.
+    //
+    IceUtilInternal::MutexPtrLock<IceUtil::Mutex> lock(staticMutex);
+    if(fd == -1)
+    {
+        fd = open("/dev/urandom", O_RDONLY);
+        if(fd == -1)
+        {
+            throw SyscallException(__FILE__, __LINE__, errno);
+        }
+    }
+
+    //
+    // Limit the number of attempts to 20 reads to avoid
+    // a potential "for ever" loop
+    //
+    int reads = 0;
+    size_t index = 0;
+    while(reads <= 20 && index != size)
+    {
+        ssize_t bytesRead = read(fd, buffer + index, size - index);
+
+        if(bytesRead == -1 && errno != EINTR)
+        {
+            throw SyscallException(__FILE__, __LINE__, errno);
+        }
+        else
+        {
+            index += bytesRead;
+            reads++;
+        }
+    }
+
+    if(index != size)
+    {
+        throw SyscallException(__FILE__, __LINE__, 0);
+    }
+}
+
+//
+// Read random bytes from the kernel, using the getrandom system call
+// if available and falling back to /dev/urandom otherwise.
+//
+void
+readKernelRandom(char* buffer, size_t size)
+{
+#if defined(__linux__) && defined(SYS_getrandom)
+    size_t index = 0;
+    while(index != size)
+    {
+        long bytesRead = syscall(SYS_getrandom, buffer + index, size - index, 0);
+        if(bytesRead == -1)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            else if(errno == ENOSYS && index == 0)
+            {
+                break; // Kernel older than 3.17
+            }
+            throw SyscallException(__FILE__, __LINE__, errno);
+        }
+        index += static_cast<size_t>(bytesRead);
+    }
+    if(index == size)
+    {
+        return;
+    }
+#endif
+    readDevURandom(buffer, size);
+}
+
+//
+// Per-thread ChaCha20 based generator. Each thread seeds its own
+// generator from the kernel and then produces its output from a
+// buffered key stream without any locking. The first 32 bytes of each
+// refill are used to re-key the generator ("fast key erasure") so that
+// previously returned output cannot be recovered from the state, and
+// the generator is periodically reseeded from the kernel.
+//
+const size_t chachaBlockSize = 64;
+const size_t generatorBufferSize = 8 * chachaBlockSize;
+const size_t generatorKeySize = 32;
+const size_t generatorReseedInterval = 1024 * 1024;
+
+inline unsigned int
+rotl(unsigned int v, int c)
+{
+    return (v << c) | (v >> (32 - c));
+}
+
+inline void
+quarterRound(unsigned int* x, int a, int b, int c, int d)
+{
+    x[a] += x[b]; x[d] = rotl(x[d] ^ x[a], 16);
+    x[c] += x[d]; x[b] = rotl(x[b] ^ x[c], 12);
+    x[a] += x[b]; x[d] = rotl(x[d] ^ x[a], 8);
+    x[c] += x[d]; x[b] = rotl(x[b] ^ x[c], 7);
+}
+
+class RandomGenerator
+{
+public:
+
+    RandomGenerator() :
+        _available(0),
+        _generated(0),
+        _forkGeneration(forkGeneration)
+    {
+        assert(sizeof(unsigned int) == 4);
+        reseed();
+    }
+
+    ~RandomGenerator()
+    {
+        memset(_state, 0, sizeof(_state));
+        memset(_buffer, 0, sizeof(_buffer));
+    }
+
+    void
+    generate(char* buffer, size_t size)
+    {
+        if(_forkGeneration != forkGeneration || _generated >= generatorReseedInterval)
+        {
+            _forkGeneration = forkGeneration;
+            reseed();
+        }
+
+        while(size > 0)
+        {
+            if(_available == 0)
+            {
+                refill();
+            }
+
+            size_t n = size < _available ? size : _available;
+            unsigned char* p = _buffer + generatorBufferSize - _available;
+            memcpy(buffer, p, n);
+            memset(p, 0, n); // Don't keep returned output around
+            buffer += n;
+            size -= n;
+            _available -= n;
+            _generated += n;
+        }
+    }
+
+private:
+
+    void
+    reseed()
+    {
+        static const unsigned int sigma[4] = { 0x61707865, 0x3320646e, 0x79622d32, 0x6b206574 };
+
+        memcpy(_state, sigma, sizeof(sigma));
+        readKernelRandom(reinterpret_cast<char*>(_state + 4), generatorKeySize);
+        _state[12] = 0;
+        _state[13] = 0;
+        _state[14] = 0;
+        _state[15] = 0;
+        _available = 0;
+        _generated = 0;
+    }
+
+    void
+    refill()
+    {
+        for(size_t i = 0; i < generatorBufferSize; i += chachaBlockSize)
+        {
+            unsigned int x[16];
+            memcpy(x, _state, sizeof(x));
+            for(int r = 0; r < 10; ++r)
+            {
+                quarterRound(x, 0, 4, 8, 12);
+                quarterRound(x, 1, 5, 9, 13);
+                quarterRound(x, 2, 6, 10, 14);
+                quarterRound(x, 3, 7, 11, 15);
+                quarterRound(x, 0, 5, 10, 15);
+                quarterRound(x, 1, 6, 11, 12);
+                quarterRound(x, 2, 7, 8, 13);
+                quarterRound(x, 3, 4, 9, 14);
+            }
+            for(int j = 0; j < 16; ++j)
+            {
+                x[j] += _state[j];
+            }
+            memcpy(_buffer + i, x, chachaBlockSize);
+            if(++_state[12] == 0)
+            {
+                ++_state[13];
+            }
+        }
+
+        //
+        // Re-key with the first bytes of the key stream and only hand
+        // out the remaining bytes.
+        //
+        memcpy(_state + 4, _buffer, generatorKeySize);
+        memset(_buffer, 0, generatorKeySize);
+        _state[12] = 0;
+        _state[13] = 0;
+        _available = generatorBufferSize - generatorKeySize;
+    }
+
+    unsigned int _state[16];
+    unsigned char _buffer[generatorBufferSize];
+    size_t _available;
+    size_t _generated;
+    int _forkGeneration;
+};
+
+extern "C"
+{
+
+void randomGeneratorThreadDestructor(void* generator)
+{
+    delete static_cast<RandomGenerator*>(generator);
 }
 
 }
 
+RandomGenerator*
+getThreadGenerator()
+{
+    if(!generatorKeyInitialized)
+    {
+        return 0;
+    }
+
+    RandomGenerator* generator = static_cast<RandomGenerator*>(pthread_getspecific(generatorKey));
+    if(!generator)
+    {
+        generator = new RandomGenerator;
+        int err = pthread_setspecific(generatorKey, generator);
+        if(err != 0)
+        {
+            delete generator;
+            throw SyscallException(__FILE__, __LINE__, err);
+        }
+    }
+    return generator;
+}
+
 class Init
 {
 public:
@@ -69,14 +337,30 @@ public:
         staticMutex = new IceUtil::Mutex;
 
         //
-        // Register a callback to reset the "/dev/urandom" fd 
+        // Register a callback to reset the "/dev/urandom" fd
         // state after fork.
         //
         pthread_atfork(0, 0, &childAtFork);
+
+        //
+        // Note that we never delete this key: other threads might still
+        // be running during static destruction.
+        //
+        generatorKeyInitialized = pthread_key_create(&generatorKey, &randomGeneratorThreadDestructor) == 0;
     }
-    
+
     ~Init()
     {
+        if(generatorKeyInitialized)
+        {
+            //
+            // The key destructor isn't called for the main thread.
+            //
+            delete static_cast<RandomGenerator*>(pthread_getspecific(generatorKey));
+            pthread_setspecific(generatorKey, 0);
+            generatorKeyInitialized = false;
+        }
+
         if(fd != -1)
         {
             close(fd);
@@ -124,42 +408,17 @@ IceUtilInternal::generateRandom(char* buffer, size_t size)
     }
 #else
     //
-    // Serialize access to /dev/urandom; see comment above.
-    //
-    IceUtilInternal::MutexPtrLock<IceUtil::Mutex> lock(staticMutex);
-    if(fd == -1)
-    {
-        fd = open("/dev/urandom", O_RDONLY);
-        if(fd == -1)
-        {
-            throw SyscallException(__FILE__, __LINE__, errno);
-        }
-    }
-    
-    //
-    // Limit the number of attempts to 20 reads to avoid
-    // a potential "for ever" loop
+    // Use the calling thread's generator; before static initialization
+    // (or after static destruction) we read directly from the kernel.
     //
-    int reads = 0;
-    size_t index = 0;    
-    while(reads <= 20 && index != size)
+    RandomGenerator* generator = getThreadGenerator();
+    if(generator)
     {
-        ssize_t bytesRead = read(fd, buffer + index, size - index);
-        
-        if(bytesRead == -1 && errno != EINTR)
-        {
-            throw SyscallException(__FILE__, __LINE__, errno);
-        }
-        else
-        {
-            index += bytesRead;
-            reads++;
-        }
+        generator->generate(buffer, size);
     }
-        
-    if(index != size)
+    else
     {
-        throw SyscallException(__FILE__, __LINE__, 0);
+        readKernelRandom(buffer, size);
     }
 #endif
 }
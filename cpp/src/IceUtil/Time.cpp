@@ -22,6 +22,7 @@
 #ifdef __APPLE__
 #   include <mach/mach.h>
 #   include <mach/mach_time.h>
+#   include <pthread.h>
 #endif
 
 using namespace IceUtil;
@@ -113,7 +114,7 @@ IceUtil::Time::now(Clock clock)
         return Time(tv.tv_sec * ICE_INT64(1000000) + tv.tv_usec);
 #endif
     }
-    else // Monotonic
+    else if(clock == Monotonic)
     {
 #if defined(_WIN32)
         if(frequency > 0.0)
@@ -158,6 +159,48 @@ IceUtil::Time::now(Clock clock)
             throw SyscallException(__FILE__, __LINE__, errno);
         }
         return Time(ts.tv_sec * ICE_INT64(1000000) + ts.tv_nsec / ICE_INT64(1000));
+#endif
+    }
+    else // ThreadCpu
+    {
+#if defined(_WIN32) && !defined(ICE_OS_WINRT)
+        FILETIME creationTime, exitTime, kernelTime, userTime;
+        if(!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+        {
+            assert(0);
+            throw SyscallException(__FILE__, __LINE__, GetLastError());
+        }
+        ULARGE_INTEGER kernel, user;
+        kernel.LowPart = kernelTime.dwLowDateTime;
+        kernel.HighPart = kernelTime.dwHighDateTime;
+        user.LowPart = userTime.dwLowDateTime;
+        user.HighPart = userTime.dwHighDateTime;
+        return Time(static_cast<Int64>(kernel.QuadPart + user.QuadPart) / 10); // 100ns units
+#elif defined(__APPLE__)
+        thread_basic_info_data_t info;
+        mach_msg_type_number_t count = THREAD_BASIC_INFO_COUNT;
+        if(thread_info(pthread_mach_thread_np(pthread_self()), THREAD_BASIC_INFO,
+                       reinterpret_cast<thread_info_t>(&info), &count) != KERN_SUCCESS)
+        {
+            assert(0);
+            throw SyscallException(__FILE__, __LINE__, 0);
+        }
+        return Time((info.user_time.seconds + info.system_time.seconds) * ICE_INT64(1000000) +
+                    info.user_time.microseconds + info.system_time.microseconds);
+#elif defined(CLOCK_THREAD_CPUTIME_ID)
+        struct timespec ts;
+        if(clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) < 0)
+        {
+            assert(0);
+            throw SyscallException(__FILE__, __LINE__, errno);
+        }
+        return Time(ts.tv_sec * ICE_INT64(1000000) + ts.tv_nsec / ICE_INT64(1000));
+#else
+        //
+        // The CPU time of the calling thread isn't available on this
+        // platform.
+        //
+        return Time();
 #endif
     }
 }
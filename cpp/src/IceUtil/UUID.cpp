@@ -10,8 +10,9 @@
 #include <IceUtil/UUID.h>
 
 // On Windows, we use Windows's RPC UUID generator.
-// On other platforms, we use a high quality random number generator 
-// (/dev/random) to generate "version 4" UUIDs, as described in 
+// On other platforms, we use a high quality random number generator
+// (a per-thread generator seeded from the kernel, see Random.cpp) to
+// generate "version 4" UUIDs, as described in
 // http://www.ietf.org/internet-drafts/draft-mealling-uuid-urn-00.txt
 
 #include <IceUtil/Random.h>
@@ -0,0 +1,160 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestCommon.h>
+#include <Test.h>
+#include <new>
+#include <stdlib.h>
+
+using namespace std;
+
+//
+// Count the heap allocations of the client while the test invokes
+// on the server. The global operator new is replaced on all the
+// platforms, with glibc malloc is also replaced to count the Ice
+// stream buffer allocations. These replacements apply to the whole
+// program, which is why this test has its own client.
+//
+namespace
+{
+
+volatile bool counting = false;
+IceUtil::Mutex* countMutex = 0;
+int allocations = 0;
+
+void
+countAllocation()
+{
+    if(counting)
+    {
+        IceUtil::Mutex::Lock sync(*countMutex);
+        ++allocations;
+    }
+}
+
+void
+startCounting()
+{
+    if(!countMutex)
+    {
+        countMutex = new IceUtil::Mutex;
+    }
+    allocations = 0;
+    counting = true;
+}
+
+int
+stopCounting()
+{
+    counting = false;
+    IceUtil::Mutex::Lock sync(*countMutex);
+    return allocations;
+}
+
+}
+
+#ifdef __GLIBC__
+
+extern "C" void* __libc_malloc(size_t);
+extern "C" void* __libc_realloc(void*, size_t);
+
+extern "C" void*
+malloc(size_t size)
+{
+    countAllocation();
+    return __libc_malloc(size);
+}
+
+extern "C" void*
+realloc(void* p, size_t size)
+{
+    countAllocation();
+    return __libc_realloc(p, size);
+}
+
+void*
+operator new(size_t size)
+{
+    void* p = malloc(size ? size : 1);
+    if(!p)
+    {
+        throw bad_alloc();
+    }
+    return p;
+}
+
+#else
+
+void*
+operator new(size_t size)
+{
+    countAllocation();
+    void* p = malloc(size ? size : 1);
+    if(!p)
+    {
+        throw bad_alloc();
+    }
+    return p;
+}
+
+#endif
+
+void
+operator delete(void* p) ICE_NOEXCEPT
+{
+    free(p);
+}
+
+void
+allTests(const Ice::CommunicatorPtr& communicator)
+{
+    Test::TestIntfPrxPtr p =
+        ICE_CHECKED_CAST(Test::TestIntfPrx, communicator->stringToProxy("test:" + getTestEndpoint(communicator, 0)));
+    test(p);
+
+    cout << "testing invocation allocations... " << flush;
+
+    //
+    // Only plain TCP invocations are allocation free, the metrics
+    // observers, the compression and the other transports allocate.
+    //
+    Ice::PropertiesPtr properties = communicator->getProperties();
+    if(p->ice_getConnection()->getEndpoint()->getInfo()->type() != Ice::TCPEndpointType ||
+       !properties->getPropertiesForPrefix("IceMX.Metrics").empty() ||
+       properties->getPropertyAsInt("Ice.Override.Compress") > 0)
+    {
+        cout << "skipped" << endl;
+    }
+    else
+    {
+        //
+        // Invoke until the thread caches reach their steady state: the
+        // caches only allocate blocks when the blocks in circulation are
+        // all held by the other threads, this is bounded by the size of
+        // the caches.
+        //
+        int count = -1;
+        for(int n = 0; n < 20 && count != 0; ++n)
+        {
+            startCounting();
+            for(int i = 0; i < 1000; ++i)
+            {
+                p->opVoid();
+                test(p->opInt(i) == i);
+                test(p->opDouble(i) == i);
+            }
+            count = stopCounting();
+        }
+        test(count == 0);
+        cout << "ok" << endl;
+    }
+
+    p->shutdown();
+}
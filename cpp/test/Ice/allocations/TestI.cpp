@@ -0,0 +1,34 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestI.h>
+
+void
+TestIntfI::opVoid(const Ice::Current&)
+{
+}
+
+Ice::Int
+TestIntfI::opInt(Ice::Int i, const Ice::Current&)
+{
+    return i;
+}
+
+Ice::Double
+TestIntfI::opDouble(Ice::Double d, const Ice::Current&)
+{
+    return d;
+}
+
+void
+TestIntfI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
@@ -0,0 +1,25 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include <Test.h>
+
+class TestIntfI : public Test::TestIntf
+{
+public:
+
+    virtual void opVoid(const Ice::Current&);
+    virtual Ice::Int opInt(Ice::Int, const Ice::Current&);
+    virtual Ice::Double opDouble(Ice::Double, const Ice::Current&);
+    virtual void shutdown(const Ice::Current&);
+};
+
+#endif
@@ -9,6 +9,8 @@
 
 #include <IceUtil/Random.h>
 #include <Ice/Ice.h>
+#include <Ice/EndpointI.h>
+#include <Ice/EndpointLatency.h>
 #include <TestCommon.h>
 #include <Test.h>
 #include <set>
@@ -805,6 +807,80 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing per request binding and latency aware endpoint selection... " << flush;
+    {
+        vector<RemoteObjectAdapterPrxPtr> adapters;
+        adapters.push_back(com->createObjectAdapter("Adapter91", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter92", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter93", "default"));
+
+        TestIntfPrxPtr test = createTestIntfPrx(adapters);
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_endpointSelection(Ice::LatencyAware));
+        test(test->ice_getEndpointSelection() == Ice::LatencyAware);
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_connectionCached(false));
+        test(!test->ice_isConnectionCached());
+
+        //
+        // The power of two choices still picks the slowest endpoint
+        // first when the same endpoint is picked twice.
+        //
+        set<string> names;
+        names.insert("Adapter91");
+        names.insert("Adapter92");
+        names.insert("Adapter93");
+        for(int i = 0; i < 1000 && !names.empty(); ++i)
+        {
+            names.erase(test->getAdapterName());
+        }
+        test(names.empty());
+
+        //
+        // The endpoint of a deactivated adapter is tried last once the
+        // connection establishment failed.
+        //
+        com->deactivateObjectAdapter(adapters[0]);
+        adapters.erase(adapters.begin());
+        for(int i = 0; i < 20; ++i)
+        {
+            test(test->getAdapterName() != "Adapter91");
+        }
+
+        deactivate(com, adapters);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing endpoint latency table... " << flush;
+    {
+        //
+        // The entries of the endpoints no longer used are evicted: the
+        // table stays bounded when the endpoints keep changing.
+        //
+        IceInternal::EndpointLatencyTablePtr table = new IceInternal::EndpointLatencyTable(IceUtil::Time());
+        Ice::EndpointSeq endpts = communicator->stringToProxy("test:tcp -h 127.0.0.1 -p 10000")->ice_getEndpoints();
+        IceInternal::EndpointIPtr endpoint = ICE_DYNAMIC_CAST(IceInternal::EndpointI, endpts[0]);
+        IceInternal::EndpointLatencyPtr latency = table->get(endpoint);
+        latency->addSample(IceUtil::Time::milliSeconds(1));
+
+        for(int i = 1; i <= 1000; ++i)
+        {
+            ostringstream os;
+            os << "test:tcp -h 127.0.0.1 -p " << 10000 + i;
+            endpts = communicator->stringToProxy(os.str())->ice_getEndpoints();
+            table->get(ICE_DYNAMIC_CAST(IceInternal::EndpointI, endpts[0]))->addSample(IceUtil::Time::milliSeconds(i));
+            test(table->size() <= 16);
+        }
+
+        //
+        // The entry still used by a connection is kept and the
+        // attributes which don't change the server are ignored.
+        //
+        endpts = communicator->stringToProxy("test:tcp -h 127.0.0.1 -p 10000 -t 10000 -z")->ice_getEndpoints();
+        test(table->get(ICE_DYNAMIC_CAST(IceInternal::EndpointI, endpts[0])).get() == latency.get());
+        test(table->get(endpoint).get() == latency.get());
+        test(latency->average() == 1000);
+    }
+    cout << "ok" << endl;
+
     cout << "testing endpoint mode filtering... " << flush;
     {
         vector<RemoteObjectAdapterPrxPtr> adapters;
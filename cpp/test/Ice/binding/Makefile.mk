@@ -0,0 +1,13 @@
+# **********************************************************************
+#
+# Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+#
+# This copy of Ice is licensed to you under the terms described in the
+# ICE_LICENSE file included in this distribution.
+#
+# **********************************************************************
+
+# The client tests the endpoint latency table from src/Ice/EndpointLatency.h
+$(test)_cppflags 	:= -I$(srcdir)
+
+tests += $(test)
@@ -13,6 +13,8 @@
 #include <Test.h>
 #include <Dispatcher.h>
 
+#include <set>
+
 using namespace std;
 
 namespace
@@ -110,6 +112,170 @@ private:
 };
 ICE_DEFINE_PTR(CallbackPtr, Callback);
 
+class ExecutorCallback
+#ifndef ICE_CPP11_MAPPING
+    : public IceUtil::Shared
+#endif
+{
+public:
+
+    ExecutorCallback() :
+        _count(0)
+    {
+    }
+
+    void
+    called()
+    {
+        test(IceUtil::ThreadControl() != _mainThread);
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_m);
+        _threads.insert(IceUtil::ThreadControl().id());
+        ++_count;
+        _m.notifyAll();
+    }
+
+    size_t
+    threads()
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_m);
+        return _threads.size();
+    }
+
+    void
+    waitFor(int count)
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_m);
+        while(_count < count)
+        {
+            _m.wait();
+        }
+    }
+
+private:
+
+    const IceUtil::ThreadControl _mainThread;
+    IceUtil::Monitor<IceUtil::Mutex> _m;
+    int _count;
+    set<IceUtil::ThreadControl::ID> _threads;
+};
+ICE_DEFINE_PTR(ExecutorCallbackPtr, ExecutorCallback);
+
+class WarningLogger : public Ice::Logger, private IceUtil::Mutex
+#ifdef ICE_CPP11_MAPPING
+                    , public std::enable_shared_from_this<WarningLogger>
+#endif
+{
+public:
+
+    virtual void
+    print(const string&)
+    {
+    }
+
+    virtual void
+    trace(const string&, const string&)
+    {
+    }
+
+    virtual void
+    warning(const string& message)
+    {
+        Lock sync(*this);
+        _warnings.push_back(message);
+    }
+
+    virtual void
+    error(const string&)
+    {
+    }
+
+    virtual string
+    getPrefix()
+    {
+        return "";
+    }
+
+    virtual Ice::LoggerPtr
+    cloneWithPrefix(const string&)
+    {
+        return ICE_SHARED_FROM_THIS;
+    }
+
+    vector<string>
+    warnings()
+    {
+        Lock sync(*this);
+        return _warnings;
+    }
+
+private:
+
+    vector<string> _warnings;
+};
+ICE_DEFINE_PTR(WarningLoggerPtr, WarningLogger);
+
+#ifdef ICE_CPP11_MAPPING
+void
+execute(const Ice::CommunicatorPtr& communicator, const ExecutorCallbackPtr& cb)
+{
+    Ice::executeInClientThreadPool(communicator, [cb]() { cb->called(); });
+}
+#else
+class ExecutorCall : public Ice::DispatcherCall
+{
+public:
+
+    ExecutorCall(const ExecutorCallbackPtr& cb) : _cb(cb)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        _cb->called();
+    }
+
+private:
+
+    const ExecutorCallbackPtr _cb;
+};
+
+void
+execute(const Ice::CommunicatorPtr& communicator, const ExecutorCallbackPtr& cb)
+{
+    Ice::executeInClientThreadPool(communicator, new ExecutorCall(cb));
+}
+
+class StealCall : public Ice::DispatcherCall
+{
+public:
+
+    StealCall(const Ice::CommunicatorPtr& communicator, const ExecutorCallbackPtr& cb,
+              const ExecutorCallbackPtr& done, int count) :
+        _communicator(communicator), _cb(cb), _done(done), _count(count)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        for(int i = 0; i < _count; ++i)
+        {
+            execute(_communicator, _cb);
+        }
+        _cb->waitFor(_count);
+        _done->called();
+    }
+
+private:
+
+    const Ice::CommunicatorPtr _communicator;
+    const ExecutorCallbackPtr _cb;
+    const ExecutorCallbackPtr _done;
+    const int _count;
+};
+#endif
+
 }
 
 void
@@ -273,5 +439,97 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing work-stealing executor... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.ThreadPool.Client.SizeMax", "2");
+        initData.properties->setProperty("Ice.ThreadPool.Client.WorkStealing", "4");
+        Ice::CommunicatorPtr comm = Ice::initialize(initData);
+
+        ExecutorCallbackPtr cb = ICE_MAKE_SHARED(ExecutorCallback);
+        for(int i = 0; i < 1000; ++i)
+        {
+            execute(comm, cb);
+        }
+        cb->waitFor(1000);
+
+        //
+        // The calls queued by an executor thread are added to its own
+        // queue, they can only complete if the other threads steal them.
+        //
+        cb = ICE_MAKE_SHARED(ExecutorCallback);
+        ExecutorCallbackPtr done = ICE_MAKE_SHARED(ExecutorCallback);
+#ifdef ICE_CPP11_MAPPING
+        Ice::executeInClientThreadPool(comm, [comm, cb, done]()
+            {
+                for(int i = 0; i < 10; ++i)
+                {
+                    execute(comm, cb);
+                }
+                cb->waitFor(10);
+                done->called();
+            });
+#else
+        Ice::executeInClientThreadPool(comm, new StealCall(comm, cb, done, 10));
+#endif
+        done->waitFor(1);
+
+        comm->destroy();
+        try
+        {
+            execute(comm, cb);
+            test(false);
+        }
+        catch(const Ice::CommunicatorDestroyedException&)
+        {
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing work-stealing executor with ordered thread pools... " << flush;
+    {
+        //
+        // The work items of a pool with a single thread or with
+        // serialized dispatch are still executed in order by the pool
+        // threads, WorkStealing is ignored with a warning.
+        //
+        for(int i = 0; i < 2; ++i)
+        {
+            Ice::InitializationData initData;
+            initData.properties = communicator->getProperties()->clone();
+            initData.properties->setProperty("Ice.ThreadPool.Client.WorkStealing", "4");
+            if(i == 0)
+            {
+                initData.properties->setProperty("Ice.ThreadPool.Client.SizeMax", "1");
+            }
+            else
+            {
+                initData.properties->setProperty("Ice.ThreadPool.Client.Size", "2");
+                initData.properties->setProperty("Ice.ThreadPool.Client.Serialize", "1");
+            }
+            WarningLoggerPtr logger = ICE_MAKE_SHARED(WarningLogger);
+            initData.logger = logger;
+            Ice::CommunicatorPtr comm = Ice::initialize(initData);
+
+            ExecutorCallbackPtr cb = ICE_MAKE_SHARED(ExecutorCallback);
+            for(int j = 0; j < 100; ++j)
+            {
+                execute(comm, cb);
+            }
+            cb->waitFor(100);
+            if(i == 0)
+            {
+                test(cb->threads() == 1);
+            }
+
+            vector<string> warnings = logger->warnings();
+            test(warnings.size() == 1);
+            test(warnings[0].find("Ice.ThreadPool.Client.WorkStealing ignored") == 0);
+            comm->destroy();
+        }
+    }
+    cout << "ok" << endl;
+
     p->shutdown();
 }
@@ -50,6 +50,16 @@ main(int argc, char* argv[])
     {
         Ice::InitializationData initData;
         initData.properties = Ice::createProperties(argc, argv);
+
+        //
+        // Execute the collocated dispatches and the AMI callbacks with
+        // work-stealing executors, which requires pools with more than
+        // one thread.
+        //
+        initData.properties->setProperty("Ice.ThreadPool.Client.SizeMax", "2");
+        initData.properties->setProperty("Ice.ThreadPool.Client.WorkStealing", "2");
+        initData.properties->setProperty("Ice.ThreadPool.Server.SizeMax", "2");
+        initData.properties->setProperty("Ice.ThreadPool.Server.WorkStealing", "2");
 #ifdef ICE_CPP11_MAPPING
         IceUtil::Handle<Dispatcher> dispatcher = new Dispatcher;
         initData.dispatcher = [=](function<void()> call, const shared_ptr<Ice::Connection>& conn)
@@ -278,6 +278,84 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing connections per endpoint... " << flush;
+    {
+        Ice::PropertiesPtr properties = communicator->getProperties();
+        properties->setProperty("Pool.Proxy", communicator->proxyToString(testIntf));
+        properties->setProperty("Pool.Proxy.ConnectionsPerEndpoint", "3");
+        TestIntfPrxPtr pool = ICE_UNCHECKED_CAST(TestIntfPrx, communicator->propertyToProxy("Pool.Proxy"));
+        test(communicator->proxyToProperty(pool, "Pool.Proxy")["Pool.Proxy.ConnectionsPerEndpoint"] == "3");
+        test(communicator->proxyToProperty(testIntf, "Test").count("Test.ConnectionsPerEndpoint") == 0);
+
+        //
+        // Twoway invocations are sent over the connections of the pool.
+        //
+        set<string> ports;
+        for(int i = 0; i < 100 && ports.size() < 3; ++i)
+        {
+            ports.insert(pool->getConnectionInfoAsContext()["remotePort"]);
+            if(i > 10)
+            {
+                IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+            }
+        }
+        test(ports.size() == 3);
+
+        //
+        // The first connection of the pool is shared with the proxies
+        // without a pool, oneway invocations only use this connection.
+        //
+        test(pool->ice_getConnection() == testIntf->ice_getConnection());
+        test(pool->ice_oneway()->ice_getConnection() == testIntf->ice_getConnection());
+
+        //
+        // A closed connection of the pool is replaced, the other
+        // connections are kept.
+        //
+        Ice::ConnectionPtr connection = pool->ice_getConnection();
+        ostringstream os;
+        os << getTCPConnectionInfo(connection->getInfo())->localPort;
+        const string closedPort = os.str();
+        connection->close(false);
+        set<string> newPorts;
+        for(int i = 0; i < 100 && newPorts.size() < 3; ++i)
+        {
+            newPorts.insert(pool->getConnectionInfoAsContext()["remotePort"]);
+            if(i > 10)
+            {
+                IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+            }
+        }
+        test(newPorts.size() == 3);
+        test(newPorts.count(closedPort) == 0);
+        ports.erase(closedPort);
+        for(set<string>::const_iterator p = ports.begin(); p != ports.end(); ++p)
+        {
+            test(newPorts.count(*p) == 1);
+        }
+        test(pool->ice_getConnection() != connection);
+
+        properties->setProperty("Pool.Proxy", "");
+        properties->setProperty("Pool.Proxy.ConnectionsPerEndpoint", "");
+    }
+    cout << "ok" << endl;
+
+    cout << "testing dispatch tag... " << flush;
+    {
+        Ice::Context ctx = testIntf->getDispatchTagAsContext();
+        test(ctx["adapter"] == "TestAdapter");
+        test(ctx["category"] == "");
+        test(ctx["name"] == "test");
+        test(ctx["facet"] == "");
+        test(ctx["operation"] == "getDispatchTagAsContext");
+
+        //
+        // The tag is only set while the thread dispatches a request.
+        //
+        test(!Ice::getDispatchTag());
+    }
+    cout << "ok" << endl;
+
     testIntf->shutdown();
 
     communicator->shutdown();
@@ -119,3 +119,18 @@ TestI::getConnectionInfoAsContext(const Ice::Current& c)
 
     return ctx;
 }
+
+Ice::Context
+TestI::getDispatchTagAsContext(const Ice::Current&)
+{
+    const Ice::DispatchTag* tag = Ice::getDispatchTag();
+    test(tag);
+
+    Ice::Context ctx;
+    ctx["adapter"] = tag->adapter;
+    ctx["category"] = tag->category;
+    ctx["name"] = tag->name;
+    ctx["facet"] = tag->facet;
+    ctx["operation"] = tag->operation;
+    return ctx;
+}
@@ -20,6 +20,7 @@ public:
 
     virtual Ice::Context getEndpointInfoAsContext(const Ice::Current&);
     virtual Ice::Context getConnectionInfoAsContext(const Ice::Current&);
+    virtual Ice::Context getDispatchTagAsContext(const Ice::Current&);
 };
 
 #endif
@@ -784,5 +784,85 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
 #endif
     cout << "ok" << endl;
+
+#ifndef ICE_CPP11_MAPPING
+    cout << "testing ice_invoke with a shared request body... " << flush;
+    {
+        Ice::ByteSeq inEncaps, outEncaps;
+        IceInternal::RequestBodyPtr body =
+            new IceInternal::RequestBody(communicator, "opOneway", Ice::Normal,
+                                         make_pair(static_cast<const Ice::Byte*>(0), static_cast<const Ice::Byte*>(0)),
+                                         Ice::Context());
+        test(oneway->ice_invoke(body, outEncaps));
+        test(batchOneway->ice_invoke(body, outEncaps));
+        test(batchOneway->ice_invoke(body, outEncaps));
+        batchOneway->ice_flushBatchRequests();
+
+        //
+        // Send the same request body with several connections, the
+        // large string ensures the body isn't always sent at once.
+        //
+        const size_t sizes[] = { 0, 1000, 100 * 1000, 400 * 1000 };
+        for(size_t i = 0; i < sizeof(sizes) / sizeof(size_t); ++i)
+        {
+            string s = testString;
+            s.resize(max(s.size(), sizes[i]), 'x');
+
+            Ice::OutputStream out(communicator);
+            out.startEncapsulation();
+            out.write(s);
+            out.endEncapsulation();
+            out.finished(inEncaps);
+
+            body = new IceInternal::RequestBody(communicator, "opString", Ice::Normal,
+                                                make_pair(&inEncaps[0], &inEncaps[0] + inEncaps.size()),
+                                                Ice::Context());
+
+            vector<Ice::AsyncResultPtr> results;
+            for(int j = 0; j < 5; ++j)
+            {
+                ostringstream os;
+                os << "body-" << j;
+                results.push_back(cl->ice_connectionId(os.str())->begin_ice_invoke(body));
+                results.push_back(cl->ice_connectionId(os.str())->begin_ice_invoke(body));
+            }
+            test(cl->ice_invoke(body, outEncaps));
+            for(vector<Ice::AsyncResultPtr>::const_iterator p = results.begin(); p != results.end(); ++p)
+            {
+                Ice::ByteSeq outParams;
+                test((*p)->getProxy()->end_ice_invoke(outParams, *p));
+                test(outParams == outEncaps);
+            }
+
+            Ice::InputStream in(communicator, out.getEncoding(), outEncaps);
+            in.startEncapsulation();
+            string r;
+            in.read(r);
+            test(r == s);
+            in.read(r);
+            test(r == s);
+            in.endEncapsulation();
+        }
+
+        Ice::OutputStream out(communicator);
+        out.startEncapsulation();
+        out.write(testString);
+        out.endEncapsulation();
+        out.finished(inEncaps);
+        body = new IceInternal::RequestBody(communicator, "opString", Ice::Normal,
+                                            make_pair(&inEncaps[0], &inEncaps[0] + inEncaps.size()), Ice::Context());
+
+        ::CallbackPtr cb = new ::Callback(communicator, false);
+        Ice::Callback_Object_ice_invokePtr d = Ice::newCallback_Object_ice_invoke(cb, &Callback::opStringNC, nullEx);
+        cl->begin_ice_invoke(body, d);
+        cb->check();
+
+        cb = new ::Callback(communicator, false);
+        cl->ice_collocationOptimized(false)->begin_ice_invoke(body, Ice::newCallback(cb, &Callback::opString));
+        cb->check();
+    }
+    cout << "ok" << endl;
+#endif
+
     return cl;
 }
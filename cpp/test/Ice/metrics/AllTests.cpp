@@ -940,6 +940,71 @@ allTests(const Ice::CommunicatorPtr& communicator, const CommunicatorObserverIPt
 
     cout << "ok" << endl;
 
+    cout << "testing dispatch metrics histogram... " << flush;
+
+    props["IceMX.Metrics.View.Map.Dispatch.Histogram"] = "1";
+    updateProps(clientProps, serverProps, update.get(), props, "Dispatch");
+    for(int i = 0; i < 100; ++i)
+    {
+        metrics->op();
+    }
+
+    map = toMap(serverMetrics->getMetricsView("View", timestamp)["Dispatch"]);
+    dm1 = ICE_DYNAMIC_CAST(IceMX::DispatchMetrics, map["op"]);
+    test(dm1->total == 100 && dm1->lifetimeHistogram);
+    {
+        const IceMX::MetricsHistogram& histogram = *dm1->lifetimeHistogram;
+        test(histogram.count >= dm1->total - dm1->current && histogram.count <= dm1->total);
+        Ice::Long count = 0;
+        Ice::Long upperBound = -1;
+        for(IceMX::MetricsHistogramBucketSeq::const_iterator p = histogram.buckets.begin();
+            p != histogram.buckets.end(); ++p)
+        {
+            test(p->count > 0 && p->upperBound > upperBound);
+            upperBound = p->upperBound;
+            count += p->count;
+        }
+        test(count == histogram.count);
+        test(histogram.min <= histogram.p50 && histogram.p50 <= histogram.p90 && histogram.p90 <= histogram.p99);
+        test(histogram.p99 <= histogram.p999 && histogram.p999 <= histogram.max);
+        test(histogram.max <= dm1->totalLifetime);
+    }
+
+    props["IceMX.Metrics.View.Map.Dispatch.Histogram"] = "";
+    updateProps(clientProps, serverProps, update.get(), props, "Dispatch");
+    metrics->op();
+    map = toMap(serverMetrics->getMetricsView("View", timestamp)["Dispatch"]);
+    test(!ICE_DYNAMIC_CAST(IceMX::DispatchMetrics, map["op"])->lifetimeHistogram);
+
+    cout << "ok" << endl;
+
+    cout << "testing dispatch metrics cpu time... " << flush;
+
+    test(!ICE_DYNAMIC_CAST(IceMX::DispatchMetrics, map["op"])->cpuTime);
+
+    props["IceMX.Metrics.View.Map.Dispatch.CpuTime"] = "1";
+    updateProps(clientProps, serverProps, update.get(), props, "Dispatch");
+    for(int i = 0; i < 100; ++i)
+    {
+        metrics->op();
+    }
+
+    map = toMap(serverMetrics->getMetricsView("View", timestamp)["Dispatch"]);
+    dm1 = ICE_DYNAMIC_CAST(IceMX::DispatchMetrics, map["op"]);
+    test(dm1->total == 100);
+    test(dm1->cpuTime && *dm1->cpuTime >= 0 && *dm1->cpuTime <= dm1->totalLifetime + dm1->total);
+#if defined(__linux__)
+    test(*dm1->cpuTime > 0);
+#endif
+
+    props["IceMX.Metrics.View.Map.Dispatch.CpuTime"] = "";
+    updateProps(clientProps, serverProps, update.get(), props, "Dispatch");
+    metrics->op();
+    map = toMap(serverMetrics->getMetricsView("View", timestamp)["Dispatch"]);
+    test(!ICE_DYNAMIC_CAST(IceMX::DispatchMetrics, map["op"])->cpuTime);
+
+    cout << "ok" << endl;
+
     cout << "testing invocation metrics... " << flush;
 
     props["IceMX.Metrics.View.Map.Invocation.GroupBy"] = "operation";
@@ -1396,6 +1461,82 @@ allTests(const Ice::CommunicatorPtr& communicator, const CommunicatorObserverIPt
 
     cout << "ok" << endl;
 
+    cout << "testing invocation metrics cache... " << flush;
+
+    //
+    // The entries matched by a proxy are cached, make sure the context
+    // attributes are still resolved on each invocation.
+    //
+    props["IceMX.Metrics.View.Map.Invocation.GroupBy"] = "context.entry1";
+    updateProps(clientProps, serverProps, update.get(), props, "Invocation");
+    Ice::Context ctx;
+    ctx["entry1"] = "a";
+    metrics->op(ctx);
+    metrics->op(ctx);
+    ctx["entry1"] = "b";
+    metrics->op(ctx);
+    map = toMap(clientMetrics->getMetricsView("View", timestamp)["Invocation"]);
+    test(map.size() == 2 && map["a"]->total == 2 && map["b"]->total == 1);
+
+    props["IceMX.Metrics.View.Map.Invocation.GroupBy"] = "operation";
+    props["IceMX.Metrics.View.Map.Invocation.Reject.operation"] = "opByteS";
+    updateProps(clientProps, serverProps, update.get(), props, "Invocation");
+    for(int i = 0; i < 10; ++i)
+    {
+        metrics->op();
+        metrics->opByteS(Test::ByteSeq());
+    }
+    map = toMap(clientMetrics->getMetricsView("View", timestamp)["Invocation"]);
+    test(map.size() == 1 && map["op"]->total == 10 && map["op"]->current == 0);
+
+    props["IceMX.Metrics.View.Map.Invocation.Reject.operation"] = "";
+    updateProps(clientProps, serverProps, update.get(), props, "Invocation");
+
+    cout << "ok" << endl;
+
+    cout << "testing OpenMetrics export... " << flush;
+
+    metrics->op();
+    IceMX::MetricsExporterPrxPtr exporter =
+        ICE_CHECKED_CAST(IceMX::MetricsExporterPrx, communicator->getAdmin(), "MetricsExporter");
+    string text = exporter->getOpenMetrics();
+    test(text.find("# TYPE ice_invocation counter\n") != string::npos);
+    test(text.find("ice_invocation_total{view=\"View\",id=\"op\"} 1\n") != string::npos);
+    test(text.find("# TYPE ice_invocation_lifetime_seconds counter\n") != string::npos);
+    test(text.find("ice_invocation_current{view=\"View\",id=\"op\"} 0\n") != string::npos);
+    test(text.size() > 6 && text.compare(text.size() - 6, 6, "# EOF\n") == 0);
+
+    props["IceMX.Metrics.View.Map.Invocation.Histogram"] = "1";
+    updateProps(clientProps, serverProps, update.get(), props, "Invocation");
+    metrics->op();
+    text = exporter->getOpenMetrics();
+    test(text.find("# TYPE ice_invocation_lifetime_seconds histogram\n") != string::npos);
+    test(text.find("ice_invocation_lifetime_seconds_bucket{view=\"View\",id=\"op\",le=\"+Inf\"} 1\n") != string::npos);
+    test(text.find("ice_invocation_lifetime_seconds_count{view=\"View\",id=\"op\"} 1\n") != string::npos);
+    props["IceMX.Metrics.View.Map.Invocation.Histogram"] = "";
+
+    //
+    // A view with a lifetime histogram and a view without: the samples
+    // of the second view are exported with a family suffixed by their type.
+    //
+    props["IceMX.Metrics.View2.Map.Invocation.GroupBy"] = "operation";
+    props["IceMX.Metrics.View2.Map.Invocation.Histogram"] = "1";
+    updateProps(clientProps, serverProps, update.get(), props, "Invocation");
+    metrics->op();
+    text = exporter->getOpenMetrics();
+    test(text.find("# TYPE ice_invocation_lifetime_seconds counter\n") != string::npos);
+    test(text.find("# TYPE ice_invocation_lifetime_seconds ") == text.rfind("# TYPE ice_invocation_lifetime_seconds "));
+    test(text.find("ice_invocation_lifetime_seconds_total{view=\"View\",id=\"op\"} ") != string::npos);
+    test(text.find("# TYPE ice_invocation_lifetime_seconds_histogram histogram\n") != string::npos);
+    test(text.find("ice_invocation_lifetime_seconds_histogram_count{view=\"View2\",id=\"op\"} 1\n") !=
+         string::npos);
+    test(text.find("ice_invocation_total{view=\"View2\",id=\"op\"} 1\n") != string::npos);
+    props.erase("IceMX.Metrics.View2.Map.Invocation.GroupBy");
+    props.erase("IceMX.Metrics.View2.Map.Invocation.Histogram");
+    updateProps(clientProps, serverProps, update.get(), props, "Invocation");
+
+    cout << "ok" << endl;
+
     cout << "testing metrics view enable/disable..." << flush;
 
     Ice::StringSeq disabledViews;
@@ -1734,6 +1734,33 @@ twoways(const Ice::CommunicatorPtr& communicator, const Test::MyClassPrxPtr& p)
             r = p2->opContext(ctx);
             test(r == ctx);
         }
+        {
+            //
+            // Repeated invocations re-use the request header cached by
+            // the proxy, make sure a proxy with a different context or
+            // facet doesn't share it.
+            //
+            Ice::Context ctx2;
+            ctx2["one"] = "UN";
+            Test::MyClassPrxPtr p2 = ICE_UNCHECKED_CAST(Test::MyClassPrx, p->ice_context(ctx2));
+            for(int i = 0; i < 3; ++i)
+            {
+                test(p2->opContext() == ctx2);
+                test(p2->opContext(ctx) == ctx);
+                test(p->opContext() != ctx2);
+                test(ICE_UNCHECKED_CAST(Test::MyClassPrx, p2->ice_context(ctx))->opContext() == ctx);
+            }
+
+            try
+            {
+                ICE_UNCHECKED_CAST(Test::MyClassPrx, p2->ice_facet("missing"))->opContext();
+                test(false);
+            }
+            catch(const Ice::FacetNotExistException&)
+            {
+            }
+            test(p2->opContext() == ctx2);
+        }
 
 #ifndef ICE_OS_WINRT
         if(p->ice_getConnection() && communicator->getProperties()->getProperty("Ice.Default.Protocol") != "bt")
@@ -1742,8 +1769,8 @@ twoways(const Ice::CommunicatorPtr& communicator, const Test::MyClassPrxPtr& p)
             // Test implicit context propagation
             //
 
-            string impls[] = {"Shared", "PerThread"};
-            for(int i = 0; i < 2; i++)
+            string impls[] = {"Shared", "PerThread", "Snapshot"};
+            for(int i = 0; i < 3; i++)
             {
                 Ice::InitializationData initData;
                 initData.properties = communicator->getProperties()->clone();
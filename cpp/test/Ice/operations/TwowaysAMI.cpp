@@ -2463,8 +2463,8 @@ twowaysAMI(const Ice::CommunicatorPtr& communicator, const Test::MyClassPrxPtr&
             // Test implicit context propagation
             //
 
-            string impls[] = {"Shared", "PerThread"};
-            for(int i = 0; i < 2; i++)
+            string impls[] = {"Shared", "PerThread", "Snapshot"};
+            for(int i = 0; i < 3; i++)
             {
                 Ice::InitializationData initData;
                 initData.properties = communicator->getProperties()->clone();
@@ -353,6 +353,9 @@ allTests(const Ice::CommunicatorPtr& communicator)
     prop->setProperty(property, "Ordered");
     b1 = communicator->propertyToProxy(propertyPrefix);
     test(b1->ice_getEndpointSelection() == Ice::Ordered);
+    prop->setProperty(property, "LatencyAware");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(b1->ice_getEndpointSelection() == Ice::LatencyAware);
     prop->setProperty(property, "");
 
     property = propertyPrefix + ".CollocationOptimized";
@@ -377,6 +380,21 @@ allTests(const Ice::CommunicatorPtr& communicator)
     prop->setProperty(propertyPrefix + ".Context.c1", "");
     prop->setProperty(propertyPrefix + ".Context.c2", "");
 
+    property = propertyPrefix + ".HedgeDelay";
+    test(communicator->proxyToProperty(b1, "Test").count("Test.HedgeDelay") == 0);
+    prop->setProperty(property, "-1");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(communicator->proxyToProperty(b1, "Test")["Test.HedgeDelay"] == "-1");
+    prop->setProperty(property, "50");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(communicator->proxyToProperty(b1, "Test")["Test.HedgeDelay"] == "50");
+    prop->setProperty(property, "");
+#ifdef ICE_CPP11_MAPPING
+    test(Ice::targetNotEqualTo(b1, communicator->propertyToProxy(propertyPrefix)));
+#else
+    test(b1 != communicator->propertyToProxy(propertyPrefix));
+#endif
+
     cout << "ok" << endl;
 
     cout << "testing proxyToProperty... " << flush;
@@ -339,5 +339,56 @@ allTests(const Ice::CommunicatorPtr& communicator, const Ice::CommunicatorPtr& c
     }
     cout << "ok" << endl;
 
+    if(retry1->ice_getConnection())
+    {
+        cout << "testing hedged invocations... " << flush;
+        testInvocationCount(-1);
+        testFailureCount(-1);
+        testRetryCount(-1);
+
+        //
+        // The hedged request sent after 100ms replies before the slow
+        // request, the even calls are the hedged requests.
+        //
+        Ice::PropertiesPtr properties = communicator->getProperties();
+        properties->setProperty("Hedged", retry1->ice_toString());
+        properties->setProperty("Hedged.HedgeDelay", "100");
+        RetryPrxPtr hedged = ICE_UNCHECKED_CAST(RetryPrx, communicator->propertyToProxy("Hedged"));
+        test(hedged->opSlow(1000) % 2 == 0);
+        testInvocationCount(1);
+        testFailureCount(0);
+        testRetryCount(0);
+#ifdef ICE_CPP11_MAPPING
+        test(hedged->opSlowAsync(1000).get() % 2 == 0);
+#else
+        test(hedged->end_opSlow(hedged->begin_opSlow(1000)) % 2 == 0);
+#endif
+        testInvocationCount(1);
+        testFailureCount(0);
+        testRetryCount(0);
+
+        //
+        // With the adaptive hedge delay, the requests are hedged once
+        // they take longer than the round-trip times usually measured
+        // with the endpoint.
+        //
+        properties->setProperty("Hedged.HedgeDelay", "-1");
+        hedged = ICE_UNCHECKED_CAST(RetryPrx, communicator->propertyToProxy("Hedged"));
+        test(hedged->opSlow(0) > 0);
+        test(hedged->opSlow(0) > 0);
+        testInvocationCount(2);
+        testFailureCount(0);
+        testRetryCount(0);
+
+        //
+        // Non-idempotent invocations aren't hedged.
+        //
+        hedged->op(false);
+        testInvocationCount(1);
+        properties->setProperty("Hedged", "");
+        properties->setProperty("Hedged.HedgeDelay", "");
+        cout << "ok" << endl;
+    }
+
     return retry1;
 }
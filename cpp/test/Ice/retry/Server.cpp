@@ -40,6 +40,11 @@ main(int argc, char* argv[])
         initData.properties = Ice::createProperties(argc, argv);
         initData.properties->setProperty("Ice.Warn.Dispatch", "0");
         initData.properties->setProperty("Ice.PrintStackTraces", "0");
+
+        //
+        // Dispatch the hedged requests while the original requests sleep.
+        //
+        initData.properties->setProperty("Ice.ThreadPool.Server.Size", "4");
         Ice::CommunicatorHolder ich = Ice::initialize(argc, argv, initData);
         status = run(argc, argv, ich.communicator());
     }
@@ -11,7 +11,7 @@
 #include <TestI.h>
 #include <SystemFailure.h>
 
-RetryI::RetryI() : _counter(0)
+RetryI::RetryI() : _counter(0), _slowCounter(0)
 {
 }
 
@@ -62,6 +62,25 @@ RetryI::opSystemException(const Ice::Current&)
     throw SystemFailure(__FILE__, __LINE__);
 }
 
+int
+RetryI::opSlow(int delay, const Ice::Current&)
+{
+    //
+    // Every other call is slow, the hedged request sent for a slow
+    // call replies first.
+    //
+    int counter;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        counter = ++_slowCounter;
+    }
+    if(counter % 2 == 1)
+    {
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(delay));
+    }
+    return counter;
+}
+
 void
 RetryI::shutdown(const Ice::Current& current)
 {
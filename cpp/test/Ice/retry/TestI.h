@@ -11,6 +11,7 @@
 #define TEST_I_H
 
 #include <Test.h>
+#include <IceUtil/Mutex.h>
 
 class RetryI : public Test::Retry
 {
@@ -22,11 +23,15 @@ public:
     virtual int opIdempotent(int, const Ice::Current&);
     virtual void opNotIdempotent(const Ice::Current&);
     virtual void opSystemException(const Ice::Current&);
+    virtual int opSlow(int, const Ice::Current&);
     virtual void shutdown(const Ice::Current&);
 
 private:
     
     int _counter;
+
+    IceUtil::Mutex _mutex;
+    int _slowCounter;
 };
 
 #endif
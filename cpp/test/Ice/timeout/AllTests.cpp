@@ -80,6 +80,52 @@ public:
 };
 typedef IceUtil::Handle<Callback> CallbackPtr;
 
+//
+// Forwards the invocations to the target, the forwarded invocations
+// inherit the deadline of the dispatch.
+//
+class RelayI : public Timeout
+{
+public:
+
+    RelayI(const TimeoutPrxPtr& target) : _target(target)
+    {
+    }
+
+    virtual void op(const Ice::Current&)
+    {
+        _target->op();
+    }
+
+    virtual void sendData(ICE_IN(ByteSeq) seq, const Ice::Current&)
+    {
+        _target->sendData(seq);
+    }
+
+    virtual void sleep(Ice::Int to, const Ice::Current&)
+    {
+        _target->sleep(to);
+    }
+
+    virtual void holdAdapter(Ice::Int to, const Ice::Current&)
+    {
+        _target->holdAdapter(to);
+    }
+
+    virtual Ice::Int getRemainingTime(const Ice::Current&)
+    {
+        return _target->getRemainingTime();
+    }
+
+    virtual void shutdown(const Ice::Current&)
+    {
+    }
+
+private:
+
+    const TimeoutPrxPtr _target;
+};
+
 TimeoutPrxPtr
 allTests(const Ice::CommunicatorPtr& communicator)
 {
@@ -502,5 +548,344 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing deadline propagation... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.PropagateDeadlines", "1");
+        Ice::CommunicatorPtr comm = Ice::initialize(initData);
+        TimeoutPrxPtr to = ICE_UNCHECKED_CAST(TimeoutPrx, comm->stringToProxy(sref));
+
+        //
+        // The deadline is only sent by the communicators which
+        // propagate deadlines, for invocations with a timeout.
+        //
+        test(to->getRemainingTime() == -1);
+        test(timeout->ice_invocationTimeout(1000)->getRemainingTime() == -1);
+        Ice::Int remaining = to->ice_invocationTimeout(1000)->getRemainingTime();
+        test(remaining > 0 && remaining <= 1000);
+
+        //
+        // The invocations made from a dispatch inherit its deadline.
+        //
+        Ice::ObjectAdapterPtr adapter = comm->createObjectAdapterWithEndpoints("Relay", "default");
+        TimeoutPrxPtr relay = ICE_UNCHECKED_CAST(TimeoutPrx, adapter->addWithUUID(ICE_MAKE_SHARED(RelayI, to)));
+        adapter->activate();
+        test(relay->getRemainingTime() == -1);
+        remaining = relay->ice_invocationTimeout(1000)->getRemainingTime();
+        test(remaining > 0 && remaining <= 1000);
+
+        //
+        // The server doesn't dispatch the requests whose deadline
+        // expired while they were queued: once the server thread pool
+        // is no longer busy, the expired sleep request is skipped.
+        //
+        IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+#ifdef ICE_CPP11_MAPPING
+        auto f = timeout->sleepAsync(500);
+#else
+        Ice::AsyncResultPtr r = timeout->begin_sleep(500);
+#endif
+        try
+        {
+            to->ice_invocationTimeout(100)->sleep(1000);
+            test(false);
+        }
+        catch(const Ice::InvocationTimeoutException&)
+        {
+        }
+#ifdef ICE_CPP11_MAPPING
+        f.get();
+#else
+        timeout->end_sleep(r);
+#endif
+        timeout->op();
+        test(IceUtil::Time::now(IceUtil::Time::Monotonic) - now < IceUtil::Time::milliSeconds(1200));
+
+        comm->destroy();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing object adapter overload policies... " << flush;
+    {
+        //
+        // The adapter dispatches one request at a time and queues one
+        // request, the client waits for each request to be read by the
+        // adapter before sending the next one.
+        //
+        Ice::PropertiesPtr properties = communicator->getProperties();
+        properties->setProperty("Overload.ThreadPool.Size", "4");
+        properties->setProperty("Overload.MaxDispatches", "1");
+        properties->setProperty("Overload.MaxQueuedRequests", "1");
+        const IceUtil::Time delay = IceUtil::Time::milliSeconds(100);
+
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        Ice::CommunicatorPtr comm = Ice::initialize(initData);
+
+        //
+        // Requests are rejected once the queue is full.
+        //
+        properties->setProperty("Overload.OverloadPolicy", "Reject");
+        {
+            Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapterWithEndpoints("Overload", "default");
+            Ice::ObjectPrxPtr obj = adapter->addWithUUID(ICE_MAKE_SHARED(TimeoutI));
+            adapter->activate();
+            TimeoutPrxPtr to = ICE_UNCHECKED_CAST(TimeoutPrx, comm->stringToProxy(obj->ice_toString()));
+            to->ice_ping();
+
+#ifdef ICE_CPP11_MAPPING
+            auto f1 = to->sleepAsync(500);
+            IceUtil::ThreadControl::sleep(delay);
+            auto f2 = to->opAsync();
+#else
+            Ice::AsyncResultPtr r1 = to->begin_sleep(500);
+            IceUtil::ThreadControl::sleep(delay);
+            Ice::AsyncResultPtr r2 = to->begin_op();
+#endif
+            IceUtil::ThreadControl::sleep(delay);
+            try
+            {
+                to->op();
+                test(false);
+            }
+            catch(const Ice::UnknownLocalException& ex)
+            {
+                test(ex.unknown.find("Ice::ObjectAdapterOverloadedException") != string::npos);
+            }
+#ifdef ICE_CPP11_MAPPING
+            f1.get();
+            f2.get();
+#else
+            to->end_sleep(r1);
+            to->end_op(r2);
+#endif
+            to->op();
+            adapter->destroy();
+        }
+
+        //
+        // The oldest queued request is shed and the newest is dispatched.
+        //
+        properties->setProperty("Overload.OverloadPolicy", "Shed");
+        {
+            Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapterWithEndpoints("Overload", "default");
+            Ice::ObjectPrxPtr obj = adapter->addWithUUID(ICE_MAKE_SHARED(TimeoutI));
+            adapter->activate();
+            TimeoutPrxPtr to = ICE_UNCHECKED_CAST(TimeoutPrx, comm->stringToProxy(obj->ice_toString()));
+            to->ice_ping();
+
+#ifdef ICE_CPP11_MAPPING
+            auto f1 = to->sleepAsync(500);
+            IceUtil::ThreadControl::sleep(delay);
+            auto f2 = to->opAsync();
+            IceUtil::ThreadControl::sleep(delay);
+            auto f3 = to->opAsync();
+            f1.get();
+            try
+            {
+                f2.get();
+                test(false);
+            }
+            catch(const Ice::UnknownLocalException& ex)
+            {
+                test(ex.unknown.find("Ice::ObjectAdapterOverloadedException") != string::npos);
+            }
+            f3.get();
+#else
+            Ice::AsyncResultPtr r1 = to->begin_sleep(500);
+            IceUtil::ThreadControl::sleep(delay);
+            Ice::AsyncResultPtr r2 = to->begin_op();
+            IceUtil::ThreadControl::sleep(delay);
+            Ice::AsyncResultPtr r3 = to->begin_op();
+            to->end_sleep(r1);
+            try
+            {
+                to->end_op(r2);
+                test(false);
+            }
+            catch(const Ice::UnknownLocalException& ex)
+            {
+                test(ex.unknown.find("Ice::ObjectAdapterOverloadedException") != string::npos);
+            }
+            to->end_op(r3);
+#endif
+            adapter->destroy();
+        }
+
+        //
+        // The adapter stops reading from the connection once the queue
+        // is full, no request is rejected.
+        //
+        properties->setProperty("Overload.OverloadPolicy", "Pause");
+        {
+            Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapterWithEndpoints("Overload", "default");
+            Ice::ObjectPrxPtr obj = adapter->addWithUUID(ICE_MAKE_SHARED(TimeoutI));
+            adapter->activate();
+            TimeoutPrxPtr to = ICE_UNCHECKED_CAST(TimeoutPrx, comm->stringToProxy(obj->ice_toString()));
+            to->ice_ping();
+
+#ifdef ICE_CPP11_MAPPING
+            auto f1 = to->sleepAsync(500);
+            IceUtil::ThreadControl::sleep(delay);
+            auto f2 = to->opAsync();
+            IceUtil::ThreadControl::sleep(delay);
+            auto f3 = to->opAsync();
+            IceUtil::ThreadControl::sleep(delay);
+            to->op();
+            f1.get();
+            f2.get();
+            f3.get();
+#else
+            Ice::AsyncResultPtr r1 = to->begin_sleep(500);
+            IceUtil::ThreadControl::sleep(delay);
+            Ice::AsyncResultPtr r2 = to->begin_op();
+            IceUtil::ThreadControl::sleep(delay);
+            Ice::AsyncResultPtr r3 = to->begin_op();
+            IceUtil::ThreadControl::sleep(delay);
+            to->op();
+            to->end_sleep(r1);
+            to->end_op(r2);
+            to->end_op(r3);
+#endif
+            adapter->destroy();
+        }
+
+        comm->destroy();
+
+        properties->setProperty("Overload.ThreadPool.Size", "");
+        properties->setProperty("Overload.MaxDispatches", "");
+        properties->setProperty("Overload.MaxQueuedRequests", "");
+        properties->setProperty("Overload.OverloadPolicy", "");
+    }
+    cout << "ok" << endl;
+
+    cout << "testing priority dispatches... " << flush;
+    {
+        //
+        // The adapter dispatches one request at a time, queues one
+        // request and reserves one dispatch for the priority requests.
+        //
+        Ice::PropertiesPtr properties = communicator->getProperties();
+        properties->setProperty("Priority.ThreadPool.Size", "4");
+        properties->setProperty("Priority.MaxDispatches", "1");
+        properties->setProperty("Priority.MaxQueuedRequests", "1");
+        properties->setProperty("Priority.PriorityDispatches", "1");
+        properties->setProperty("Priority.PriorityOperations", "ice_ping ice_id");
+        properties->setProperty("Priority.PriorityFacets", "priority");
+        const IceUtil::Time delay = IceUtil::Time::milliSeconds(100);
+
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        Ice::CommunicatorPtr comm = Ice::initialize(initData);
+
+        Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapterWithEndpoints("Priority", "default");
+        Ice::ObjectPrxPtr obj = adapter->addWithUUID(ICE_MAKE_SHARED(TimeoutI));
+        adapter->addFacet(ICE_MAKE_SHARED(TimeoutI), obj->ice_getIdentity(), "priority");
+        adapter->activate();
+        TimeoutPrxPtr to = ICE_UNCHECKED_CAST(TimeoutPrx, comm->stringToProxy(obj->ice_toString()));
+        TimeoutPrxPtr priority = ICE_UNCHECKED_CAST(TimeoutPrx, to->ice_facet("priority"));
+        to->ice_ping();
+
+#ifdef ICE_CPP11_MAPPING
+        auto f1 = to->sleepAsync(1000);
+        IceUtil::ThreadControl::sleep(delay);
+        auto f2 = to->opAsync();
+        IceUtil::ThreadControl::sleep(delay);
+#else
+        Ice::AsyncResultPtr r1 = to->begin_sleep(1000);
+        IceUtil::ThreadControl::sleep(delay);
+        Ice::AsyncResultPtr r2 = to->begin_op();
+        IceUtil::ThreadControl::sleep(delay);
+#endif
+
+        //
+        // The priority requests are dispatched with the reserved
+        // dispatch while the other requests are rejected. A request
+        // context doesn't make a request a priority request.
+        //
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        to->ice_ping();
+        to->ice_id();
+        priority->op();
+        test(IceUtil::Time::now(IceUtil::Time::Monotonic) - start < IceUtil::Time::milliSeconds(500));
+        try
+        {
+            to->op();
+            test(false);
+        }
+        catch(const Ice::UnknownLocalException& ex)
+        {
+            test(ex.unknown.find("Ice::ObjectAdapterOverloadedException") != string::npos);
+        }
+        try
+        {
+            Ice::Context ctx;
+            ctx["_priority"] = "1";
+            to->op(ctx);
+            test(false);
+        }
+        catch(const Ice::UnknownLocalException& ex)
+        {
+            test(ex.unknown.find("Ice::ObjectAdapterOverloadedException") != string::npos);
+        }
+
+        //
+        // Priority requests are queued while the reserved dispatch is
+        // used and they are dispatched before the other queued requests.
+        // Their queue is limited like the queue of the other requests.
+        //
+#ifdef ICE_CPP11_MAPPING
+        auto f3 = priority->sleepAsync(300);
+        IceUtil::ThreadControl::sleep(delay);
+        auto f4 = to->ice_pingAsync();
+        IceUtil::ThreadControl::sleep(delay);
+        try
+        {
+            to->ice_id();
+            test(false);
+        }
+        catch(const Ice::UnknownLocalException& ex)
+        {
+            test(ex.unknown.find("Ice::ObjectAdapterOverloadedException") != string::npos);
+        }
+        f4.get();
+        test(f2.wait_for(chrono::seconds(0)) != future_status::ready);
+        f1.get();
+        f2.get();
+        f3.get();
+#else
+        Ice::AsyncResultPtr r3 = priority->begin_sleep(300);
+        IceUtil::ThreadControl::sleep(delay);
+        Ice::AsyncResultPtr r4 = to->begin_ice_ping();
+        IceUtil::ThreadControl::sleep(delay);
+        try
+        {
+            to->ice_id();
+            test(false);
+        }
+        catch(const Ice::UnknownLocalException& ex)
+        {
+            test(ex.unknown.find("Ice::ObjectAdapterOverloadedException") != string::npos);
+        }
+        to->end_ice_ping(r4);
+        test(!r2->isCompleted());
+        to->end_sleep(r1);
+        to->end_op(r2);
+        priority->end_sleep(r3);
+#endif
+
+        adapter->destroy();
+        comm->destroy();
+
+        properties->setProperty("Priority.ThreadPool.Size", "");
+        properties->setProperty("Priority.MaxDispatches", "");
+        properties->setProperty("Priority.MaxQueuedRequests", "");
+        properties->setProperty("Priority.PriorityDispatches", "");
+        properties->setProperty("Priority.PriorityOperations", "");
+        properties->setProperty("Priority.PriorityFacets", "");
+    }
+    cout << "ok" << endl;
+
     return timeout;
 }
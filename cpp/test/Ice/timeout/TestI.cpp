@@ -10,6 +10,7 @@
 #include <TestI.h>
 #include <Ice/Ice.h>
 #include <IceUtil/Thread.h>
+#include <IceUtil/InputUtil.h>
 
 using namespace std;
 using namespace Ice;
@@ -61,6 +62,19 @@ TimeoutI::holdAdapter(Ice::Int to, const Ice::Current& current)
     threadControl.detach();
 }
 
+Ice::Int
+TimeoutI::getRemainingTime(const Ice::Current& current)
+{
+    Ice::Context::const_iterator p = current.ctx.find("_deadline");
+    if(p == current.ctx.end())
+    {
+        return -1;
+    }
+    IceUtil::Int64 deadline;
+    test(IceUtilInternal::stringToInt64(p->second, deadline));
+    return static_cast<Ice::Int>(deadline - IceUtil::Time::now().toMilliSeconds());
+}
+
 void
 TimeoutI::shutdown(const Ice::Current& current)
 {
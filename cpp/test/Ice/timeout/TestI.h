@@ -21,6 +21,7 @@ public:
     virtual void sendData(ICE_IN(Test::ByteSeq), const Ice::Current&);
     virtual void sleep(Ice::Int, const Ice::Current&);
     virtual void holdAdapter(Ice::Int, const Ice::Current&);
+    virtual Ice::Int getRemainingTime(const Ice::Current&);
     virtual void shutdown(const Ice::Current&);
 };
 
@@ -0,0 +1,160 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <IceUtil/Options.h>
+#include <IceUtil/Thread.h>
+#include <IceUtil/Time.h>
+#include <IceStorm/IceStorm.h>
+#include <Event.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceStorm;
+using namespace Test;
+
+int
+run(int argc, char* argv[], const CommunicatorPtr& communicator)
+{
+    IceUtilInternal::Options opts;
+    opts.addOpt("", "events", IceUtilInternal::Options::NeedArg);
+    opts.addOpt("", "payload", IceUtilInternal::Options::NeedArg);
+    opts.addOpt("", "rate", IceUtilInternal::Options::NeedArg);
+    opts.addOpt("", "oneway");
+
+    try
+    {
+        opts.parse(argc, (const char**)argv);
+    }
+    catch(const IceUtilInternal::BadOptException& e)
+    {
+        cerr << argv[0] << ": " << e.reason << endl;
+        return EXIT_FAILURE;
+    }
+
+    int events = opts.isSet("events") ? atoi(opts.optArg("events").c_str()) : 10000;
+    if(events <= 0)
+    {
+        cerr << argv[0] << ": events must be > 0." << endl;
+        return EXIT_FAILURE;
+    }
+    int payload = opts.isSet("payload") ? atoi(opts.optArg("payload").c_str()) : 100;
+    if(payload < 0)
+    {
+        cerr << argv[0] << ": payload must be >= 0." << endl;
+        return EXIT_FAILURE;
+    }
+    int rate = opts.isSet("rate") ? atoi(opts.optArg("rate").c_str()) : 0;
+    bool oneway = opts.isSet("oneway");
+
+    PropertiesPtr properties = communicator->getProperties();
+    const char* managerProxyProperty = "IceStormAdmin.TopicManager.Default";
+    string managerProxy = properties->getProperty(managerProxyProperty);
+    if(managerProxy.empty())
+    {
+        cerr << argv[0] << ": property `" << managerProxyProperty << "' is not set" << endl;
+        return EXIT_FAILURE;
+    }
+
+    IceStorm::TopicManagerPrx manager = IceStorm::TopicManagerPrx::checkedCast(
+        communicator->stringToProxy(managerProxy));
+    if(!manager)
+    {
+        cerr << argv[0] << ": `" << managerProxy << "' is not running" << endl;
+        return EXIT_FAILURE;
+    }
+
+    TopicPrx topic;
+    try
+    {
+        topic = manager->retrieve("bench");
+    }
+    catch(const NoSuchTopic& e)
+    {
+        cerr << argv[0] << ": NoSuchTopic: " << e.name << endl;
+        return EXIT_FAILURE;
+    }
+
+    EventPrx twowayProxy = EventPrx::uncheckedCast(topic->getPublisher()->ice_twoway());
+    EventPrx proxy = oneway ? EventPrx::uncheckedCast(twowayProxy->ice_oneway()) : twowayProxy;
+
+    //
+    // Establish the connection before sending the events, it shouldn't
+    // be accounted in the latency of the first event.
+    //
+    twowayProxy->ice_ping();
+
+    Ice::ByteSeq data(payload);
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int i = 0; i < events; ++i)
+    {
+        if(rate > 0)
+        {
+            //
+            // Pace the events to send them at the given rate rather than
+            // as fast as possible.
+            //
+            IceUtil::Time next = start + IceUtil::Time::microSeconds(static_cast<IceUtil::Int64>(i) * 1000000 / rate);
+            IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            if(next > now)
+            {
+                IceUtil::ThreadControl::sleep(next - now);
+            }
+        }
+        proxy->pub(IceUtil::Time::now(IceUtil::Time::Monotonic).toMicroSeconds(), data);
+    }
+
+    if(oneway)
+    {
+        //
+        // Before we exit, we ping the proxy as twoway, to make sure
+        // that all oneways are delivered.
+        //
+        twowayProxy->ice_ping();
+    }
+
+    IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+    IceUtil::Int64 ms = elapsed.toMilliSeconds() > 0 ? elapsed.toMilliSeconds() : 1;
+    cout << static_cast<IceUtil::Int64>(events) * 1000 / ms << " events/s published" << endl;
+
+    return EXIT_SUCCESS;
+}
+
+int
+main(int argc, char* argv[])
+{
+    int status;
+    CommunicatorPtr communicator;
+
+    try
+    {
+        communicator = initialize(argc, argv);
+        status = run(argc, argv, communicator);
+    }
+    catch(const Exception& ex)
+    {
+        cerr << ex << endl;
+        status = EXIT_FAILURE;
+    }
+
+    if(communicator)
+    {
+        try
+        {
+            communicator->destroy();
+        }
+        catch(const Exception& ex)
+        {
+            cerr << ex << endl;
+            status = EXIT_FAILURE;
+        }
+    }
+
+    return status;
+}
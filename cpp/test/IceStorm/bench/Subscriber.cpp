@@ -0,0 +1,282 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <IceStorm/IceStorm.h>
+#include <IceUtil/Options.h>
+#include <IceUtil/Time.h>
+#include <IceUtil/Mutex.h>
+#include <Event.h>
+#include <algorithm>
+
+using namespace std;
+using namespace Ice;
+using namespace IceStorm;
+using namespace Test;
+
+//
+// The reception times shared by the subscribers: the time of the first
+// event received by a subscriber and of the last event received by all
+// the subscribers.
+//
+class Results : public IceUtil::Shared, public IceUtil::Mutex
+{
+public:
+
+    Results(const CommunicatorPtr& communicator, int subscribers) :
+        _communicator(communicator), _remaining(subscribers)
+    {
+    }
+
+    void
+    received()
+    {
+        Lock sync(*this);
+        if(_start == IceUtil::Time())
+        {
+            _start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        }
+    }
+
+    void
+    completed()
+    {
+        Lock sync(*this);
+        if(--_remaining == 0)
+        {
+            _stop = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            _communicator->shutdown();
+        }
+    }
+
+    IceUtil::Time
+    elapsed() const
+    {
+        Lock sync(*this);
+        return _stop - _start;
+    }
+
+private:
+
+    const CommunicatorPtr _communicator;
+    int _remaining;
+    IceUtil::Time _start;
+    IceUtil::Time _stop;
+};
+typedef IceUtil::Handle<Results> ResultsPtr;
+
+class EventI : public Event, public IceUtil::Mutex
+{
+public:
+
+    EventI(const ResultsPtr& results, int total) :
+        _results(results), _total(total)
+    {
+        _latencies.reserve(total);
+    }
+
+    virtual void
+    pub(Ice::Long time, const Ice::ByteSeq&, const Ice::Current&)
+    {
+        IceUtil::Int64 now = IceUtil::Time::now(IceUtil::Time::Monotonic).toMicroSeconds();
+
+        Lock sync(*this);
+        if(_latencies.empty())
+        {
+            _results->received();
+        }
+        _latencies.push_back(now - time);
+        if(static_cast<int>(_latencies.size()) == _total)
+        {
+            _results->completed();
+        }
+    }
+
+    const vector<IceUtil::Int64>&
+    latencies() const
+    {
+        return _latencies;
+    }
+
+private:
+
+    const ResultsPtr _results;
+    const int _total;
+    vector<IceUtil::Int64> _latencies;
+};
+typedef IceUtil::Handle<EventI> EventIPtr;
+
+namespace
+{
+
+IceUtil::Int64
+percentile(vector<IceUtil::Int64>& values, int n)
+{
+    vector<IceUtil::Int64>::iterator p = values.begin() + (values.size() - 1) * n / 100;
+    nth_element(values.begin(), p, values.end());
+    return *p;
+}
+
+}
+
+int
+run(int argc, char* argv[], const CommunicatorPtr& communicator)
+{
+    IceUtilInternal::Options opts;
+    opts.addOpt("", "events", IceUtilInternal::Options::NeedArg);
+    opts.addOpt("", "subscribers", IceUtilInternal::Options::NeedArg);
+    opts.addOpt("", "reliability", IceUtilInternal::Options::NeedArg);
+
+    try
+    {
+        opts.parse(argc, (const char**)argv);
+    }
+    catch(const IceUtilInternal::BadOptException& e)
+    {
+        cerr << argv[0] << ": " << e.reason << endl;
+        return EXIT_FAILURE;
+    }
+
+    int events = opts.isSet("events") ? atoi(opts.optArg("events").c_str()) : 10000;
+    if(events <= 0)
+    {
+        cerr << argv[0] << ": events must be > 0." << endl;
+        return EXIT_FAILURE;
+    }
+    int subscribers = opts.isSet("subscribers") ? atoi(opts.optArg("subscribers").c_str()) : 1;
+    if(subscribers <= 0)
+    {
+        cerr << argv[0] << ": subscribers must be > 0." << endl;
+        return EXIT_FAILURE;
+    }
+    string reliability = opts.isSet("reliability") ? opts.optArg("reliability") : "oneway";
+    if(reliability != "oneway" && reliability != "twoway" && reliability != "ordered" &&
+       reliability != "batched" && reliability != "batch")
+    {
+        cerr << argv[0] << ": unknown reliability `" << reliability << "'" << endl;
+        return EXIT_FAILURE;
+    }
+
+    PropertiesPtr properties = communicator->getProperties();
+    const char* managerProxyProperty = "IceStormAdmin.TopicManager.Default";
+    string managerProxy = properties->getProperty(managerProxyProperty);
+    if(managerProxy.empty())
+    {
+        cerr << argv[0] << ": property `" << managerProxyProperty << "' is not set" << endl;
+        return EXIT_FAILURE;
+    }
+
+    IceStorm::TopicManagerPrx manager = IceStorm::TopicManagerPrx::checkedCast(
+        communicator->stringToProxy(managerProxy));
+    if(!manager)
+    {
+        cerr << argv[0] << ": `" << managerProxy << "' is not running" << endl;
+        return EXIT_FAILURE;
+    }
+
+    TopicPrx topic;
+    try
+    {
+        topic = manager->retrieve("bench");
+    }
+    catch(const NoSuchTopic& e)
+    {
+        cerr << argv[0] << ": NoSuchTopic: " << e.name << endl;
+        return EXIT_FAILURE;
+    }
+
+    //
+    // All the subscribers share the same adapter, like the throughput
+    // test of the stress test.
+    //
+    ResultsPtr results = new Results(communicator, subscribers);
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapterWithEndpoints("SubscriberAdapter", "default");
+    vector<EventIPtr> servants;
+    vector<ObjectPrx> objs;
+    for(int i = 0; i < subscribers; ++i)
+    {
+        EventIPtr servant = new EventI(results, events);
+        ObjectPrx obj = adapter->addWithUUID(servant);
+
+        IceStorm::QoS qos;
+        if(reliability == "ordered" || reliability == "batched")
+        {
+            qos["reliability"] = reliability;
+        }
+        else if(reliability == "batch")
+        {
+            obj = obj->ice_batchOneway();
+        }
+        else if(reliability == "oneway")
+        {
+            obj = obj->ice_oneway();
+        }
+        topic->subscribeAndGetPublisher(qos, obj);
+
+        servants.push_back(servant);
+        objs.push_back(obj);
+    }
+    adapter->activate();
+
+    communicator->waitForShutdown();
+
+    for(vector<ObjectPrx>::const_iterator p = objs.begin(); p != objs.end(); ++p)
+    {
+        topic->unsubscribe(*p);
+    }
+
+    vector<IceUtil::Int64> latencies;
+    latencies.reserve(static_cast<size_t>(events) * subscribers);
+    for(vector<EventIPtr>::const_iterator p = servants.begin(); p != servants.end(); ++p)
+    {
+        latencies.insert(latencies.end(), (*p)->latencies().begin(), (*p)->latencies().end());
+    }
+
+    IceUtil::Time elapsed = results->elapsed();
+    IceUtil::Int64 ms = elapsed.toMilliSeconds() > 0 ? elapsed.toMilliSeconds() : 1;
+    IceUtil::Int64 p50 = percentile(latencies, 50);
+    IceUtil::Int64 p99 = percentile(latencies, 99);
+    cout << static_cast<IceUtil::Int64>(events) * subscribers * 1000 / ms << " events/s, p50 " << p50 << " us, p99 "
+         << p99 << " us" << endl;
+
+    return EXIT_SUCCESS;
+}
+
+int
+main(int argc, char* argv[])
+{
+    int status;
+    CommunicatorPtr communicator;
+
+    try
+    {
+        communicator = initialize(argc, argv);
+        status = run(argc, argv, communicator);
+    }
+    catch(const Exception& ex)
+    {
+        cerr << ex << endl;
+        status = EXIT_FAILURE;
+    }
+
+    if(communicator)
+    {
+        try
+        {
+            communicator->destroy();
+        }
+        catch(const Exception& ex)
+        {
+            cerr << ex << endl;
+            status = EXIT_FAILURE;
+        }
+    }
+
+    return status;
+}
@@ -0,0 +1,196 @@
+#!/usr/bin/env python
+# **********************************************************************
+#
+# Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+#
+# This copy of Ice is licensed to you under the terms described in the
+# ICE_LICENSE file included in this distribution.
+#
+# **********************************************************************
+
+import os, sys, time, re, subprocess
+
+path = [ ".", "..", "../..", "../../..", "../../../.." ]
+head = os.path.dirname(sys.argv[0])
+if len(head) > 0:
+    path = [os.path.join(head, p) for p in path]
+path = [os.path.abspath(p) for p in path if os.path.exists(os.path.join(p, "scripts", "TestUtil.py")) ]
+if len(path) == 0:
+    raise RuntimeError("can't find toplevel directory!")
+sys.path.append(os.path.join(path[0], "scripts"))
+
+#
+# The benchmark options, each option but icestorm-options accepts a comma
+# separated list of values and the benchmark runs every combination. They are removed from
+# the command line before importing TestUtil which rejects unknown
+# options.
+#
+options = {
+    "type" : "single,replicated",
+    "publishers" : "1",
+    "subscribers" : "1,10",
+    "events" : "10000",
+    "payload" : "100",
+    "reliability" : "oneway,twoway",
+    "rate" : "0",
+    "icestorm-options" : "",
+}
+
+def usage():
+    print("usage: " + sys.argv[0] + """
+          --type=single|replicated       IceStorm deployment (default: single,replicated).
+          --publishers=<n>               Number of publisher processes (default: 1).
+          --subscribers=<n>              Number of subscribers (default: 1,10).
+          --events=<n>                   Number of events sent by each publisher (default: 10000).
+          --payload=<bytes>              Size of the event payload (default: 100).
+          --reliability=<mode>           Subscriber reliability: oneway, twoway, ordered, batched or batch
+                                         (default: oneway,twoway).
+          --rate=<n>                     Events per second sent by each publisher, 0 for as fast as possible
+                                         (default: 0).
+          --icestorm-options=<options>   Additional IceStorm properties.
+
+        The options but --icestorm-options accept a comma separated list of values, the benchmark runs
+        every combination. The other options are passed to TestUtil.
+        """)
+    sys.exit(2)
+
+args = []
+for arg in sys.argv[1:]:
+    m = re.match(r"--([a-z\-]+)=(.*)", arg)
+    if m and m.group(1) in options:
+        options[m.group(1)] = m.group(2)
+    elif arg in ["-h", "--help"]:
+        usage()
+    else:
+        args.append(arg)
+sys.argv[1:] = args
+
+import TestUtil, IceStormUtil
+
+def values(name, convert = str):
+    try:
+        return [convert(v) for v in options[name].split(",")]
+    except ValueError:
+        usage()
+
+types = values("type")
+for t in types:
+    if t not in ["single", "replicated"]:
+        usage()
+reliabilities = values("reliability")
+for r in reliabilities:
+    if r not in ["oneway", "twoway", "ordered", "batched", "batch"]:
+        usage()
+
+publisher = os.path.join(os.getcwd(), TestUtil.getTestExecutable("publisher"))
+subscriber = os.path.join(os.getcwd(), TestUtil.getTestExecutable("subscriber"))
+
+#
+# Returns the CPU time in seconds and the resident memory in kilobytes
+# of the given process, or None if it can't be sampled.
+#
+def sample(pid):
+    if os.path.exists("/proc/%d/stat" % pid):
+        with open("/proc/%d/stat" % pid) as f:
+            # The fields after the command name, which can contain spaces.
+            fields = f.read().rsplit(")", 1)[1].split()
+        cpu = float(int(fields[11]) + int(fields[12])) / os.sysconf("SC_CLK_TCK")
+        rss = 0
+        with open("/proc/%d/status" % pid) as f:
+            for line in f:
+                if line.startswith("VmRSS:"):
+                    rss = int(line.split()[1])
+        return (cpu, rss)
+
+    if TestUtil.isWin32():
+        return None
+
+    try:
+        p = subprocess.Popen(["ps", "-o", "rss=", "-o", "time=", "-p", str(pid)], stdout = subprocess.PIPE)
+        out = p.communicate()[0].decode("utf-8").split()
+        if len(out) != 2:
+            return None
+        # The time format is [[dd-]hh:]mm:ss[.ss]
+        days, sep, hms = out[1].rpartition("-")
+        cpu = 0.0
+        for v in hms.split(":"):
+            cpu = cpu * 60 + float(v)
+        cpu += int(days or 0) * 86400
+        return (cpu, int(out[0]))
+    except OSError:
+        return None
+
+#
+# The IceStorm processes: the IceBox server of a single IceStorm or the
+# IceBox servers of the replicas.
+#
+def pids(server):
+    if isinstance(server, IceStormUtil.Replicated):
+        return [p.p.pid for p in server.procs]
+    return [server.proc.p.pid]
+
+def sampleAll(server):
+    cpu = 0.0
+    rss = 0
+    for pid in pids(server):
+        s = sample(pid)
+        if not s:
+            return None
+        cpu += s[0]
+        rss += s[1]
+    return (cpu, rss)
+
+def runBench(server, publishers, subscribers, events, payload, reliability, rate):
+    subscriberProc = TestUtil.startServer(subscriber, ' --Ice.ServerIdleTime=0 --events %d --subscribers %d '
+                                          '--reliability %s %s' % (events * publishers, subscribers, reliability,
+                                                                   server.reference()), echo = False)
+
+    before = sampleAll(server)
+    start = time.time()
+
+    pubOpts = ' --events %d --payload %d --rate %d' % (events, payload, rate)
+    if reliability != "twoway":
+        pubOpts += ' --oneway'
+    publisherProcs = []
+    for i in range(0, publishers):
+        publisherProcs.append(TestUtil.startClient(publisher, server.reference() + pubOpts, echo = False))
+    for p in publisherProcs:
+        p.waitTestSuccess()
+
+    subscriberProc.expect("([0-9]+) events/s, p50 ([0-9]+) us, p99 ([0-9]+) us", timeout = 600)
+    result = subscriberProc.match.groups()
+    subscriberProc.waitTestSuccess()
+
+    elapsed = time.time() - start
+    after = sampleAll(server)
+    if before and after:
+        usage = ("%.0f" % ((after[0] - before[0]) * 100 / elapsed), "%.1f" % (after[1] / 1024.0))
+    else:
+        usage = ("n/a", "n/a")
+    return result + usage
+
+def runtest(type):
+    server = IceStormUtil.init(TestUtil.toplevel, os.getcwd(), "replicated" if type == "replicated" else "persistent",
+                               additional = options["icestorm-options"])
+    server.start(echo = False)
+    server.admin("create bench")
+
+    for publishers in values("publishers", int):
+        for subscribers in values("subscribers", int):
+            for events in values("events", int):
+                for payload in values("payload", int):
+                    for reliability in reliabilities:
+                        for rate in values("rate", int):
+                            result = runBench(server, publishers, subscribers, events, payload, reliability, rate)
+                            print("%-10s %4d %4d %8d %8d %-11s %6d %10s %8s %8s %5s %8s" %
+                                  ((type, publishers, subscribers, events, payload, reliability, rate) + result))
+                            sys.stdout.flush()
+
+    server.admin("destroy bench")
+    server.stop()
+
+print("%-10s %4s %4s %8s %8s %-11s %6s %10s %8s %8s %5s %8s" % ("type", "pubs", "subs", "events", "payload",
+                                                              "reliability", "rate", "events/s", "p50 us", "p99 us",
+                                                              "cpu %", "rss MB"))
+for type in types:
+    runtest(type)
@@ -92,5 +92,12 @@ runtest("transient")
 runtest("replicated", replicatedPublisher = False)
 runtest("replicated", replicatedPublisher = True)
 
+#
+# Test the links with lingering, compressed and pipelined forwards.
+#
+runtest("persistent", additional = " --IceStorm.Link.Linger=10 --IceStorm.Link.MaxBatchSize=512" +
+                                   " --IceStorm.Link.MaxOutstanding=4 --IceStorm.Link.Compress=1" +
+                                   " --IceStorm.Publish.ThreadPool.Serialize=1")
+
 if TestUtil.appverifier:
     TestUtil.appVerifierAfterTestEnd(targets, cwd = os.getcwd())
@@ -47,28 +47,34 @@ def runtest(opt, ref, subopt="", pubopt=""):
     publisherProc.waitTestSuccess()
     subscriberProc.waitTestSuccess()
 
-def runsub2(replica = -1, expect = None):
-    proc = TestUtil.startServer(subscriber2, icestorm.reference(replica) + ' --id foo', count=0, echo = False)
+def startsub2(id, replica = -1, unsub = False):
+    args = icestorm.reference(replica) + ' --id ' + id
+    if unsub:
+        args += ' --unsub'
+    return TestUtil.startServer(subscriber2, args, count=0, echo = False)
+
+def runsub2(replica = -1, expect = None, id = "foo"):
+    proc = startsub2(id, replica)
     if expect:
         proc.expect(expect)
         proc.wait()
     else:
         proc.waitTestSuccess()
 
-def rununsub2(replica = -1, expect = None):
+def rununsub2(replica = -1, expect = None, id = "foo"):
     if replica == -1:
-        proc = TestUtil.startServer(subscriber2, icestorm.reference(replica) + ' --id foo --unsub', count=0)
+        proc = TestUtil.startServer(subscriber2, icestorm.reference(replica) + ' --id ' + id + ' --unsub', count=0)
         proc.waitTestSuccess()
     # Else we first subscribe to this replica, then unsub. We
     # shouldn't get an AlreadySubscribedException.
-    proc = TestUtil.startServer(subscriber2, icestorm.reference(replica) + ' --id foo', count=0, echo = False)
+    proc = startsub2(id, replica)
     if expect:
         proc.expect(expect)
         proc.wait()
         return
     else:
         proc.waitTestSuccess()
-    proc = TestUtil.startServer(subscriber2, icestorm.reference(replica) + ' --id foo --unsub', count=0)
+    proc = TestUtil.startServer(subscriber2, icestorm.reference(replica) + ' --id ' + id + ' --unsub', count=0)
     proc.waitTestSuccess()
 
 icestorm = IceStormUtil.init(TestUtil.toplevel, os.getcwd(), "replicated", replicatedPublisher=True, additional =
@@ -247,6 +253,30 @@ icestorm.startReplica(0, echo=False)
 rununsub2(0)
 print("ok")
 
+sys.stdout.write("testing concurrent subscriptions and unsubscriptions across replicas... ")
+sys.stdout.flush()
+ids = ["foo%d" % i for i in range(0, 10)]
+
+# The concurrent changes are committed and replicated together.
+procs = [startsub2(id) for id in ids[:5]]
+for proc in procs:
+    proc.waitTestSuccess()
+
+procs = [startsub2(id) for id in ids[5:]] + [startsub2(id, unsub=True) for id in ids[:5]]
+for proc in procs:
+    proc.waitTestSuccess()
+
+for replica in range(0, 3):
+    for id in ids[5:]:
+        runsub2(replica, "IceStorm::AlreadySubscribed", id)
+    for id in ids[:5]:
+        rununsub2(replica, id=id)
+
+procs = [startsub2(id, unsub=True) for id in ids[5:]]
+for proc in procs:
+    proc.waitTestSuccess()
+print("ok")
+
 # All replicas are running
 
 sys.stdout.write("running twoway subscription test... ")
@@ -25,7 +25,8 @@ public:
         _communicator(communicator),
         _name(name),
         _count(0),
-        _last(0)
+        _last(0),
+        _expected(name == "filtered" ? 500 : 1000)
     {
     }
 
@@ -42,11 +43,17 @@ public:
         {
             cerr << endl << "expected twoway request";
         }
-        if(_name == "twoway ordered" && i != _last)
+        if((_name == "twoway ordered" || _name == "twoway batched") && i != _last)
         {
             cerr << endl << "received unordered event for `" << _name << "': " << i << " " << _last;
             test(false);
         }
+        if(_name == "filtered" && (i % 2 != 0 || current.ctx.find("parity") == current.ctx.end() ||
+                                   current.ctx.find("parity")->second != "even"))
+        {
+            cerr << endl << "received filtered event for `" << _name << "': " << i;
+            test(false);
+        }
         if((_name == "datagram" || _name == "batch datagram") && current.con->type() != "udp")
         {
             cerr << endl << "expected datagram to be received over udp";
@@ -54,7 +61,7 @@ public:
         }
         Lock sync(*this);
         ++_last;
-        if(++_count == 1000)
+        if(++_count == _expected)
         {
             notify();
         }
@@ -67,7 +74,7 @@ public:
         cout << "testing " << _name << " reliability... " << flush;
         bool datagram = _name == "datagram" || _name == "batch datagram";
         IceUtil::Time timeout = (datagram) ? IceUtil::Time::seconds(5) : IceUtil::Time::seconds(20);
-        while(_count < 1000)
+        while(_count < _expected)
         {
             if(!timedWait(timeout))
             {
@@ -98,6 +105,7 @@ private:
     const string _name;
     int _count;
     int _last;
+    const int _expected;
 };
 typedef IceUtil::Handle<SingleI> SingleIPtr;
 
@@ -165,6 +173,33 @@ run(int, char* argv[], const CommunicatorPtr& communicator)
         }
     }
 
+    //
+    // Test invalid filter QoS
+    //
+    {
+        IceStorm::QoS qos;
+        qos["filter.unknown"] = "value";
+        try
+        {
+            topic->subscribeAndGetPublisher(qos, adapter->addWithUUID(new SingleI(communicator, "bad filter")));
+            test(false);
+        }
+        catch(const IceStorm::BadQoS&)
+        {
+        }
+
+        qos.clear();
+        qos["filter.context.parity"] = "even,";
+        try
+        {
+            topic->subscribeAndGetPublisher(qos, adapter->addWithUUID(new SingleI(communicator, "bad filter")));
+            test(false);
+        }
+        catch(const IceStorm::BadQoS&)
+        {
+        }
+    }
+
     //
     // Create subscribers with different QoS.
     //
@@ -203,6 +238,27 @@ run(int, char* argv[], const CommunicatorPtr& communicator)
         subscriberIdentities.push_back(object->ice_getIdentity());
         topic->subscribeAndGetPublisher(qos, object);
     }
+    {
+        //
+        // The subscriber adapter dispatches the requests with a single
+        // thread, the batched events are dispatched in order.
+        //
+        subscribers.push_back(new SingleI(communicator, "twoway batched"));
+        IceStorm::QoS qos;
+        qos["reliability"] = "batched";
+        Ice::ObjectPrx object = adapter->addWithUUID(subscribers.back());
+        subscriberIdentities.push_back(object->ice_getIdentity());
+        topic->subscribeAndGetPublisher(qos, object);
+    }
+    {
+        subscribers.push_back(new SingleI(communicator, "filtered"));
+        IceStorm::QoS qos;
+        qos["filter.operation"] = "ev*";
+        qos["filter.context.parity"] = "even";
+        Ice::ObjectPrx object = adapter->addWithUUID(subscribers.back())->ice_oneway();
+        subscriberIdentities.push_back(object->ice_getIdentity());
+        topic->subscribeAndGetPublisher(qos, object);
+    }
     {
         // Use a separate adapter to ensure a separate connection is used for the subscriber
         // (otherwise, if multiple UDP subscribers use the same connection we might get high
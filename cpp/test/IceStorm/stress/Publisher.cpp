@@ -24,6 +24,7 @@ run(int argc, char* argv[], const CommunicatorPtr& communicator)
     opts.addOpt("", "events", IceUtilInternal::Options::NeedArg);
     opts.addOpt("", "oneway");
     opts.addOpt("", "maxQueueTest");
+    opts.addOpt("", "keys", IceUtilInternal::Options::NeedArg);
 
     try
     {
@@ -49,6 +50,7 @@ run(int argc, char* argv[], const CommunicatorPtr& communicator)
 
     bool oneway = opts.isSet("oneway");
     bool maxQueueTest = opts.isSet("maxQueueTest");
+    int keys = opts.isSet("keys") ? atoi(opts.optArg("keys").c_str()) : 0;
 
     PropertiesPtr properties = communicator->getProperties();
     const char* managerProxyProperty = "IceStormAdmin.TopicManager.Default";
@@ -97,7 +99,18 @@ run(int argc, char* argv[], const CommunicatorPtr& communicator)
             // Sleep one seconds to give some time to IceStorm to connect to the subscriber
             IceUtil::ThreadControl::sleep(IceUtil::Time::seconds(1));
         }
-        proxy->pub(i);
+        if(keys > 0)
+        {
+            Ice::Context ctx;
+            ostringstream os;
+            os << i % keys;
+            ctx["key"] = os.str();
+            proxy->pub(i, ctx);
+        }
+        else
+        {
+            proxy->pub(i);
+        }
     }
 
     if(oneway)
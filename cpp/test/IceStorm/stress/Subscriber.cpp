@@ -190,6 +190,83 @@ private:
 IceUtil::Mutex* ErraticEventI::_remainingMutex = 0;
 int ErraticEventI::_remaining = 0;
 
+class ThroughputEventI : public EventI
+{
+public:
+
+    ThroughputEventI(const CommunicatorPtr& communicator, int total, bool ordered) :
+        EventI(communicator, total), _ordered(ordered), _failed(false)
+    {
+        IceUtilInternal::MutexPtrLock<IceUtil::Mutex> sync(_remainingMutex);
+        ++_remaining;
+    }
+
+    virtual void
+    pub(int counter, const Ice::Current&)
+    {
+        Lock sync(*this);
+
+        if(_ordered && counter != _count && !_failed)
+        {
+            cerr << "failed! expected event: " << _count << " received event: " << counter << endl;
+            _failed = true;
+        }
+
+        if(_count == 0)
+        {
+            IceUtilInternal::MutexPtrLock<IceUtil::Mutex> sync(_remainingMutex);
+            if(_start == IceUtil::Time())
+            {
+                _start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            }
+        }
+
+        if(++_count == _total)
+        {
+            IceUtilInternal::MutexPtrLock<IceUtil::Mutex> sync(_remainingMutex);
+            --_remaining;
+            if(_remaining == 0)
+            {
+                _stop = IceUtil::Time::now(IceUtil::Time::Monotonic);
+                _communicator->shutdown();
+            }
+        }
+    }
+
+    virtual void
+    check(const Subscription&)
+    {
+        test(!_failed);
+    }
+
+    //
+    // The time between the first event received by a subscriber and
+    // the last event received by all the subscribers.
+    //
+    static IceUtil::Time
+    elapsed()
+    {
+        IceUtilInternal::MutexPtrLock<IceUtil::Mutex> sync(_remainingMutex);
+        return _stop - _start;
+    }
+
+    static IceUtil::Mutex* _remainingMutex;
+
+private:
+
+    const bool _ordered;
+    bool _failed;
+
+    static int _remaining;
+    static IceUtil::Time _start;
+    static IceUtil::Time _stop;
+};
+
+IceUtil::Mutex* ThroughputEventI::_remainingMutex = 0;
+int ThroughputEventI::_remaining = 0;
+IceUtil::Time ThroughputEventI::_start;
+IceUtil::Time ThroughputEventI::_stop;
+
 class MaxQueueEventI : public EventI
 {
 public:
@@ -248,6 +325,56 @@ private:
     int _expected;
 };
 
+class ConflateEventI : public EventI
+{
+public:
+
+    ConflateEventI(const CommunicatorPtr& communicator, int keys, int total) :
+        EventI(communicator, total), _keys(keys), _received(0), _failed(false)
+    {
+    }
+
+    virtual void
+    pub(int counter, const Ice::Current& current)
+    {
+        Lock sync(*this);
+
+        //
+        // The events are queued while the adapter is inactive, only the
+        // event sent before the adapter is activated and the last event
+        // of each key are received.
+        //
+        Ice::Context::const_iterator p = current.ctx.find("key");
+        int key = p != current.ctx.end() ? atoi(p->second.c_str()) : -1;
+        if(key != counter % _keys || (_last.find(key) != _last.end() && _last[key] >= counter))
+        {
+            cerr << "failed! unexpected event: " << counter << " for key: " << key << endl;
+            _failed = true;
+        }
+        _last[key] = counter;
+        ++_received;
+
+        if(counter >= _total - _keys && ++_count == _keys)
+        {
+            _communicator->shutdown();
+        }
+    }
+
+    virtual void
+    check(const Subscription&)
+    {
+        Lock sync(*this);
+        test(!_failed);
+        test(_received <= _keys + 1);
+    }
+
+private:
+
+    const int _keys;
+    int _received;
+    map<int, int> _last;
+    bool _failed;
+};
 
 class ControllerEventI: public EventI
 {
@@ -283,12 +410,15 @@ public:
     Init()
     {
         ErraticEventI::_remainingMutex = new IceUtil::Mutex;
+        ThroughputEventI::_remainingMutex = new IceUtil::Mutex;
     }
 
     ~Init()
     {
         delete ErraticEventI::_remainingMutex;
         ErraticEventI::_remainingMutex = 0;
+        delete ThroughputEventI::_remainingMutex;
+        ThroughputEventI::_remainingMutex = 0;
     }
 };
 
@@ -304,8 +434,10 @@ run(int argc, char* argv[], const CommunicatorPtr& communicator)
     opts.addOpt("", "qos", IceUtilInternal::Options::NeedArg, "", IceUtilInternal::Options::Repeat);
     opts.addOpt("", "slow");
     opts.addOpt("", "erratic", IceUtilInternal::Options::NeedArg);
+    opts.addOpt("", "subscribers", IceUtilInternal::Options::NeedArg);
     opts.addOpt("", "maxQueueDropEvents", IceUtilInternal::Options::NeedArg);
     opts.addOpt("", "maxQueueRemoveSub", IceUtilInternal::Options::NeedArg);
+    opts.addOpt("", "conflateKeys", IceUtilInternal::Options::NeedArg);
 
     try
     {
@@ -346,6 +478,7 @@ run(int argc, char* argv[], const CommunicatorPtr& communicator)
     bool slow = opts.isSet("slow");
     int maxQueueDropEvents = opts.isSet("maxQueueDropEvents") ? atoi(opts.optArg("maxQueueDropEvents").c_str()) : 0;
     int maxQueueRemoveSub = opts.isSet("maxQueueRemoveSub") ? atoi(opts.optArg("maxQueueRemoveSub").c_str()) : 0;
+    int conflateKeys = opts.isSet("conflateKeys") ? atoi(opts.optArg("conflateKeys").c_str()) : 0;
     bool erratic = false;
     int erraticNum = 0;
     s = opts.optArg("erratic");
@@ -354,6 +487,7 @@ run(int argc, char* argv[], const CommunicatorPtr& communicator)
         erratic = true;
         erraticNum = atoi(s.c_str());
     }
+    int subscribers = opts.isSet("subscribers") ? atoi(opts.optArg("subscribers").c_str()) : 0;
     if(events <= 0)
     {
         cerr << argv[0] << ": events must be > 0." << endl;
@@ -392,6 +526,23 @@ run(int argc, char* argv[], const CommunicatorPtr& communicator)
             subs.push_back(item);
         }
     }
+    else if(subscribers > 0)
+    {
+        //
+        // Many subscribers sharing the same adapter to measure the
+        // throughput of the topic fan-out.
+        //
+        Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapterWithEndpoints("SubscriberAdapter", "default");
+        for(int i = 0 ; i < subscribers; ++i)
+        {
+            Subscription item;
+            item.adapter = adapter;
+            item.qos = cmdLineQos;
+            map<string, string>::const_iterator p = item.qos.find("reliability");
+            item.servant = new ThroughputEventI(communicator, events, p != item.qos.end() && p->second == "ordered");
+            subs.push_back(item);
+        }
+    }
     else if(slow)
     {
         Subscription item;
@@ -400,7 +551,7 @@ run(int argc, char* argv[], const CommunicatorPtr& communicator)
         item.qos = cmdLineQos;
         subs.push_back(item);
     }
-    else if(maxQueueDropEvents || maxQueueRemoveSub)
+    else if(maxQueueDropEvents || maxQueueRemoveSub || conflateKeys)
     {
         Subscription item1;
         item1.adapter = communicator->createObjectAdapterWithEndpoints("MaxQueueAdapter", "default");
@@ -408,10 +559,14 @@ run(int argc, char* argv[], const CommunicatorPtr& communicator)
         {
             item1.servant = new MaxQueueEventI(communicator, maxQueueDropEvents, events, false);
         }
-        else
+        else if(maxQueueRemoveSub)
         {
             item1.servant = new MaxQueueEventI(communicator, maxQueueRemoveSub, events, true);
         }
+        else
+        {
+            item1.servant = new ConflateEventI(communicator, conflateKeys, events);
+        }
         item1.qos = cmdLineQos;
         item1.activate = false;
         subs.push_back(item1);
@@ -470,6 +625,10 @@ run(int argc, char* argv[], const CommunicatorPtr& communicator)
             {
                 qos["reliability"] = "ordered";
             }
+            else if(reliability == "batched")
+            {
+                qos["reliability"] = "batched";
+            }
             else if(reliability == "batch")
             {
                 p->obj = p->obj->ice_batchOneway();
@@ -494,6 +653,13 @@ run(int argc, char* argv[], const CommunicatorPtr& communicator)
 
     communicator->waitForShutdown();
 
+    if(subscribers > 0)
+    {
+        IceUtil::Time elapsed = ThroughputEventI::elapsed();
+        IceUtil::Int64 ms = elapsed.toMilliSeconds() > 0 ? elapsed.toMilliSeconds() : 1;
+        cout << static_cast<IceUtil::Int64>(events) * subscribers * 1000 / ms << " events/s" << endl;
+    }
+
     {
         for(vector<Subscription>::const_iterator p = subs.begin(); p != subs.end(); ++p)
         {
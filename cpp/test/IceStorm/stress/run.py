@@ -83,6 +83,17 @@ def runtest(type):
     doTest(server1, server2, '--events 5000 --qos "reliability,ordered" ' + server1.reference(), '--events 5000')
     print("ok")
 
+    sys.stdout.write("Sending 2000 unordered events to 200 subscribers... ")
+    sys.stdout.flush()
+    subscriberProc = TestUtil.startServer(subscriber, ' --Ice.ServerIdleTime=0 --events 2000 --subscribers 200 ' +
+                                          server1.reference(), echo = False)
+    publisherProc = TestUtil.startClient(publisher, server1.reference() + ' --events 2000 --oneway')
+    publisherProc.waitTestSuccess()
+    subscriberProc.expect("([0-9]+) events/s", timeout = 120)
+    rate = subscriberProc.match.group(1)
+    subscriberProc.waitTestSuccess()
+    print("ok (%s events/s)" % rate)
+
     runAdmin("link TestIceStorm1/fed1 TestIceStorm2/fed1")
     sys.stdout.write("Sending 5000 ordered events across a link... ")
     sys.stdout.flush()
@@ -114,6 +125,11 @@ def runtest(type):
     print("ok")
 
     runAdmin("unlink TestIceStorm1/fed1 TestIceStorm2/fed1")
+    sys.stdout.write("Sending 20000 unordered events with batched delivery... ")
+    sys.stdout.flush()
+    doTest(server1, server2, '--events 20000 --qos "reliability,batched" ' + server1.reference(), '--events 20000 --oneway')
+    print("ok")
+
     sys.stdout.write("Sending 20000 unordered events with slow subscriber... ")
     sys.stdout.flush()
     doTest(server1, server2, ['--events 2 --slow ' + server1.reference(), '--events 20000 ' + server1.reference()], '--events 20000 --oneway')
@@ -195,6 +211,36 @@ def runtest(type):
     server1.stop()
     print("ok")
 
+    sys.stdout.write("Sending 5000 ordered events with conflation... ")
+    sys.stdout.flush()
+    server1.start(echo=False)
+    doTest(server1, server2,
+           '--events 5000 --qos "reliability,ordered" --qos "conflate,key" --conflateKeys=10 ' + server1.reference(),
+           '--events 5000 --keys 10 --maxQueueTest')
+    server1.stop()
+    print("ok")
+
+    sys.stdout.write("Sending 5000 ordered events with spilled queue... ")
+    sys.stdout.flush()
+    server1.start(echo=False, additionalOptions = " --IceStorm.Send.SpillThreshold=100")
+    doTest(server1, server2, '--events 5000 --qos "reliability,ordered" ' + server1.reference(), '--events 5000 --oneway')
+    server1.stop()
+    print("ok")
+
+    sys.stdout.write("Sending 1000 ordered events to 200 subscribers with the publish pool... ")
+    sys.stdout.flush()
+    opts = " --IceStorm.Publish.Threads=4 --IceStorm.Publish.MinSubscribers=10"
+    server1.start(echo=False, additionalOptions = opts)
+    subscriberProc = TestUtil.startServer(subscriber, ' --Ice.ServerIdleTime=0 --events 1000 --subscribers 200 ' +
+                                          '--qos "reliability,ordered" ' + server1.reference(), echo = False)
+    publisherProc = TestUtil.startClient(publisher, server1.reference() + ' --events 1000')
+    publisherProc.waitTestSuccess()
+    subscriberProc.expect("([0-9]+) events/s", timeout = 120)
+    rate = subscriberProc.match.group(1)
+    subscriberProc.waitTestSuccess()
+    server1.stop()
+    print("ok (%s events/s)" % rate)
+
 
 
 runtest("persistent")
@@ -16,6 +16,12 @@
 #include <TestCommon.h>
 #include <set>
 #include <vector>
+#include <cstring>
+
+#ifndef _WIN32
+#   include <unistd.h>
+#   include <sys/wait.h>
+#endif
 
 using namespace IceUtil;
 using namespace std;
@@ -179,6 +185,52 @@ runTest(int threadCount, GenerateFunc func, long howMany, bool verbose, string n
     }
 }
 
+#ifndef _WIN32
+void
+testFork()
+{
+    cout << "testing random numbers after fork... " << flush;
+
+    //
+    // The generator of this thread is created before the fork, the
+    // child process must reseed it rather than produce the same bytes.
+    //
+    char buf[32];
+    IceUtilInternal::generateRandom(buf, sizeof(buf));
+
+    int fds[2];
+    test(pipe(fds) == 0);
+    pid_t pid = fork();
+    test(pid != -1);
+    if(pid == 0)
+    {
+        IceUtilInternal::generateRandom(buf, sizeof(buf));
+        _exit(write(fds[1], buf, sizeof(buf)) == static_cast<ssize_t>(sizeof(buf)) ? 0 : 1);
+    }
+    close(fds[1]);
+
+    char parent[32];
+    IceUtilInternal::generateRandom(parent, sizeof(parent));
+
+    char child[32];
+    size_t index = 0;
+    while(index < sizeof(child))
+    {
+        ssize_t n = read(fds[0], child + index, sizeof(child) - index);
+        test(n > 0);
+        index += static_cast<size_t>(n);
+    }
+    close(fds[0]);
+
+    int status;
+    test(waitpid(pid, &status, 0) == pid);
+    test(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    test(memcmp(parent, child, sizeof(child)) != 0);
+
+    cout << "ok" << endl;
+}
+#endif
+
 int main(int argc, char* argv[])
 {
     long howMany = 300000;
@@ -218,6 +270,9 @@ int main(int argc, char* argv[])
 
     runTest<string, GenerateUUID>(threadCount, GenerateUUID(), howMany, verbose, "UUID");
     runTest<string, GenerateRandomString>(threadCount, GenerateRandomString(), howMany, verbose, "string");
+#ifndef _WIN32
+    testFork();
+#endif
 
     return EXIT_SUCCESS;
 }
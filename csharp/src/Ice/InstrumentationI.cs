@@ -857,7 +857,7 @@ namespace IceInternal
     }
 
     public class DispatchObserverI : ObserverWithDelegate<DispatchMetrics, Ice.Instrumentation.DispatchObserver>,
-        Ice.Instrumentation.DispatchObserver
+        Ice.Instrumentation.DispatchObserver, Ice.Instrumentation.DispatchQueueObserver
     {
         public void
         userException()
@@ -880,6 +880,18 @@ namespace IceInternal
             }
         }
 
+        public void queued(long time)
+        {
+            forEach((DispatchMetrics v) => {
+                    v.queueTime = v.queueTime.HasValue ? v.queueTime.Value + time : time;
+                });
+            Ice.Instrumentation.DispatchQueueObserver d = delegate_ as Ice.Instrumentation.DispatchQueueObserver;
+            if(d != null)
+            {
+                d.queued(time);
+            }
+        }
+
         private void userException(DispatchMetrics v)
         {
             ++v.userException;
@@ -41,6 +41,8 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.Locator\.PreferSecure$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^Ice\.Admin\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^Ice\.Admin\.Locator\.HedgeDelay$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.Locator$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.Router$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.CollocationOptimized$", false, null),
@@ -53,6 +55,8 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.Router\.PreferSecure$", false, null),
              new Property(@"^Ice\.Admin\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^Ice\.Admin\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^Ice\.Admin\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^Ice\.Admin\.Router\.HedgeDelay$", false, null),
              new Property(@"^Ice\.Admin\.Router\.Locator$", false, null),
              new Property(@"^Ice\.Admin\.Router\.Router$", false, null),
              new Property(@"^Ice\.Admin\.Router\.CollocationOptimized$", false, null),
@@ -66,7 +70,14 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^Ice\.Admin\.MessageSizeMax$", false, null),
+             new Property(@"^Ice\.Admin\.MaxDispatches$", false, null),
+             new Property(@"^Ice\.Admin\.MaxQueuedRequests$", false, null),
+             new Property(@"^Ice\.Admin\.OverloadPolicy$", false, null),
+             new Property(@"^Ice\.Admin\.PriorityDispatches$", false, null),
+             new Property(@"^Ice\.Admin\.PriorityFacets$", false, null),
+             new Property(@"^Ice\.Admin\.PriorityOperations$", false, null),
              new Property(@"^Ice\.Admin\.DelayCreation$", false, null),
              new Property(@"^Ice\.Admin\.Enabled$", false, null),
              new Property(@"^Ice\.Admin\.Facets$", false, null),
@@ -85,14 +96,18 @@ namespace IceInternal
              new Property(@"^Ice\.Config$", false, null),
              new Property(@"^Ice\.ConsoleListener$", false, null),
              new Property(@"^Ice\.Default\.CollocationOptimized$", false, null),
+             new Property(@"^Ice\.Default\.ConnectionsPerEndpoint$", false, null),
              new Property(@"^Ice\.Default\.EncodingVersion$", false, null),
              new Property(@"^Ice\.Default\.EndpointSelection$", false, null),
+             new Property(@"^Ice\.Default\.HedgeDelay$", false, null),
              new Property(@"^Ice\.Default\.Host$", false, null),
              new Property(@"^Ice\.Default\.Locator\.EndpointSelection$", false, null),
              new Property(@"^Ice\.Default\.Locator\.ConnectionCached$", false, null),
              new Property(@"^Ice\.Default\.Locator\.PreferSecure$", false, null),
              new Property(@"^Ice\.Default\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^Ice\.Default\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^Ice\.Default\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^Ice\.Default\.Locator\.HedgeDelay$", false, null),
              new Property(@"^Ice\.Default\.Locator\.Locator$", false, null),
              new Property(@"^Ice\.Default\.Locator\.Router$", false, null),
              new Property(@"^Ice\.Default\.Locator\.CollocationOptimized$", false, null),
@@ -108,6 +123,8 @@ namespace IceInternal
              new Property(@"^Ice\.Default\.Router\.PreferSecure$", false, null),
              new Property(@"^Ice\.Default\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^Ice\.Default\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^Ice\.Default\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^Ice\.Default\.Router\.HedgeDelay$", false, null),
              new Property(@"^Ice\.Default\.Router\.Locator$", false, null),
              new Property(@"^Ice\.Default\.Router\.Router$", false, null),
              new Property(@"^Ice\.Default\.Router\.CollocationOptimized$", false, null),
@@ -116,6 +133,7 @@ namespace IceInternal
              new Property(@"^Ice\.Default\.SlicedFormat$", false, null),
              new Property(@"^Ice\.Default\.SourceAddress$", false, null),
              new Property(@"^Ice\.Default\.Timeout$", false, null),
+             new Property(@"^Ice\.DispatchTag$", false, null),
              new Property(@"^Ice\.EventLog\.Source$", false, null),
              new Property(@"^Ice\.FactoryAssemblies$", false, null),
              new Property(@"^Ice\.HTTPProxyHost$", false, null),
@@ -143,6 +161,7 @@ namespace IceInternal
              new Property(@"^Ice\.PrintProcessId$", false, null),
              new Property(@"^Ice\.PrintStackTraces$", false, null),
              new Property(@"^Ice\.ProgramName$", false, null),
+             new Property(@"^Ice\.PropagateDeadlines$", false, null),
              new Property(@"^Ice\.RetryIntervals$", false, null),
              new Property(@"^Ice\.ServerIdleTime$", false, null),
              new Property(@"^Ice\.SOCKSProxyHost$", false, null),
@@ -157,6 +176,7 @@ namespace IceInternal
              new Property(@"^Ice\.ThreadPool\.Client\.Serialize$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.WorkStealing$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.Size$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.SizeMax$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.SizeWarn$", false, null),
@@ -164,6 +184,7 @@ namespace IceInternal
              new Property(@"^Ice\.ThreadPool\.Server\.Serialize$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.WorkStealing$", false, null),
              new Property(@"^Ice\.ThreadPriority$", false, null),
              new Property(@"^Ice\.Trace\.Admin\.Properties$", false, null),
              new Property(@"^Ice\.Trace\.Admin\.Logger$", false, null),
@@ -200,7 +221,11 @@ namespace IceInternal
              new Property(@"^IceMX\.Metrics\.[^\s]+\.RetainDetached$", false, null),
              new Property(@"^IceMX\.Metrics\.[^\s]+\.Accept$", false, null),
              new Property(@"^IceMX\.Metrics\.[^\s]+\.Reject$", false, null),
+             new Property(@"^IceMX\.Metrics\.[^\s]+\.Histogram$", false, null),
+             new Property(@"^IceMX\.Metrics\.[^\s]+\.CpuTime$", false, null),
              new Property(@"^IceMX\.Metrics\.[^\s]+$", false, null),
+             new Property(@"^IceMX\.OpenMetrics\.Host$", false, null),
+             new Property(@"^IceMX\.OpenMetrics\.Port$", false, null),
              null
         };
 
@@ -217,6 +242,8 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Multicast\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Locator\.HedgeDelay$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.Locator$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.Router$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.CollocationOptimized$", false, null),
@@ -229,6 +256,8 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Multicast\.Router\.PreferSecure$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Router\.HedgeDelay$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Router\.Locator$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Router\.Router$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Router\.CollocationOptimized$", false, null),
@@ -242,7 +271,14 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.MessageSizeMax$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.MaxDispatches$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.MaxQueuedRequests$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.OverloadPolicy$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.PriorityDispatches$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.PriorityFacets$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.PriorityOperations$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Timeout$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Close$", false, null),
@@ -254,6 +290,8 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Reply\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Locator\.HedgeDelay$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.Locator$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.Router$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.CollocationOptimized$", false, null),
@@ -266,6 +304,8 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Reply\.Router\.PreferSecure$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Router\.HedgeDelay$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Router\.Locator$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Router\.Router$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Router\.CollocationOptimized$", false, null),
@@ -279,7 +319,14 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceDiscovery\.Reply\.MessageSizeMax$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.MaxDispatches$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.MaxQueuedRequests$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.OverloadPolicy$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.PriorityDispatches$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.PriorityFacets$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.PriorityOperations$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Close$", false, null),
@@ -291,6 +338,8 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Locator\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Locator\.HedgeDelay$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.Locator$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.Router$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.CollocationOptimized$", false, null),
@@ -303,6 +352,8 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Locator\.Router\.PreferSecure$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Router\.HedgeDelay$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Router\.Locator$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Router\.Router$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Router\.CollocationOptimized$", false, null),
@@ -316,7 +367,14 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceDiscovery\.Locator\.MessageSizeMax$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.MaxDispatches$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.MaxQueuedRequests$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.OverloadPolicy$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.PriorityDispatches$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.PriorityFacets$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.PriorityOperations$", false, null),
              new Property(@"^IceDiscovery\.Lookup$", false, null),
              new Property(@"^IceDiscovery\.Timeout$", false, null),
              new Property(@"^IceDiscovery\.RetryCount$", false, null),
@@ -341,6 +399,8 @@ namespace IceInternal
              new Property(@"^IceGridDiscovery\.Reply\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGridDiscovery\.Reply\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGridDiscovery\.Reply\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGridDiscovery\.Reply\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGridDiscovery\.Reply\.Locator\.HedgeDelay$", false, null),
              new Property(@"^IceGridDiscovery\.Reply\.Locator\.Locator$", false, null),
              new Property(@"^IceGridDiscovery\.Reply\.Locator\.Router$", false, null),
              new Property(@"^IceGridDiscovery\.Reply\.Locator\.CollocationOptimized$", false, null),
@@ -353,6 +413,8 @@ namespace IceInternal
              new Property(@"^IceGridDiscovery\.Reply\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGridDiscovery\.Reply\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGridDiscovery\.Reply\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGridDiscovery\.Reply\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGridDiscovery\.Reply\.Router\.HedgeDelay$", false, null),
              new Property(@"^IceGridDiscovery\.Reply\.Router\.Locator$", false, null),
              new Property(@"^IceGridDiscovery\.Reply\.Router\.Router$", false, null),
              new Property(@"^IceGridDiscovery\.Reply\.Router\.CollocationOptimized$", false, null),
@@ -366,7 +428,14 @@ namespace IceInternal
              new Property(@"^IceGridDiscovery\.Reply\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGridDiscovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridDiscovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGridDiscovery\.Reply\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGridDiscovery\.Reply\.MessageSizeMax$", false, null),
+             new Property(@"^IceGridDiscovery\.Reply\.MaxDispatches$", false, null),
+             new Property(@"^IceGridDiscovery\.Reply\.MaxQueuedRequests$", false, null),
+             new Property(@"^IceGridDiscovery\.Reply\.OverloadPolicy$", false, null),
+             new Property(@"^IceGridDiscovery\.Reply\.PriorityDispatches$", false, null),
+             new Property(@"^IceGridDiscovery\.Reply\.PriorityFacets$", false, null),
+             new Property(@"^IceGridDiscovery\.Reply\.PriorityOperations$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.ACM\.Close$", false, null),
@@ -378,6 +447,8 @@ namespace IceInternal
              new Property(@"^IceGridDiscovery\.Locator\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGridDiscovery\.Locator\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGridDiscovery\.Locator\.Locator\.HedgeDelay$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.Locator\.Locator$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.Locator\.Router$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.Locator\.CollocationOptimized$", false, null),
@@ -390,6 +461,8 @@ namespace IceInternal
              new Property(@"^IceGridDiscovery\.Locator\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGridDiscovery\.Locator\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGridDiscovery\.Locator\.Router\.HedgeDelay$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.Router\.Locator$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.Router\.Router$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.Router\.CollocationOptimized$", false, null),
@@ -403,7 +476,14 @@ namespace IceInternal
              new Property(@"^IceGridDiscovery\.Locator\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGridDiscovery\.Locator\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGridDiscovery\.Locator\.MessageSizeMax$", false, null),
+             new Property(@"^IceGridDiscovery\.Locator\.MaxDispatches$", false, null),
+             new Property(@"^IceGridDiscovery\.Locator\.MaxQueuedRequests$", false, null),
+             new Property(@"^IceGridDiscovery\.Locator\.OverloadPolicy$", false, null),
+             new Property(@"^IceGridDiscovery\.Locator\.PriorityDispatches$", false, null),
+             new Property(@"^IceGridDiscovery\.Locator\.PriorityFacets$", false, null),
+             new Property(@"^IceGridDiscovery\.Locator\.PriorityOperations$", false, null),
              new Property(@"^IceGridDiscovery\.Lookup$", false, null),
              new Property(@"^IceGridDiscovery\.Timeout$", false, null),
              new Property(@"^IceGridDiscovery\.RetryCount$", false, null),
@@ -444,6 +524,8 @@ namespace IceInternal
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.PreferSecure$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.InvocationTimeout$", false, null),
+             new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.HedgeDelay$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.Locator$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.Router$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.CollocationOptimized$", false, null),
@@ -476,6 +558,8 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.HedgeDelay$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.Locator$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.Router$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.CollocationOptimized$", false, null),
@@ -488,6 +572,8 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.HedgeDelay$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.Locator$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.Router$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.CollocationOptimized$", false, null),
@@ -501,7 +587,14 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.MessageSizeMax$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.MaxDispatches$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.MaxQueuedRequests$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.OverloadPolicy$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.PriorityDispatches$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.PriorityFacets$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.PriorityOperations$", false, null),
              new Property(@"^IceGridAdmin\.Trace\.Observers$", false, null),
              new Property(@"^IceGridAdmin\.Trace\.SaveToRegistry$", false, null),
              null
@@ -520,6 +613,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.AdminRouter\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Locator\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.CollocationOptimized$", false, null),
@@ -532,6 +627,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.AdminRouter\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Router\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router\.CollocationOptimized$", false, null),
@@ -545,7 +642,14 @@ namespace IceInternal
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.MaxDispatches$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.MaxQueuedRequests$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.OverloadPolicy$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.PriorityDispatches$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.PriorityFacets$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.PriorityOperations$", false, null),
              new Property(@"^IceGrid\.InstanceName$", false, null),
              new Property(@"^IceGrid\.Node\.ACM\.Timeout$", false, null),
              new Property(@"^IceGrid\.Node\.ACM\.Heartbeat$", false, null),
@@ -558,6 +662,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Node\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Node\.Locator\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.CollocationOptimized$", false, null),
@@ -570,6 +676,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Node\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Node\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Node\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Node\.Router\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Node\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Node\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Node\.Router\.CollocationOptimized$", false, null),
@@ -583,7 +691,14 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGrid\.Node\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Node\.MaxDispatches$", false, null),
+             new Property(@"^IceGrid\.Node\.MaxQueuedRequests$", false, null),
+             new Property(@"^IceGrid\.Node\.OverloadPolicy$", false, null),
+             new Property(@"^IceGrid\.Node\.PriorityDispatches$", false, null),
+             new Property(@"^IceGrid\.Node\.PriorityFacets$", false, null),
+             new Property(@"^IceGrid\.Node\.PriorityOperations$", false, null),
              new Property(@"^IceGrid\.Node\.AllowRunningServersAsRoot$", false, null),
              new Property(@"^IceGrid\.Node\.AllowEndpointsOverride$", false, null),
              new Property(@"^IceGrid\.Node\.CollocateRegistry$", false, null),
@@ -606,6 +721,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Node\.UserAccountMapper\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Node\.UserAccountMapper\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.Locator$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.Router$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.CollocationOptimized$", false, null),
@@ -618,6 +735,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.CollocationOptimized$", false, null),
@@ -635,6 +754,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.CollocationOptimized$", false, null),
@@ -647,6 +768,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.CollocationOptimized$", false, null),
@@ -660,12 +783,21 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.MaxDispatches$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.MaxQueuedRequests$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.OverloadPolicy$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.PriorityDispatches$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.PriorityFacets$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.PriorityOperations$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.CollocationOptimized$", false, null),
@@ -682,6 +814,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Locator\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.CollocationOptimized$", false, null),
@@ -694,6 +828,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Client\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Router\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router\.CollocationOptimized$", false, null),
@@ -707,7 +843,14 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.MaxDispatches$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.MaxQueuedRequests$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.OverloadPolicy$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.PriorityDispatches$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.PriorityFacets$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.PriorityOperations$", false, null),
              new Property(@"^IceGrid\.Registry\.CryptPasswords$", false, null),
              new Property(@"^IceGrid\.Registry\.DefaultTemplates$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ACM\.Timeout$", false, null),
@@ -721,6 +864,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.CollocationOptimized$", false, null),
@@ -733,6 +878,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Router\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.CollocationOptimized$", false, null),
@@ -746,7 +893,14 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.MaxDispatches$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.MaxQueuedRequests$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.OverloadPolicy$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.PriorityDispatches$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.PriorityFacets$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.PriorityOperations$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Enabled$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Address$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Port$", false, null),
@@ -763,6 +917,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Locator\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.CollocationOptimized$", false, null),
@@ -775,6 +931,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Router\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.CollocationOptimized$", false, null),
@@ -788,7 +946,14 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.MaxDispatches$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.MaxQueuedRequests$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.OverloadPolicy$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.PriorityDispatches$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.PriorityFacets$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.PriorityOperations$", false, null),
              new Property(@"^IceGrid\.Registry\.LMDB\.MapSize$", false, null),
              new Property(@"^IceGrid\.Registry\.LMDB\.Path$", false, null),
              new Property(@"^IceGrid\.Registry\.NodeSessionTimeout$", false, null),
@@ -797,6 +962,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.CollocationOptimized$", false, null),
@@ -817,6 +984,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Locator\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.CollocationOptimized$", false, null),
@@ -829,6 +998,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Server\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Router\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router\.CollocationOptimized$", false, null),
@@ -842,7 +1013,14 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.MaxDispatches$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.MaxQueuedRequests$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.OverloadPolicy$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.PriorityDispatches$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.PriorityFacets$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.PriorityOperations$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionFilters$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM\.Timeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM\.Heartbeat$", false, null),
@@ -855,6 +1033,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.CollocationOptimized$", false, null),
@@ -867,6 +1047,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.CollocationOptimized$", false, null),
@@ -880,13 +1062,22 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.MaxDispatches$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.MaxQueuedRequests$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.OverloadPolicy$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.PriorityDispatches$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.PriorityFacets$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.PriorityOperations$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.HedgeDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.CollocationOptimized$", false, null),
@@ -921,6 +1112,8 @@ namespace IceInternal
              new Property(@"^IcePatch2\.Locator\.PreferSecure$", false, null),
              new Property(@"^IcePatch2\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IcePatch2\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IcePatch2\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IcePatch2\.Locator\.HedgeDelay$", false, null),
              new Property(@"^IcePatch2\.Locator\.Locator$", false, null),
              new Property(@"^IcePatch2\.Locator\.Router$", false, null),
              new Property(@"^IcePatch2\.Locator\.CollocationOptimized$", false, null),
@@ -933,6 +1126,8 @@ namespace IceInternal
              new Property(@"^IcePatch2\.Router\.PreferSecure$", false, null),
              new Property(@"^IcePatch2\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IcePatch2\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IcePatch2\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^IcePatch2\.Router\.HedgeDelay$", false, null),
              new Property(@"^IcePatch2\.Router\.Locator$", false, null),
              new Property(@"^IcePatch2\.Router\.Router$", false, null),
              new Property(@"^IcePatch2\.Router\.CollocationOptimized$", false, null),
@@ -946,7 +1141,14 @@ namespace IceInternal
              new Property(@"^IcePatch2\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^IcePatch2\.MessageSizeMax$", false, null),
+             new Property(@"^IcePatch2\.MaxDispatches$", false, null),
+             new Property(@"^IcePatch2\.MaxQueuedRequests$", false, null),
+             new Property(@"^IcePatch2\.OverloadPolicy$", false, null),
+             new Property(@"^IcePatch2\.PriorityDispatches$", false, null),
+             new Property(@"^IcePatch2\.PriorityFacets$", false, null),
+             new Property(@"^IcePatch2\.PriorityOperations$", false, null),
              new Property(@"^IcePatch2\.Directory$", false, null),
              new Property(@"^IcePatch2\.InstanceName$", false, null),
              null
@@ -1038,6 +1240,8 @@ namespace IceInternal
              new Property(@"^Glacier2\.Client\.Locator\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.Client\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^Glacier2\.Client\.Locator\.HedgeDelay$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.Locator$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.Router$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.CollocationOptimized$", false, null),
@@ -1050,6 +1254,8 @@ namespace IceInternal
              new Property(@"^Glacier2\.Client\.Router\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.Client\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^Glacier2\.Client\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.Client\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^Glacier2\.Client\.Router\.HedgeDelay$", false, null),
              new Property(@"^Glacier2\.Client\.Router\.Locator$", false, null),
              new Property(@"^Glacier2\.Client\.Router\.Router$", false, null),
              new Property(@"^Glacier2\.Client\.Router\.CollocationOptimized$", false, null),
@@ -1063,7 +1269,14 @@ namespace IceInternal
              new Property(@"^Glacier2\.Client\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^Glacier2\.Client\.MessageSizeMax$", false, null),
+             new Property(@"^Glacier2\.Client\.MaxDispatches$", false, null),
+             new Property(@"^Glacier2\.Client\.MaxQueuedRequests$", false, null),
+             new Property(@"^Glacier2\.Client\.OverloadPolicy$", false, null),
+             new Property(@"^Glacier2\.Client\.PriorityDispatches$", false, null),
+             new Property(@"^Glacier2\.Client\.PriorityFacets$", false, null),
+             new Property(@"^Glacier2\.Client\.PriorityOperations$", false, null),
              new Property(@"^Glacier2\.Client\.AlwaysBatch$", false, null),
              new Property(@"^Glacier2\.Client\.Buffered$", false, null),
              new Property(@"^Glacier2\.Client\.ForwardContext$", false, null),
@@ -1085,6 +1298,8 @@ namespace IceInternal
              new Property(@"^Glacier2\.PermissionsVerifier\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier\.LocatorCacheTimeout$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.PermissionsVerifier\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^Glacier2\.PermissionsVerifier\.HedgeDelay$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier\.Locator$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier\.Router$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier\.CollocationOptimized$", false, null),
@@ -1096,6 +1311,8 @@ namespace IceInternal
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.LocatorCacheTimeout$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.SSLPermissionsVerifier\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^Glacier2\.SSLPermissionsVerifier\.HedgeDelay$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.Locator$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.Router$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.CollocationOptimized$", false, null),
@@ -1113,6 +1330,8 @@ namespace IceInternal
              new Property(@"^Glacier2\.Server\.Locator\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.Server\.Locator\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^Glacier2\.Server\.Locator\.HedgeDelay$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.Locator$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.Router$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.CollocationOptimized$", false, null),
@@ -1125,6 +1344,8 @@ namespace IceInternal
              new Property(@"^Glacier2\.Server\.Router\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.Server\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^Glacier2\.Server\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.Server\.Router\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^Glacier2\.Server\.Router\.HedgeDelay$", false, null),
              new Property(@"^Glacier2\.Server\.Router\.Locator$", false, null),
              new Property(@"^Glacier2\.Server\.Router\.Router$", false, null),
              new Property(@"^Glacier2\.Server\.Router\.CollocationOptimized$", false, null),
@@ -1138,7 +1359,14 @@ namespace IceInternal
              new Property(@"^Glacier2\.Server\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.WorkStealing$", false, null),
              new Property(@"^Glacier2\.Server\.MessageSizeMax$", false, null),
+             new Property(@"^Glacier2\.Server\.MaxDispatches$", false, null),
+             new Property(@"^Glacier2\.Server\.MaxQueuedRequests$", false, null),
+             new Property(@"^Glacier2\.Server\.OverloadPolicy$", false, null),
+             new Property(@"^Glacier2\.Server\.PriorityDispatches$", false, null),
+             new Property(@"^Glacier2\.Server\.PriorityFacets$", false, null),
+             new Property(@"^Glacier2\.Server\.PriorityOperations$", false, null),
              new Property(@"^Glacier2\.Server\.AlwaysBatch$", false, null),
              new Property(@"^Glacier2\.Server\.Buffered$", false, null),
              new Property(@"^Glacier2\.Server\.ForwardContext$", false, null),
@@ -1150,6 +1378,8 @@ namespace IceInternal
              new Property(@"^Glacier2\.SessionManager\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.SessionManager\.LocatorCacheTimeout$", false, null),
              new Property(@"^Glacier2\.SessionManager\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.SessionManager\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^Glacier2\.SessionManager\.HedgeDelay$", false, null),
              new Property(@"^Glacier2\.SessionManager\.Locator$", false, null),
              new Property(@"^Glacier2\.SessionManager\.Router$", false, null),
              new Property(@"^Glacier2\.SessionManager\.CollocationOptimized$", false, null),
@@ -1160,6 +1390,8 @@ namespace IceInternal
              new Property(@"^Glacier2\.SSLSessionManager\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.LocatorCacheTimeout$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.SSLSessionManager\.ConnectionsPerEndpoint$", false, null),
+             new Property(@"^Glacier2\.SSLSessionManager\.HedgeDelay$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.Locator$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.Router$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.CollocationOptimized$", false, null),
@@ -1491,6 +1491,7 @@ namespace IceInternal
                     break;
                 }
                 case Ice.EndpointSelectionType.Ordered:
+                case Ice.EndpointSelectionType.LatencyAware:
                 {
                     // Nothing to do.
                     break;
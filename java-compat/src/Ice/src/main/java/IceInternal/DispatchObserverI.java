@@ -11,7 +11,7 @@ package IceInternal;
 
 public class DispatchObserverI
     extends IceMX.ObserverWithDelegate<IceMX.DispatchMetrics, Ice.Instrumentation.DispatchObserver>
-    implements Ice.Instrumentation.DispatchObserver
+    implements Ice.Instrumentation.DispatchObserver, Ice.Instrumentation.DispatchQueueObserver
 {
     @Override
     public void
@@ -43,6 +43,25 @@ public class DispatchObserverI
         }
     }
 
+    @Override
+    public void
+    queued(final long time)
+    {
+        forEach(new MetricsUpdate<IceMX.DispatchMetrics>()
+                {
+                    @Override
+                    public void
+                    update(IceMX.DispatchMetrics v)
+                    {
+                        v.setQueueTime(v.hasQueueTime() ? v.getQueueTime() + time : time);
+                    }
+                });
+        if(_delegate instanceof Ice.Instrumentation.DispatchQueueObserver)
+        {
+            ((Ice.Instrumentation.DispatchQueueObserver)_delegate).queued(time);
+        }
+    }
+
     final private MetricsUpdate<IceMX.DispatchMetrics> _userException = new MetricsUpdate<IceMX.DispatchMetrics>()
     {
         @Override
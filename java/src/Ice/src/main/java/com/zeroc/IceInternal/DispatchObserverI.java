@@ -12,7 +12,7 @@ package com.zeroc.IceInternal;
 public class DispatchObserverI
     extends com.zeroc.IceMX.ObserverWithDelegate<com.zeroc.IceMX.DispatchMetrics,
                                                  com.zeroc.Ice.Instrumentation.DispatchObserver>
-    implements com.zeroc.Ice.Instrumentation.DispatchObserver
+    implements com.zeroc.Ice.Instrumentation.DispatchObserver, com.zeroc.Ice.Instrumentation.DispatchQueueObserver
 {
     @Override
     public void userException()
@@ -41,6 +41,23 @@ public class DispatchObserverI
         }
     }
 
+    @Override
+    public void queued(final long time)
+    {
+        forEach(new MetricsUpdate<com.zeroc.IceMX.DispatchMetrics>()
+                {
+                    @Override
+                    public void update(com.zeroc.IceMX.DispatchMetrics v)
+                    {
+                        v.setQueueTime(v.hasQueueTime() ? v.getQueueTime() + time : time);
+                    }
+                });
+        if(_delegate instanceof com.zeroc.Ice.Instrumentation.DispatchQueueObserver)
+        {
+            ((com.zeroc.Ice.Instrumentation.DispatchQueueObserver)_delegate).queued(time);
+        }
+    }
+
     final private MetricsUpdate<com.zeroc.IceMX.DispatchMetrics> _userException =
         new MetricsUpdate<com.zeroc.IceMX.DispatchMetrics>()
     {
@@ -766,6 +766,7 @@ public class RoutableReference extends Reference
                 break;
             }
             case Ordered:
+            case LatencyAware:
             {
                 // Nothing to do.
                 break;
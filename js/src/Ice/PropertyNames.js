@@ -42,6 +42,8 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.Locator\.PreferSecure/", false, null),
     new Property("/^Ice\.Admin\.Locator\.LocatorCacheTimeout/", false, null),
     new Property("/^Ice\.Admin\.Locator\.InvocationTimeout/", false, null),
+    new Property("/^Ice\.Admin\.Locator\.ConnectionsPerEndpoint/", false, null),
+    new Property("/^Ice\.Admin\.Locator\.HedgeDelay/", false, null),
     new Property("/^Ice\.Admin\.Locator\.Locator/", false, null),
     new Property("/^Ice\.Admin\.Locator\.Router/", false, null),
     new Property("/^Ice\.Admin\.Locator\.CollocationOptimized/", false, null),
@@ -54,6 +56,8 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.Router\.PreferSecure/", false, null),
     new Property("/^Ice\.Admin\.Router\.LocatorCacheTimeout/", false, null),
     new Property("/^Ice\.Admin\.Router\.InvocationTimeout/", false, null),
+    new Property("/^Ice\.Admin\.Router\.ConnectionsPerEndpoint/", false, null),
+    new Property("/^Ice\.Admin\.Router\.HedgeDelay/", false, null),
     new Property("/^Ice\.Admin\.Router\.Locator/", false, null),
     new Property("/^Ice\.Admin\.Router\.Router/", false, null),
     new Property("/^Ice\.Admin\.Router\.CollocationOptimized/", false, null),
@@ -67,7 +71,14 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.ThreadPool\.Serialize/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.ThreadPriority/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.WorkStealing/", false, null),
     new Property("/^Ice\.Admin\.MessageSizeMax/", false, null),
+    new Property("/^Ice\.Admin\.MaxDispatches/", false, null),
+    new Property("/^Ice\.Admin\.MaxQueuedRequests/", false, null),
+    new Property("/^Ice\.Admin\.OverloadPolicy/", false, null),
+    new Property("/^Ice\.Admin\.PriorityDispatches/", false, null),
+    new Property("/^Ice\.Admin\.PriorityFacets/", false, null),
+    new Property("/^Ice\.Admin\.PriorityOperations/", false, null),
     new Property("/^Ice\.Admin\.DelayCreation/", false, null),
     new Property("/^Ice\.Admin\.Enabled/", false, null),
     new Property("/^Ice\.Admin\.Facets/", false, null),
@@ -86,14 +97,18 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Config/", false, null),
     new Property("/^Ice\.ConsoleListener/", false, null),
     new Property("/^Ice\.Default\.CollocationOptimized/", false, null),
+    new Property("/^Ice\.Default\.ConnectionsPerEndpoint/", false, null),
     new Property("/^Ice\.Default\.EncodingVersion/", false, null),
     new Property("/^Ice\.Default\.EndpointSelection/", false, null),
+    new Property("/^Ice\.Default\.HedgeDelay/", false, null),
     new Property("/^Ice\.Default\.Host/", false, null),
     new Property("/^Ice\.Default\.Locator\.EndpointSelection/", false, null),
     new Property("/^Ice\.Default\.Locator\.ConnectionCached/", false, null),
     new Property("/^Ice\.Default\.Locator\.PreferSecure/", false, null),
     new Property("/^Ice\.Default\.Locator\.LocatorCacheTimeout/", false, null),
     new Property("/^Ice\.Default\.Locator\.InvocationTimeout/", false, null),
+    new Property("/^Ice\.Default\.Locator\.ConnectionsPerEndpoint/", false, null),
+    new Property("/^Ice\.Default\.Locator\.HedgeDelay/", false, null),
     new Property("/^Ice\.Default\.Locator\.Locator/", false, null),
     new Property("/^Ice\.Default\.Locator\.Router/", false, null),
     new Property("/^Ice\.Default\.Locator\.CollocationOptimized/", false, null),
@@ -109,6 +124,8 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Default\.Router\.PreferSecure/", false, null),
     new Property("/^Ice\.Default\.Router\.LocatorCacheTimeout/", false, null),
     new Property("/^Ice\.Default\.Router\.InvocationTimeout/", false, null),
+    new Property("/^Ice\.Default\.Router\.ConnectionsPerEndpoint/", false, null),
+    new Property("/^Ice\.Default\.Router\.HedgeDelay/", false, null),
     new Property("/^Ice\.Default\.Router\.Locator/", false, null),
     new Property("/^Ice\.Default\.Router\.Router/", false, null),
     new Property("/^Ice\.Default\.Router\.CollocationOptimized/", false, null),
@@ -117,6 +134,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Default\.SlicedFormat/", false, null),
     new Property("/^Ice\.Default\.SourceAddress/", false, null),
     new Property("/^Ice\.Default\.Timeout/", false, null),
+    new Property("/^Ice\.DispatchTag/", false, null),
     new Property("/^Ice\.EventLog\.Source/", false, null),
     new Property("/^Ice\.FactoryAssemblies/", false, null),
     new Property("/^Ice\.HTTPProxyHost/", false, null),
@@ -144,6 +162,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.PrintProcessId/", false, null),
     new Property("/^Ice\.PrintStackTraces/", false, null),
     new Property("/^Ice\.ProgramName/", false, null),
+    new Property("/^Ice\.PropagateDeadlines/", false, null),
     new Property("/^Ice\.RetryIntervals/", false, null),
     new Property("/^Ice\.ServerIdleTime/", false, null),
     new Property("/^Ice\.SOCKSProxyHost/", false, null),
@@ -158,6 +177,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.ThreadPool\.Client\.Serialize/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.ThreadPriority/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.WorkStealing/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.Size/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.SizeMax/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.SizeWarn/", false, null),
@@ -165,6 +185,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.ThreadPool\.Server\.Serialize/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.ThreadPriority/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.WorkStealing/", false, null),
     new Property("/^Ice\.ThreadPriority/", false, null),
     new Property("/^Ice\.Trace\.Admin\.Properties/", false, null),
     new Property("/^Ice\.Trace\.Admin\.Logger/", false, null),
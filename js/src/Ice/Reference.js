@@ -2286,6 +2286,7 @@ class RoutableReference extends Reference
                 break;
             }
             case EndpointSelectionType.Ordered:
+            case EndpointSelectionType.LatencyAware:
             {
                 // Nothing to do.
                 break;